@@ -0,0 +1,255 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+*/
+
+// vergleicht die Stapelfunktionen aus le_math.cpp mit den urspruenglichen Einzelfunktionen (Strecken, Rotation, Rechtecke)
+//
+// g++ -std=c++11 -O2 -Iinclude -c src/le_math.cpp -o le_math.o `sdl2-config --cflags`
+// g++ -std=c++11 -O2 -Iinclude bench/le_bench_math.cpp le_math.o `sdl2-config --cflags --libs`
+
+#include "../include/le_math.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LE_BENCH_AMOUNT     4096
+#define LE_BENCH_RUNS       2000
+#define LE_BENCH_DEGREE     17.0
+
+static Line_d benchLinesA[LE_BENCH_AMOUNT];
+static Line_d benchLinesB[LE_BENCH_AMOUNT];
+static bool benchResults[LE_BENCH_AMOUNT];
+static bool benchExpected[LE_BENCH_AMOUNT];
+static Point_d benchSource[LE_BENCH_AMOUNT];
+static Point_d benchPoints[LE_BENCH_AMOUNT];
+static Point_d benchCenters[LE_BENCH_AMOUNT];
+static Point_d benchRotated[LE_BENCH_AMOUNT];
+static LECollBox_d benchBoxesA[LE_BENCH_AMOUNT];
+static LECollBox_d benchBoxesB[LE_BENCH_AMOUNT];
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// urspruengliche Einzelfunktionen
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static Point_d benchOriginalRotatePoint(Point_d point, Point_d center, double degree)
+{
+  Point_d newPoint;
+  double radiant = degree * (PI / 180.0f);
+  newPoint.x = center.x + (point.x - center.x) * cos(radiant) - (point.y - center.y) * sin(radiant);
+  newPoint.y = center.y + (point.x - center.x) * sin(radiant) + (point.y - center.y) * cos(radiant);
+
+  return newPoint;
+}
+
+static bool benchOriginalLineIntersection(Line_d l1, Line_d l2)
+{
+  bool collided = LE_FALSE;
+  double a = 0.0f;
+  double b = 0.0f;
+  double t = 0.0f;
+  double r = 0.0f;
+  Line_d buffer;
+  Point_d m1 = {0.0f, 0.0f};
+  Point_d m2 = {0.0f, 0.0f};
+  Point_d sLeft = {0.0f, 0.0f};
+  Point_d sRight = {0.0f, 0.0f};
+
+  if(m1.x == 0.0f)
+  {
+    buffer = l1;
+    l1 = l2;
+    l2 = buffer;
+  }
+
+  m1 = {(l1.p2.x - l1.p1.x), (l1.p2.y - l1.p1.y)};
+  m2 = {(l2.p2.x - l2.p1.x), (l2.p2.y - l2.p1.y)};
+
+  a = (l2.p1.x - l1.p1.x) / m1.x;
+  b = m2.x / m1.x;
+  t = (l2.p1.y - (l1.p1.y + m1.y * a)) / (m1.y * b - m2.y);
+  r = (l2.p1.x - l1.p1.x + m2.x * t) / m1.x;
+
+  sLeft.x = round((l1.p1.x + m1.x * r) * 100.0f) / 100.0f;
+  sLeft.y = round((l1.p1.y + m1.y * r) * 100.0f) / 100.0f;
+  sRight.x = round((l2.p1.x + m2.x * t) * 100.0f) / 100.0f;
+  sRight.y = round((l2.p1.y + m2.y * t) * 100.0f) / 100.0f;
+
+  collided = (sLeft.x == sRight.x) && (sLeft.y == sRight.y) && r >= 0.0f && r <= 1.0f && t >= 0.0f && t <= 1.0f;
+
+  return collided;
+}
+
+static bool benchOriginalRectIntersection(LECollBox_d frameBoxA, LECollBox_d frameBoxB)
+{
+  bool collided = LE_FALSE;
+  const Line_d * pEdgesA = &frameBoxA.lineLeft;
+  const Line_d * pEdgesB = &frameBoxB.lineLeft;
+
+  // dieselbe Reihenfolge wie die urspruenglichen 16 Aufrufe
+
+  for(int i = 0 ; i < 16 && !collided ; i++)
+    {collided = benchOriginalLineIntersection(pEdgesA[i / 4], pEdgesB[i % 4]);}
+
+  return collided;
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// Messung
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static double benchRandom()
+{
+  return (double) (rand() % 2000) / 10.0;
+}
+
+static LECollBox_d benchBox(double x, double y, double width, double height, double degree)
+{
+  LECollBox_d box;
+
+  box.lineLeft = {{x, y + height}, {x, y}};
+  box.lineTop = {{x, y}, {x + width, y}};
+  box.lineRight = {{x + width, y}, {x + width, y + height}};
+  box.lineBottom = {{x + width, y + height}, {x, y + height}};
+  box.center = {x + width / 2.0, y + height / 2.0};
+  mathTransformBoxes(&box, 1, degree);
+
+  return box;
+}
+
+static void benchFill()
+{
+  srand(42);
+
+  for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+  {
+    benchLinesA[i] = {{benchRandom(), benchRandom()}, {benchRandom(), benchRandom()}};
+    benchLinesB[i] = {{benchRandom(), benchRandom()}, {benchRandom(), benchRandom()}};
+    benchSource[i] = {benchRandom(), benchRandom()};
+    benchCenters[i] = {benchRandom(), benchRandom()};
+    benchBoxesA[i] = benchBox(benchRandom(), benchRandom(), 10.0 + benchRandom() / 4.0, 10.0 + benchRandom() / 4.0, benchRandom());
+    benchBoxesB[i] = benchBox(benchRandom(), benchRandom(), 10.0 + benchRandom() / 4.0, 10.0 + benchRandom() / 4.0, benchRandom());
+  }
+}
+
+static double benchNanoseconds(uint64_t ticks)
+{
+  return (double) ticks * 1000000000.0 / (double) SDL_GetPerformanceFrequency() / LE_BENCH_RUNS / LE_BENCH_AMOUNT;
+}
+
+static void benchLineIntersections()
+{
+  uint64_t start = SDL_GetPerformanceCounter();
+  uint64_t original = 0;
+  uint64_t batch = 0;
+  int differences = 0;
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+  {
+    for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+      {benchExpected[i] = benchOriginalLineIntersection(benchLinesA[i], benchLinesB[i]);}
+  }
+
+  original = SDL_GetPerformanceCounter() - start;
+  start = SDL_GetPerformanceCounter();
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+    {mathLineIntersections(benchLinesA, benchLinesB, benchResults, LE_BENCH_AMOUNT);}
+
+  batch = SDL_GetPerformanceCounter() - start;
+
+  // die urspruengliche Funktion rundet den Schnittpunkt, Randfaelle koennen daher abweichen
+
+  for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+    {differences += (benchResults[i] != benchExpected[i]) ? 1 : 0;}
+
+  printf("lineIntersections  original %8.2f ns / pair   batch %8.2f ns / pair   %d of %d differ\n",
+         benchNanoseconds(original), benchNanoseconds(batch), differences, LE_BENCH_AMOUNT);
+}
+
+static void benchRotatePoints()
+{
+  uint64_t start = 0;
+  uint64_t original = 0;
+  uint64_t batch = 0;
+  double error = 0.0;
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+  {
+    start = SDL_GetPerformanceCounter();
+
+    for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+      {benchRotated[i] = benchOriginalRotatePoint(benchSource[i], benchCenters[i], LE_BENCH_DEGREE);}
+
+    original += SDL_GetPerformanceCounter() - start;
+  }
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+  {
+    memcpy(benchPoints, benchSource, sizeof(benchPoints));
+    start = SDL_GetPerformanceCounter();
+    mathRotatePoints(benchPoints, benchCenters, LE_BENCH_AMOUNT, LE_BENCH_DEGREE);
+    batch += SDL_GetPerformanceCounter() - start;
+  }
+
+  for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+    {error = fmax(error, fmax(fabs(benchPoints[i].x - benchRotated[i].x), fabs(benchPoints[i].y - benchRotated[i].y)));}
+
+  printf("rotatePoints       original %8.2f ns / point  batch %8.2f ns / point  max error %g\n",
+         benchNanoseconds(original), benchNanoseconds(batch), error);
+}
+
+static void benchRectIntersections()
+{
+  uint64_t start = SDL_GetPerformanceCounter();
+  uint64_t original = 0;
+  uint64_t batch = 0;
+  int hitsOriginal = 0;
+  int hitsBatch = 0;
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+  {
+    for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+      {benchExpected[i] = benchOriginalRectIntersection(benchBoxesA[i], benchBoxesB[i]);}
+  }
+
+  original = SDL_GetPerformanceCounter() - start;
+  start = SDL_GetPerformanceCounter();
+
+  for(int k = 0 ; k < LE_BENCH_RUNS ; k++)
+  {
+    for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+      {benchResults[i] = mathRectsIntersection(&benchBoxesA[i], &benchBoxesB[i], 1);}
+  }
+
+  batch = SDL_GetPerformanceCounter() - start;
+
+  // die neue Funktion erkennt zusaetzlich Rechtecke, die vollstaendig im anderen liegen
+
+  for(int i = 0 ; i < LE_BENCH_AMOUNT ; i++)
+  {
+    hitsOriginal += benchExpected[i] ? 1 : 0;
+    hitsBatch += benchResults[i] ? 1 : 0;
+  }
+
+  printf("rectIntersection   original %8.2f ns / pair   batch %8.2f ns / pair   hits %d / %d\n",
+         benchNanoseconds(original), benchNanoseconds(batch), hitsOriginal, hitsBatch);
+}
+
+int main()
+{
+  benchFill();
+  benchLineIntersections();
+  benchRotatePoints();
+  benchRectIntersections();
+
+  return 0;
+}
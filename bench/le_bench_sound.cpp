@@ -0,0 +1,113 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+*/
+
+// misst soundMixBus() und soundMixMaster() je Puffer, ohne Audiogeraet
+//
+// g++ -std=c++11 -O2 -Iinclude bench/le_bench_sound.cpp src/*.cpp `sdl2-config --cflags --libs` -lSDL2_mixer -lSDL2_ttf -lSDL2_image -pthread
+
+#include "../include/le_moon.h"
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+#define LE_BENCH_FREQUENCY  44100
+#define LE_BENCH_FRAMES     1024                                                              // Standardpuffer von Mix_OpenAudio() in Stereo
+#define LE_BENCH_BUFFERS    20000
+
+static int16_t benchSource[LE_BENCH_FRAMES * 2];
+static int16_t benchBuffer[LE_BENCH_FRAMES * 2];
+
+static void benchFill()
+{
+  for(int i = 0 ; i < LE_BENCH_FRAMES ; i++)
+  {
+    benchSource[2 * i] = (int16_t) (24000.0 * sin(2.0 * M_PI * 440.0 * i / LE_BENCH_FREQUENCY));
+    benchSource[2 * i + 1] = (int16_t) (24000.0 * sin(2.0 * M_PI * 660.0 * i / LE_BENCH_FREQUENCY));
+  }
+}
+
+static void benchReport(const char * pName, uint64_t ticks)
+{
+  double nanoseconds = (double) ticks * 1000000000.0 / (double) SDL_GetPerformanceFrequency() / LE_BENCH_BUFFERS;
+  double budget = (double) LE_BENCH_FRAMES * 1000000000.0 / LE_BENCH_FREQUENCY;
+
+  printf("%-32s %10.1f ns / buffer  %6.3f %% of the buffer\n", pName, nanoseconds, 100.0 * nanoseconds / budget);
+}
+
+static void benchBus(const char * pName, LESoundBus * pBus)
+{
+  float state[2] = {0.0f, 0.0f};
+  uint64_t ticks = 0;
+  uint64_t start = 0;
+
+  for(int k = 0 ; k < LE_BENCH_BUFFERS ; k++)
+  {
+    memcpy(benchBuffer, benchSource, sizeof(benchBuffer));
+    start = SDL_GetPerformanceCounter();
+    LEMoon::soundMixBus(pBus, benchBuffer, LE_BENCH_FRAMES * 2, state);
+    ticks += SDL_GetPerformanceCounter() - start;
+  }
+
+  benchReport(pName, ticks);
+}
+
+static void benchMaster(const char * pName, LESoundMixer * pMixer)
+{
+  uint64_t ticks = 0;
+  uint64_t start = 0;
+
+  for(int k = 0 ; k < LE_BENCH_BUFFERS ; k++)
+  {
+    memcpy(benchBuffer, benchSource, sizeof(benchBuffer));
+    start = SDL_GetPerformanceCounter();
+    LEMoon::soundMixMaster(pMixer, (uint8_t*) benchBuffer, sizeof(benchBuffer));
+    ticks += SDL_GetPerformanceCounter() - start;
+  }
+
+  benchReport(pName, ticks);
+}
+
+int main()
+{
+  LESoundMixer mixer;
+  LESoundBus * pBus = &mixer.buses[0];
+
+  benchFill();
+
+  pBus->gainFrom = 1.0f;
+  pBus->gainTo = 1.0f;
+  pBus->coefficientFrom = 1.0f;
+  pBus->coefficientTo = 1.0f;
+  benchBus("soundMixBus unity", pBus);
+
+  pBus->gainFrom = 1.0f;
+  pBus->gainTo = 0.5f;
+  benchBus("soundMixBus gain ramp", pBus);
+
+  pBus->coefficientFrom = 0.1f;
+  pBus->coefficientTo = 0.05f;
+  benchBus("soundMixBus gain + low pass", pBus);
+
+  mixer.limit = 1.0f;
+  mixer.limiterGain = 1.0f;
+  mixer.headroomFrom = 1.0f;
+  mixer.headroomTo = 1.0f;
+  mixer.frequency = LE_BENCH_FREQUENCY;
+  mixer.supported = LE_TRUE;
+  benchMaster("soundMixMaster off", &mixer);
+
+  // mit Reserve vor der Summe, wie bei aktivem Limiter
+
+  mixer.limit = 0.5f;
+  mixer.headroomFrom = 0.5f;
+  mixer.headroomTo = 0.5f;
+  benchMaster("soundMixMaster limiting", &mixer);
+
+  return 0;
+}
@@ -1,113 +1,151 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
-  date:               18.05.2017
-  updated:            13.04.2018
-*/
-
-#include <SDL.h>
-#include <mutex>
-using namespace std;
-//#include "theoraplay.h"
-#include "glm/glm.hpp"
-
-#ifndef H_LE_GLB
-#define H_LE_GLB
-
-// OS specific
-
-//#define LE_ANDROID              102
-#define LE_WINDOWS              103
-//#define LE_LINUX                104
-
-// LEMoon constants
-
-#define LE_DEBUG                100
-#define LE_TRUE                 1
-#define LE_FALSE                0
-#define LE_CURRENT_SRCRECT      -1
-#define LE_FORWARD              1
-#define LE_BACKWARD             2
-#define LE_INACTIVE             0
-#define LE_PRESSED              1
-#define LE_RELEASED             2
-//#define LE_THEORA               1
-
-typedef struct sColor
-{
-  uint8_t r;
-  uint8_t g;
-  uint8_t b;
-  uint8_t a;
-} Color;
-
-struct LinkedVec2
-{
-  LinkedVec2 * pLeft;
-  LinkedVec2 * pRight;
-  uint32_t id;
-  glm::vec2 data;
-  double currentDegree;
-};
-
-typedef struct sLine
-{
-  SDL_Point pointA;
-  SDL_Point pointB;
-} Line;
-
-typedef struct sLECollBox
-{
-  Line lineLeft;
-  Line lineTop;
-  Line lineRight;
-  Line lineBottom;
-  SDL_Point center;
-} LECollBox;
-
-typedef struct sPoint_d
-{
-  double x;
-  double y;
-} Point_d;
-
-typedef struct sLine_d
-{
-  Point_d p1;
-  Point_d p2;
-} Line_d;
-
-typedef struct sLECollBox_d
-{
-  Line_d lineLeft;
-  Line_d lineTop;
-  Line_d lineRight;
-  Line_d lineBottom;
-  Point_d center;
-} LECollBox_d;
-
-#ifdef LE_THEORA
-typedef struct sAudioQueue 
-{
-  const THEORAPLAY_AudioPacket * pAudio;
-  int offset;
-  struct sAudioQueue * pNext;
-} AudioQueue;
-#endif
-
-struct SourceRect
-{
-  SourceRect * pLeft;
-  SourceRect * pRight;
-  uint32_t id;
-  SDL_Rect srcRect;
-};
-
-typedef struct SNotify
-{
-  bool notifyByEngine;
-  bool notifyByUser;
-} Notify;
-
-#endif
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               18.05.2017
+  updated:            19.10.2026
+*/
+
+#include <SDL.h>
+#include <mutex>
+using namespace std;
+//#include "theoraplay.h"
+#include "glm/glm.hpp"
+
+#ifndef H_LE_GLB
+#define H_LE_GLB
+
+// OS specific
+
+//#define LE_ANDROID              102
+#define LE_WINDOWS              103
+//#define LE_LINUX                104
+
+// LEMoon constants
+
+#define LE_DEBUG                100
+#define LE_TRUE                 1
+#define LE_FALSE                0
+#define LE_CURRENT_SRCRECT      -1
+#define LE_FORWARD              1
+#define LE_BACKWARD             2
+#define LE_INACTIVE             0
+#define LE_PRESSED              1
+#define LE_RELEASED             2
+#define LE_CLONE_NONE           0xFFFFFFFF
+#define LE_COLL_LAYERS          32
+#define LE_COLL_LAYER_DEFAULT   0x00000001
+#define LE_COLL_MASK_ALL        0xFFFFFFFF
+#define LE_COLL_SHAPE_RECT      0
+#define LE_COLL_SHAPE_CIRCLE    1
+#define LE_COLL_SHAPE_POLYGON   2
+#define LE_COLL_POLYGON_MAX     8
+#define LE_CONTACT_BEGIN        1
+#define LE_CONTACT_STAY         2
+#define LE_CONTACT_END          3
+#define LE_ALIGN_LEFT           0
+#define LE_ALIGN_CENTER         1
+#define LE_ALIGN_RIGHT          2
+#define LE_SOUND_COMMANDS       256
+#define LE_SOUND_CMD_PLAY       0
+#define LE_SOUND_CMD_FADE_IN    1
+#define LE_SOUND_CMD_FADE_OUT   2
+#define LE_SOUND_CMD_HALT       3
+#define LE_SOUND_CMD_VOLUME     4
+#define LE_SOUND_CMD_FREE       5
+#define LE_SOUND_CMD_POSITION   6
+#define LE_SOUND_CMD_PAUSE      7
+#define LE_SOUND_CMD_RESUME     8
+#define LE_SOUND_CMD_BUS        9
+#define LE_SOUND_BUS_SFX        0
+#define LE_SOUND_BUS_UI         1
+#define LE_SOUND_BUS_DIALOG     2
+#define LE_SOUND_BUS_MUSIC      3
+#define LE_SOUND_BUSES          4
+//#define LE_THEORA               1
+
+typedef struct sColor
+{
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+  uint8_t a;
+} Color;
+
+struct LinkedVec2
+{
+  LinkedVec2 * pLeft;
+  LinkedVec2 * pRight;
+  uint32_t id;
+  glm::vec2 data;
+  double currentDegree;
+};
+
+typedef struct sLine
+{
+  SDL_Point pointA;
+  SDL_Point pointB;
+} Line;
+
+typedef struct sLECollBox
+{
+  Line lineLeft;
+  Line lineTop;
+  Line lineRight;
+  Line lineBottom;
+  SDL_Point center;
+} LECollBox;
+
+typedef struct sPoint_d
+{
+  double x;
+  double y;
+} Point_d;
+
+typedef struct sLine_d
+{
+  Point_d p1;
+  Point_d p2;
+} Line_d;
+
+typedef struct sLECollBox_d
+{
+  Line_d lineLeft;
+  Line_d lineTop;
+  Line_d lineRight;
+  Line_d lineBottom;
+  Point_d center;
+} LECollBox_d;
+
+typedef struct sAABB_d
+{
+  double minX;
+  double minY;
+  double maxX;
+  double maxY;
+} AABB_d;
+
+#ifdef LE_THEORA
+typedef struct sAudioQueue 
+{
+  const THEORAPLAY_AudioPacket * pAudio;
+  int offset;
+  struct sAudioQueue * pNext;
+} AudioQueue;
+#endif
+
+struct SourceRect
+{
+  SourceRect * pLeft;
+  SourceRect * pRight;
+  uint32_t id;
+  SDL_Rect srcRect;
+};
+
+typedef struct SNotify
+{
+  bool notifyByEngine;
+  bool notifyByUser;
+} Notify;
+
+#endif
@@ -1,234 +1,234 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
-  date:               11.04.2018
-  updated:            11.04.2018
-*/
-
-#ifndef H_LE_KEYBOARD
-#define H_LE_KEYBOARD
-
-typedef struct sLEKeyboard
-{
-  uint8_t key0;
-  uint8_t key1;
-  uint8_t key2;
-  uint8_t key3;
-  uint8_t key4;
-  uint8_t key5;
-  uint8_t key6;
-  uint8_t key7;
-  uint8_t key8;
-  uint8_t key9;
-  uint8_t keyA;
-  uint8_t keyACBack;
-  uint8_t keyACBookmarks;
-  uint8_t keyACForward;
-  uint8_t keyACHome;
-  uint8_t keyACRefresh;
-  uint8_t keyACSearch;
-  uint8_t keyACStop;
-  uint8_t keyAgain;
-  uint8_t keyAltErase;
-  uint8_t keyApostrophe;
-  uint8_t keyApplication;
-  uint8_t keyAudioMute;
-  uint8_t keyAudioNext;
-  uint8_t keyAudioPlay;
-  uint8_t keyAudioPrev;
-  uint8_t keyAudioStop;
-  uint8_t keyB;
-  uint8_t keyBackslash;
-  uint8_t keyBackspace;
-  uint8_t keyBrightnessDown;
-  uint8_t keyBrightnessUp;
-  uint8_t keyC;
-  uint8_t keyCalculator;
-  uint8_t keyCancel;
-  uint8_t keyCapsLock;
-  uint8_t keyClear;
-  uint8_t keyClearAgain;
-  uint8_t keyComma;
-  uint8_t keyComputer;
-  uint8_t keyCopy;
-  uint8_t keyCrSel;
-  uint8_t keyCurrencySubUnit;
-  uint8_t keyCurrencyUnit;
-  uint8_t keyCut;
-  uint8_t keyD;
-  uint8_t keyDecimalSeparator;
-  uint8_t keyDelete;
-  uint8_t keyDisplaySwitch;
-  uint8_t keyDown;
-  uint8_t keyE; 
-  uint8_t keyEject;
-  uint8_t keyEnd;
-  uint8_t keyEquals;
-  uint8_t keyEscape;
-  uint8_t keyExecute;
-  uint8_t keyExSel;
-  uint8_t keyF;
-  uint8_t keyF1;
-  uint8_t keyF2;
-  uint8_t keyF3;
-  uint8_t keyF4;
-  uint8_t keyF5;
-  uint8_t keyF6;
-  uint8_t keyF7;
-  uint8_t keyF8;
-  uint8_t keyF9;
-  uint8_t keyF10;
-  uint8_t keyF11;
-  uint8_t keyF12;
-  uint8_t keyF13;
-  uint8_t keyF14;
-  uint8_t keyF15;
-  uint8_t keyF16;
-  uint8_t keyF17;
-  uint8_t keyF18;
-  uint8_t keyF19;
-  uint8_t keyF20;
-  uint8_t keyF21;
-  uint8_t keyF22;
-  uint8_t keyF23;
-  uint8_t keyF24;
-  uint8_t keyFind;
-  uint8_t keyG;
-  uint8_t keyBackquote;
-  uint8_t keyH;
-  uint8_t keyHelp;
-  uint8_t keyHome;
-  uint8_t keyI;
-  uint8_t keyInsert;
-  uint8_t keyJ;
-  uint8_t keyK;
-  uint8_t keyKBDillumDown;
-  uint8_t keyKBDillumToggle;
-  uint8_t keyKBDillumUp;
-  uint8_t keyKeypad0;
-  uint8_t keyKeypad00;
-  uint8_t keyKeypad000;
-  uint8_t keyKeypad1;
-  uint8_t keyKeypad2;
-  uint8_t keyKeypad3;
-  uint8_t keyKeypad4; 
-  uint8_t keyKeypad5;
-  uint8_t keyKeypad6;
-  uint8_t keyKeypad7;
-  uint8_t keyKeypad8;
-  uint8_t keyKeypad9;
-  uint8_t keyKeypadA;
-  uint8_t keyKeypadAnd;
-  uint8_t keyKeypadAt;
-  uint8_t keyKeypadB;
-  uint8_t keyKeypadBackspace;
-  uint8_t keyKeypadBinary;
-  uint8_t keyKeypadC;
-  uint8_t keyKeypadClear;
-  uint8_t keyKeypadClearEntry;
-  uint8_t keyKeypadColon;
-  uint8_t keyKeypadComma;
-  uint8_t keyKeypadD;
-  uint8_t keyKeypadDoubleAnd;
-  uint8_t keyKeypadDoubleOr;
-  uint8_t keyKeypadDecimal;
-  uint8_t keyKeypadDivide;
-  uint8_t keyKeypadE;
-  uint8_t keyKeypadEnter;
-  uint8_t keyKeypadEquals;
-  uint8_t keyKeypadEqualsAS400;
-  uint8_t keyKeypadExclamation;
-  uint8_t keyKeypadF;
-  uint8_t keyKeypadGreater;
-  uint8_t keyKeypadHash;
-  uint8_t keyKeypadHexadecimal;
-  uint8_t keyKeypadLeftBrace;
-  uint8_t keyKeypadLeftParen;
-  uint8_t keyKeypadLess;
-  uint8_t keyKeypadMemAdd;
-  uint8_t keyKeypadMemClear;
-  uint8_t keyKeypadMemDivide;
-  uint8_t keyKeypadMemMultiply;
-  uint8_t keyKeypadMemRecall;
-  uint8_t keyKeypadMemStore;
-  uint8_t keyKeypadMemSubtract;
-  uint8_t keyKeypadMinus;
-  uint8_t keyKeypadMultiply;
-  uint8_t keyKeypadOctal;
-  uint8_t keyKeypadPercent;
-  uint8_t keyKeypadPeriod;
-  uint8_t keyKeypadPlus;
-  uint8_t keyKeypadPlusMinus;
-  uint8_t keyKeypadPower;
-  uint8_t keyKeypadRightBrace;
-  uint8_t keyKeypadRightParen;
-  uint8_t keyKeypadSpace;
-  uint8_t keyKeypadTab;
-  uint8_t keyKeypadVerticalBar;
-  uint8_t keyKeypadXOR;
-  uint8_t keyL;
-  uint8_t keyLeftAlt;
-  uint8_t keyLeftCtrl;
-  uint8_t keyLeft;
-  uint8_t keyLeftBracket;
-  uint8_t keyLeftGUI;
-  uint8_t keyLeftShift;
-  uint8_t keyM;
-  uint8_t keyMail;
-  uint8_t keyMediaSelect;
-  uint8_t keyMenu;
-  uint8_t keyMinus;
-  uint8_t keyModeSwitch;
-  uint8_t keyMute;
-  uint8_t keyN;
-  uint8_t keyNumLock;
-  uint8_t keyO;
-  uint8_t keyOper;
-  uint8_t keyOut;
-  uint8_t keyP;
-  uint8_t keyPageDown;
-  uint8_t keyPageUp;
-  uint8_t keyPaste;
-  uint8_t keyPause;
-  uint8_t keyPeriod;
-  uint8_t keyPower;
-  uint8_t keyPrintScreen;
-  uint8_t keyPrior;
-  uint8_t keyQ;
-  uint8_t keyR;
-  uint8_t keyRightAlt;
-  uint8_t keyRightCtrl;
-  uint8_t keyReturn;
-  uint8_t keyReturn2;
-  uint8_t keyRightGUI;
-  uint8_t keyRight;
-  uint8_t keyRightBracket;
-  uint8_t keyRightShift;
-  uint8_t keyS;
-  uint8_t keyScrollLock;
-  uint8_t keySelect;
-  uint8_t keySemicolon;
-  uint8_t keySeparator;
-  uint8_t keySlash;
-  uint8_t keySleep;
-  uint8_t keySpace;
-  uint8_t keyStop;
-  uint8_t keySysReq;
-  uint8_t keyT;
-  uint8_t keyTab;
-  uint8_t keyThousandsSeparator;
-  uint8_t keyU;
-  uint8_t keyUndo;
-  uint8_t keyUp;
-  uint8_t keyV;
-  uint8_t keyVolumeDown;
-  uint8_t keyVolumeUp;
-  uint8_t keyW;
-  uint8_t keyWWW;
-  uint8_t keyX;
-  uint8_t keyY;
-  uint8_t keyZ;
-} LEKeyboard;
-
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
+  date:               11.04.2018
+  updated:            11.04.2018
+*/
+
+#ifndef H_LE_KEYBOARD
+#define H_LE_KEYBOARD
+
+typedef struct sLEKeyboard
+{
+  uint8_t key0;
+  uint8_t key1;
+  uint8_t key2;
+  uint8_t key3;
+  uint8_t key4;
+  uint8_t key5;
+  uint8_t key6;
+  uint8_t key7;
+  uint8_t key8;
+  uint8_t key9;
+  uint8_t keyA;
+  uint8_t keyACBack;
+  uint8_t keyACBookmarks;
+  uint8_t keyACForward;
+  uint8_t keyACHome;
+  uint8_t keyACRefresh;
+  uint8_t keyACSearch;
+  uint8_t keyACStop;
+  uint8_t keyAgain;
+  uint8_t keyAltErase;
+  uint8_t keyApostrophe;
+  uint8_t keyApplication;
+  uint8_t keyAudioMute;
+  uint8_t keyAudioNext;
+  uint8_t keyAudioPlay;
+  uint8_t keyAudioPrev;
+  uint8_t keyAudioStop;
+  uint8_t keyB;
+  uint8_t keyBackslash;
+  uint8_t keyBackspace;
+  uint8_t keyBrightnessDown;
+  uint8_t keyBrightnessUp;
+  uint8_t keyC;
+  uint8_t keyCalculator;
+  uint8_t keyCancel;
+  uint8_t keyCapsLock;
+  uint8_t keyClear;
+  uint8_t keyClearAgain;
+  uint8_t keyComma;
+  uint8_t keyComputer;
+  uint8_t keyCopy;
+  uint8_t keyCrSel;
+  uint8_t keyCurrencySubUnit;
+  uint8_t keyCurrencyUnit;
+  uint8_t keyCut;
+  uint8_t keyD;
+  uint8_t keyDecimalSeparator;
+  uint8_t keyDelete;
+  uint8_t keyDisplaySwitch;
+  uint8_t keyDown;
+  uint8_t keyE; 
+  uint8_t keyEject;
+  uint8_t keyEnd;
+  uint8_t keyEquals;
+  uint8_t keyEscape;
+  uint8_t keyExecute;
+  uint8_t keyExSel;
+  uint8_t keyF;
+  uint8_t keyF1;
+  uint8_t keyF2;
+  uint8_t keyF3;
+  uint8_t keyF4;
+  uint8_t keyF5;
+  uint8_t keyF6;
+  uint8_t keyF7;
+  uint8_t keyF8;
+  uint8_t keyF9;
+  uint8_t keyF10;
+  uint8_t keyF11;
+  uint8_t keyF12;
+  uint8_t keyF13;
+  uint8_t keyF14;
+  uint8_t keyF15;
+  uint8_t keyF16;
+  uint8_t keyF17;
+  uint8_t keyF18;
+  uint8_t keyF19;
+  uint8_t keyF20;
+  uint8_t keyF21;
+  uint8_t keyF22;
+  uint8_t keyF23;
+  uint8_t keyF24;
+  uint8_t keyFind;
+  uint8_t keyG;
+  uint8_t keyBackquote;
+  uint8_t keyH;
+  uint8_t keyHelp;
+  uint8_t keyHome;
+  uint8_t keyI;
+  uint8_t keyInsert;
+  uint8_t keyJ;
+  uint8_t keyK;
+  uint8_t keyKBDillumDown;
+  uint8_t keyKBDillumToggle;
+  uint8_t keyKBDillumUp;
+  uint8_t keyKeypad0;
+  uint8_t keyKeypad00;
+  uint8_t keyKeypad000;
+  uint8_t keyKeypad1;
+  uint8_t keyKeypad2;
+  uint8_t keyKeypad3;
+  uint8_t keyKeypad4; 
+  uint8_t keyKeypad5;
+  uint8_t keyKeypad6;
+  uint8_t keyKeypad7;
+  uint8_t keyKeypad8;
+  uint8_t keyKeypad9;
+  uint8_t keyKeypadA;
+  uint8_t keyKeypadAnd;
+  uint8_t keyKeypadAt;
+  uint8_t keyKeypadB;
+  uint8_t keyKeypadBackspace;
+  uint8_t keyKeypadBinary;
+  uint8_t keyKeypadC;
+  uint8_t keyKeypadClear;
+  uint8_t keyKeypadClearEntry;
+  uint8_t keyKeypadColon;
+  uint8_t keyKeypadComma;
+  uint8_t keyKeypadD;
+  uint8_t keyKeypadDoubleAnd;
+  uint8_t keyKeypadDoubleOr;
+  uint8_t keyKeypadDecimal;
+  uint8_t keyKeypadDivide;
+  uint8_t keyKeypadE;
+  uint8_t keyKeypadEnter;
+  uint8_t keyKeypadEquals;
+  uint8_t keyKeypadEqualsAS400;
+  uint8_t keyKeypadExclamation;
+  uint8_t keyKeypadF;
+  uint8_t keyKeypadGreater;
+  uint8_t keyKeypadHash;
+  uint8_t keyKeypadHexadecimal;
+  uint8_t keyKeypadLeftBrace;
+  uint8_t keyKeypadLeftParen;
+  uint8_t keyKeypadLess;
+  uint8_t keyKeypadMemAdd;
+  uint8_t keyKeypadMemClear;
+  uint8_t keyKeypadMemDivide;
+  uint8_t keyKeypadMemMultiply;
+  uint8_t keyKeypadMemRecall;
+  uint8_t keyKeypadMemStore;
+  uint8_t keyKeypadMemSubtract;
+  uint8_t keyKeypadMinus;
+  uint8_t keyKeypadMultiply;
+  uint8_t keyKeypadOctal;
+  uint8_t keyKeypadPercent;
+  uint8_t keyKeypadPeriod;
+  uint8_t keyKeypadPlus;
+  uint8_t keyKeypadPlusMinus;
+  uint8_t keyKeypadPower;
+  uint8_t keyKeypadRightBrace;
+  uint8_t keyKeypadRightParen;
+  uint8_t keyKeypadSpace;
+  uint8_t keyKeypadTab;
+  uint8_t keyKeypadVerticalBar;
+  uint8_t keyKeypadXOR;
+  uint8_t keyL;
+  uint8_t keyLeftAlt;
+  uint8_t keyLeftCtrl;
+  uint8_t keyLeft;
+  uint8_t keyLeftBracket;
+  uint8_t keyLeftGUI;
+  uint8_t keyLeftShift;
+  uint8_t keyM;
+  uint8_t keyMail;
+  uint8_t keyMediaSelect;
+  uint8_t keyMenu;
+  uint8_t keyMinus;
+  uint8_t keyModeSwitch;
+  uint8_t keyMute;
+  uint8_t keyN;
+  uint8_t keyNumLock;
+  uint8_t keyO;
+  uint8_t keyOper;
+  uint8_t keyOut;
+  uint8_t keyP;
+  uint8_t keyPageDown;
+  uint8_t keyPageUp;
+  uint8_t keyPaste;
+  uint8_t keyPause;
+  uint8_t keyPeriod;
+  uint8_t keyPower;
+  uint8_t keyPrintScreen;
+  uint8_t keyPrior;
+  uint8_t keyQ;
+  uint8_t keyR;
+  uint8_t keyRightAlt;
+  uint8_t keyRightCtrl;
+  uint8_t keyReturn;
+  uint8_t keyReturn2;
+  uint8_t keyRightGUI;
+  uint8_t keyRight;
+  uint8_t keyRightBracket;
+  uint8_t keyRightShift;
+  uint8_t keyS;
+  uint8_t keyScrollLock;
+  uint8_t keySelect;
+  uint8_t keySemicolon;
+  uint8_t keySeparator;
+  uint8_t keySlash;
+  uint8_t keySleep;
+  uint8_t keySpace;
+  uint8_t keyStop;
+  uint8_t keySysReq;
+  uint8_t keyT;
+  uint8_t keyTab;
+  uint8_t keyThousandsSeparator;
+  uint8_t keyU;
+  uint8_t keyUndo;
+  uint8_t keyUp;
+  uint8_t keyV;
+  uint8_t keyVolumeDown;
+  uint8_t keyVolumeUp;
+  uint8_t keyW;
+  uint8_t keyWWW;
+  uint8_t keyX;
+  uint8_t keyY;
+  uint8_t keyZ;
+} LEKeyboard;
+
 #endif
\ No newline at end of file
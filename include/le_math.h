@@ -3,7 +3,7 @@
   e-mail:             pmattulat@outlook.de
   Dev-Tool:           Ubuntu 16.04, g++ Compiler
   date:               09.06.2017
-  updated:            05.11.2017
+  updated:            19.10.2026
 */
 
 #ifndef H_LE_MATH
@@ -16,13 +16,32 @@
 
 #define PI      3.14159
 
+bool mathBoundsIntersection(AABB_d, AABB_d);                    // diese Funktion prueft, ob sich zwei achsenparallele Rechtecke ueberschneiden
+bool mathCircleCollBoxIntersection(Point_d, double, LECollBox_d); // diese Funktion prueft, ob sich ein Kreis und eine (rotierte) Kollisionsbox ueberschneiden
+bool mathCircleIntersection(Point_d, double, Point_d, double);  // diese Funktion prueft, ob sich zwei Kreise ueberschneiden
+bool mathCirclePolygonIntersection(Point_d, double, const Point_d*, uint32_t); // diese Funktion prueft, ob sich ein Kreis und ein konvexes Polygon ueberschneiden
+AABB_d mathCollBoxBounds(LECollBox_d);                          // diese Funktion gibt das achsenparallele Rechteck zurueck, das eine Kollisionsbox umschliesst
 bool mathLineIntersection(Line_d, Line_d);
+void mathLineIntersections(const Line_d*, const Line_d*, bool*, uint32_t); // diese Funktion prueft viele Streckenpaare auf einmal (SSE2 / AVX2, falls vorhanden)
 bool mathRectIntersection(LECollBox_d, LECollBox_d);
+bool mathRectsIntersection(const LECollBox_d*, const LECollBox_d*, uint32_t); // diese Funktion prueft, ob sich mindestens eines von mehreren Rechteckpaaren ueberschneidet oder eines im anderen liegt
 uint32_t mathMax(uint32_t, uint32_t);
 uint32_t mathMin(uint32_t, uint32_t);
 uint32_t mathMin(uint32_t*, uint32_t);
 double mathMod(double, double);
+bool mathPointInCollBox(Point_d, LECollBox_d);                  // diese Funktion prueft, ob ein Punkt innerhalb einer (rotierten) Kollisionsbox liegt
+bool mathPointInPolygon(Point_d, const Point_d*, uint32_t);     // diese Funktion prueft, ob ein Punkt innerhalb eines konvexen Polygons liegt
+bool mathPolygonCollBoxIntersection(const Point_d*, uint32_t, LECollBox_d); // diese Funktion prueft, ob sich ein konvexes Polygon und eine Kollisionsbox ueberschneiden
+bool mathPolygonIntersection(const Point_d*, uint32_t, const Point_d*, uint32_t); // diese Funktion prueft mit Trennachsen (SAT), ob sich zwei konvexe Polygone ueberschneiden
+bool mathPolygonIsConvex(const Point_d*, uint32_t);             // diese Funktion prueft, ob ein Polygon konvex ist
+bool mathRayCircleIntersection(Point_d, Point_d, double, Point_d, double, double*); // diese Funktion prueft, ob ein Strahl einen Kreis trifft und gibt den Abstand zum Eintrittspunkt zurueck
+bool mathRayCollBoxIntersection(Point_d, Point_d, double, LECollBox_d, double*); // diese Funktion prueft, ob ein Strahl eine Kollisionsbox trifft und gibt den Abstand zum Eintrittspunkt zurueck
+bool mathRayPolygonIntersection(Point_d, Point_d, double, const Point_d*, uint32_t, double*); // diese Funktion prueft, ob ein Strahl ein konvexes Polygon trifft und gibt den Abstand zum Eintrittspunkt zurueck
 SDL_Point mathRotatePoint(SDL_Point, SDL_Point, double);        // diese Funktion rotiert einen Punkt um einen Mittelpunkt anhand einer Gradzahl
 Point_d mathRotatePoint(Point_d, Point_d, double);              // diese Funktion rotiert einen Punkt um einen Mittelpunkt anhand einer Gradzahl
+void mathRotatePoints(Point_d*, const Point_d*, uint32_t, double); // diese Funktion rotiert viele Punkte um ihre jeweiligen Mittelpunkte (SSE2 / AVX2, falls vorhanden)
+bool mathSweptBoundsIntersection(AABB_d, Point_d, AABB_d, double*); // diese Funktion berechnet den Zeitpunkt (0.0 - 1.0) des ersten Kontaktes eines bewegten Rechteckes mit einem ruhenden Rechteck
+void mathTransformBoxes(LECollBox_d*, uint32_t, double);        // diese Funktion rotiert viele Kollisionsboxen um ihre Mittelpunkte
+LECollBox_d mathTranslateCollBox(LECollBox_d, Point_d);         // diese Funktion verschiebt eine Kollisionsbox
 
 #endif
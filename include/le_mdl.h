@@ -3,7 +3,7 @@
   e-mail:             pmattulat@outlook.de
   Dev-Tool:           Ubuntu 16.04, g++ Compiler
   date:               29.05.2017
-  updated:            11.04.2018
+  updated:            19.10.2026
 */
 
 #ifndef H_LE_MODEL
@@ -44,8 +44,15 @@ typedef struct sClone
 typedef struct sCollisionRect
 {
   uint32_t id;
-  SDL_Rect collRect;
+  uint8_t shape;                                                                    // LE_COLL_SHAPE_RECT, LE_COLL_SHAPE_CIRCLE oder LE_COLL_SHAPE_POLYGON
+  SDL_Rect collRect;                                                                // bei Kreisen und Polygonen das umschliessende Rechteck
   LECollBox_d collRectBuffer;
+  Point_d circleCenter;                                                             // Mittelpunkt eines Kreises relativ zur Modelposition
+  Point_d circleCenterBuffer;                                                       // Mittelpunkt eines Kreises in Bildschirmkoordinaten
+  double radius;
+  Point_d vertices[LE_COLL_POLYGON_MAX];                                            // Ecken eines konvexen Polygons relativ zur Modelposition
+  Point_d verticesBuffer[LE_COLL_POLYGON_MAX];                                      // Ecken eines konvexen Polygons in Bildschirmkoordinaten
+  uint32_t amountVertices;
   sCollisionRect * pLeft;
   sCollisionRect * pRight;
 } CollisionRect;
@@ -66,7 +73,9 @@ class LEMdl
 
     uint32_t amountSourceRect(Texture*);                                            // diese Funktion gibt die Anzahl an Texturbereichen einer Textur zurueck
     Clone * cloneGet(uint32_t);                                                     // diese Funktion liefert eine Referenz auf einen Clone des Models
+    CollisionRect * collisionRectCreate(uint32_t);                                  // diese Funktion legt einen neuen Kollisionsbereich an und haengt ihn an die Liste
     CollisionRect * collisionRectGet(uint32_t);                                     // diese Funktion gibt eine Referenz auf einen Kollisionsbereich zurueck
+    void fillCollisionBox(CollisionRect*);                                          // diese Funktion setzt einen Kollisionsbereich ohne Rotation
     LinkedVec2 * directionGet(uint32_t);                                            // diese Funktion gibt eine Referenz auf eine Bewegungsrichtung zurueck
     void memoryClearClones();                                                       // diese Funktion loescht alle Clones vom Model
     void memoryClearCollisionRects();                                               // diese Funktion loescht alle Kollisionsbereiche
@@ -76,6 +85,8 @@ class LEMdl
     SourceRect * sourceRectGet(Texture*, uint32_t);                                 // diese Funktion gibt eine Referenz auf ein Source Rect zurueck
     Texture * textureGet(uint32_t);                                                 // diese Funktion gibt eine Referenz auf eine Textur zurueck
     void updateCollisionBox(CollisionRect*);                                        // diese Funktion aktualisiert einen Kollisionsbereich
+    void updateCollisionBoxes();                                                    // diese Funktion aktualisiert alle Kollisionsbereiche blockweise
+    void updateCollisionShape(CollisionRect*);                                      // diese Funktion aktualisiert Kreis oder Polygon eines Kollisionsbereiches
     void updateFrameBox();                                                          // diese Funktion aktualisiert den groben Kollisionsbereich
 
   public:
@@ -85,6 +96,8 @@ class LEMdl
     LEMdl();
     ~LEMdl();
 
+    int mdlAddCollisionCircle(uint32_t, int, int, int);                             // diese Funktion fuegt einen kreisfoermigen Kollisionsbereich hinzu (Mittelpunkt relativ zum Model, Radius)
+    int mdlAddCollisionPolygon(uint32_t, const SDL_Point*, uint32_t);               // diese Funktion fuegt einen Kollisionsbereich als konvexes Polygon mit bis zu LE_COLL_POLYGON_MAX Ecken hinzu
     int mdlAddCollisionRect(uint32_t, SDL_Rect);                                    // diese Funktion fuegt einen Kollisionsbereich hinzu
     int mdlAddDirection(uint32_t, glm::vec2);                                       // diese Funktion fuegt eine Bewegungsrichtung hinzu
     int mdlAddTextureSourceRect(uint32_t, uint32_t, int, int, int, int);            // diese Funktion fuegt einen Texturbereich hinzu
@@ -101,6 +114,7 @@ class LEMdl
     int mdlFocusTextureSourceRect(uint32_t, uint32_t);                              // diese Funktion setzt den Fokus auf einen bestimmten Texturbereich, sodass nur dieser gezeichnet wird
     uint32_t mdlGetAmountOfCollisionBoxes();                                        // diese Funktion gibt die Anzahl an Kollisionsbereichen zurueck
     uint32_t mdlGetAmountOfTextureSourceRectangles(uint32_t);                       // diese Funktion gibt die Anzahl an Texturbereichen einer Textur zurueck
+    Clone * mdlGetClone(uint32_t);                                                  // diese Funktion gibt eine Referenz auf einen Clone zurueck, die Kollisionsabfragen lesen daraus Position und Sichtbarkeit
     LECollBox_d mdlGetCollisionBox(uint32_t);                                       // diese Funktion gibt einen bestimmten Kollisionsbereich zurueck
     double mdlGetCurrentDegree();                                                   // diese Funktion gibt den aktuellen Rotationsgrad zurueck
     glm::vec2 mdlGetDirection(uint32_t);                                            // diese Funktion gibt eine Bewegungsrichtung zurueck
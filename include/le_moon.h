@@ -1,498 +1,1049 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
-  date:               18.05.2017
-  updated:            18.04.2018
-
-  NOTES:              (TS) = thread safe
-*/
-
-#ifndef H_LE_MOON
-#define H_LE_MOON
-
-#define SDL_MAIN_HANDLED
-#include "SDL_mixer.h"
-#include "SDL_ttf.h"
-//#include "theoraplay.h"
-#include "le_mdl.h"
-#include "le_mutex.h"
-#include "le_keyboard.h"
-
-typedef struct sLEMoonModel
-{
-  sLEMoonModel * pLeft;
-  sLEMoonModel * pRight;
-  uint32_t id;
-  uint32_t zindex;                                                                            // zindex, niedriger zindex wird zuerst gemalt 
-  bool visible;
-  LEMdl * pModel;
-} LEModel;
-
-typedef struct sLETimeEvent
-{
-  sLETimeEvent * pLeft;
-  sLETimeEvent * pRight;
-  uint32_t id;
-  uint32_t timestamp;
-  bool reached;
-} LETimeEvent;
-
-typedef struct sLEMouse
-{
-  int mouseX;
-  int mouseY;
-  uint8_t leftButton;
-  uint8_t rightButton;
-} LEMouse;
-
-typedef struct sLEPoint
-{
-  uint32_t id;
-  SDL_Point point;
-  double posX;
-  double posY;
-  SDL_Point pointBuffer;
-  Color color;
-  double currentAlpha;
-  double currentDegree;
-  bool visible;
-  uint32_t zindex;
-  LinkedVec2 * pDirectionHead;
-  sLEPoint * pLeft;
-  sLEPoint * pRight;
-} LEPoint;
-
-typedef struct sLESound
-{
-  uint32_t id;
-  Mix_Chunk * pSample;
-  bool lock;
-  sLESound * pLeft;
-  sLESound *pRight;
-} LESound;
-
-typedef struct sLELetter
-{
-  uint8_t letter;
-  sLELetter * pLeft;
-  sLELetter * pRight;
-} LELetter;
-
-typedef struct sLEFont
-{
-  uint32_t id;
-  bool markedAsDelete;
-  TTF_Font * pFont;
-  sLEFont * pLeft;
-  sLEFont * pRight;
-} LEFont;
-
-typedef struct sLEText
-{
-  uint32_t id;
-  LELetter * pCurrentCursorPosition;
-  LELetter * pLetterHead;
-  unsigned char * pText;																																			                                   // der Fliesstext, um ihn auszugeben
-  uint32_t length;
-  uint32_t zindex;
-  bool visible;
-  Color color;
-  LEFont * pFont;
-  SDL_Texture * pTexture;
-  SDL_Rect posSize;
-  double alpha;
-  LinkedVec2 * pDirectionHead;                                                                // Liste mit Richtungsvektoren
-  glm::vec2 position;                                                                         // genauere Position fuer Bewegungsberechnungen
-  sLEText * pLeft;
-  sLEText * pRight;
-} LEText;
-
-typedef struct sLEFPS
-{
-  uint16_t framesPerSecond;                                                                   // hier werden die FPS gezaehlt
-  uint32_t countToTime;                                                                       // der Zeitpunkt, bis zu dem gezaehlt werden soll
-  uint16_t lastFPS;                                                                           // die FPS der letzten Sekunde
-  bool recentFPS;                                                                             // sagt aus, ob es neue FPS der letzten Sekunde gibt
-} FPS;
-
-typedef struct sLELine
-{
-  uint32_t id;
-  Line line;
-  uint32_t zindex;
-  Color color;
-  bool visible;
-  sLELine * pLeft;
-  sLELine * pRight;
-} LELine;
-
-typedef struct sLEMemory
-{
-  LEModel * pLastModel;
-  LESound * pLastSound;
-  LETimeEvent * pLastTimeEvent;
-  LEPoint * pLastPoint;
-  LEFont * pLastFont;
-  LEText * pLastText;
-  LELine * pLastLine;
-} LEMemory;
-
-typedef struct sLEVideo
-{
-  uint32_t id;
-  char * pFile;
-  sLEVideo * pLeft;
-  sLEVideo * pRight;
-} LEVideo;
-
-typedef struct sLEWindow
-{
-  bool focusGained;
-} LEWindow;
-
-typedef class LEMoon
-{
-  private:
-
-    //////////////////////////////
-    // threading
-    //////////////////////////////
-
-    LEMutexFont mtxFont;
-    LEMutexGeneral mtxGeneral;
-
-    //////////////////////////////
-    // memory
-    //////////////////////////////
-
-    void memoryClearFonts();                                                                  // diese Funktion loescht alle Fonts im Destruktor der Engine
-    void memoryClearLines();                                                                  // diese Funktion loescht alle Linien im Destruktor der Engine
-    void memoryClearModels();                                                                 // diese Funktion loescht alle Models im Destruktor der Engine
-    void memoryClearPoints();                                                                 // diese Funktion loescht alle Punkte im Destruktor der Engine
-    void memoryClearSounds();                                                                 // diese Funktion loescht alle Sounds im Destruktor der Engine
-    void memoryClearTexts();                                                                  // diese Funktion loescht alle Texturen im Destruktor der Engine
-    void memoryClearTimeEvents();                                                             // diese Funktion loescht alle Zeitereignisse im Destruktor der Engine
-
-    // -----------------------------------------------------------------------------------------------------------------------------------------
-
-    //////////////////////////////
-    // font
-    //////////////////////////////
-
-    Notify notifyFont;                                                                        // sagt aus, ob Listen sich veraendert haben, und die Engine das merkt, oder der Nutzer die Listen veraendern moechte
-    LEFont * pFontHead;                                                                       // Liste mit Fonts
-    LEFont * pFontHeadBuffer;                                                                 // Liste mit Fonts zum hinzufuegen (threadfaehig)
-
-    void fontCleanList();                                                                     // diese Funktion loescht alle zum loeschen markierte Elemente der Original Liste
-    void fontCleanBufferList();                                                               // diese Funktion loescht alle zum loeschen markierte Elemente aus der Bufferliste
-    void fontConstructor();                                                                   // diese Funktion wird im LEMoon constructor aufgerufen
-    void fontDeleteBufferList();                                                              // diese Funktion loescht die Bufferliste 
-    LEFont * fontGet(uint32_t);																																                               // (TS) diese Funktion gibt eine Referenz auf einen Font aus der Original Liste zurueck
-    LEFont * fontGetFromBuffer(uint32_t);                                                     // diese Funktion gibt eine Referenz auf einen Font aus der Buffer Liste zurueck
-    int fontMerge();                                                                          // diese Funktion fuegt alle Fonts zusammen aus beiden Listen und loescht die Buffer Liste, ACHTUNG: diese Funktion wird nie aufgerufen, wenn font Funktionen noch in Threads laufen!!!
-    void fontMergeLists();                                                                    // diese Funktion fuegt die Original- und die Buffer Liste zusammen
-
-    //////////////////////////////
-    // general
-    //////////////////////////////
-
-    bool initialized;
-    SDL_Window * pWindow;
-    SDL_DisplayMode displayMode;
-    SDL_Event event;
-    SDL_Renderer * pRenderer;
-    uint32_t timestamp;
-    double timestep;
-    LEKeyboard keyboard;                                                                      // keyboard 0 = inactive, 1 = pressed, 2 = released
-    LEMouse mouse;                                                                            // mouse 0 = inactive, 1 = pressed, 2 = released
-    Color backgroundColor;                                                                    // Hintergrundfarbe
-    FPS fps;                                                                                  // frames per second
-    LEMemory memory;                                                                          // hier werden Zeiger fuer alle grossen Arten gespeichert, sodass die Suche durch Listen performanter wird
-    char * prefPath;                                                                          // der Pfad wo Dateien geschrieben werden koennen
-
-    void clearKeyboard();                                                                     // diese Funktion setzt alle Tasten auf 0
-    void clearMouse();                                                                        // diese Funktion setzt alle Maustasten auf 0
-    int drawWithZindex();                                                                     // diese Funktion zeichnet Objekte (Models / Texte) anhand ihres Zindex
-    void freeKey(uint8_t&);                                                                   // diese Funktion setzt eine Keyboard Taste zurueck
-    void freeKeyboardKeys();                                                                  // diese Funktion setzt alle Keys auf inactive, die vorher auf released standen
-    void freeMouse();                                                                         // diese Funktion setzt alle Maus Events wieder zurueck
-    void handleKeyboard();                                                                    // diese Funktion haelt alle keyboard events fest
-    void handleMouse();                                                                       // diese Funktion haelt alle Mouse events fest
-    int merge();                                                                              // diese Funktion fuegt die Bufferlisten und die Originallisten zusammen und loescht zum loeschen markierte Elemente
-    void printErrorDialog(int, const char*);                                                  // diese Funktion gibt einen Fehler in einem Dialogfenster aus
-
-    //////////////////////////////
-    // line
-    //////////////////////////////
-
-    LELine * pLineHead;                                                                       // Liste mit Linien
-
-    int lineDraw(LELine*);                                                                    // diese Funktion malt eine Linie
-    LELine * lineGet(uint32_t);                                                               // diese Funktion gibt eine Referenz auf eine Linie zurueck
-
-    //////////////////////////////
-    // model
-    //////////////////////////////
-
-    LEModel * pModelHead;
-
-    bool modelCheckCollision(LEModel*, LEModel*);                                             // diese Funktion prueft anhand von Kollisionsbereichen zweier Models, ob sie kollidieren
-    bool modelCheckFrameBoxCollision(LEModel*, LEModel*);                                     // diese Funktion prueft, ob zwei Models im groben Kollisionsbereich kollidieren
-    int modelDraw(LEModel*);                                                                  // diese Funktion zeichnet ein Model
-    LEModel * modelGet(uint32_t);                                                             // diese Funktion gibt eine Modelreferenz anhand einer eindeutigen ID zurueck
-    uint32_t modelGetAmount();                                                                // diese Funktion gibt die Anzahl aller Modelle zurueck
-
-    //////////////////////////////
-    // point
-    //////////////////////////////
-
-    LEPoint * pPointHead;                                                                     // Liste mit Punkten
-
-    int pointDraw(LEPoint*);                                                                  // diese Funktion malt einen Punkt
-    LEPoint * pointGet(uint32_t);                                                             // diese Funktion gibt eine Referenz auf einen Punkt zurueck
-    LinkedVec2 * pointGetDirection(LEPoint*, uint32_t);                                       // diese Funktion gibt eine Referenz auf eine Bewegungsrichtung zurueck
-
-    //////////////////////////////
-    // sound
-    //////////////////////////////
-
-    LESound * pSoundHead;                                                                     // Liste mit Sounds
-
-    LESound * soundGet(uint32_t);                                                             // diese Funktion gibt eine Referenz auf einen Sound zurueck
-
-    //////////////////////////////
-    // text
-    //////////////////////////////
-
-    LEText * pTextHead;                                                                       // Liste mit Texten
-
-    int textDraw(LEText*);                                                                    // diese Funktion zeichnet einen Text
-    LEText * textGet(uint32_t);                                                               // diese Funktion gibt eine Referenz auf einen Text zurueck
-    uint32_t textGetAmount();                                                                 // diese Funktion gibt die Anzahl aller Texte zurueck
-    LinkedVec2 * textGetDirection(LEText*, uint32_t);                                         // diese Funktion gibt die Referenz auf eine Bewegungsrichtung zurueck
-
-    //////////////////////////////
-    // time event
-    //////////////////////////////
-
-    LETimeEvent * pTimeEventHead;
-
-    LETimeEvent * timeEventGet(uint32_t);                                                     // diese Funktion gibt eine Referenz auf ein Zeitereignis zurueck
-
-    //////////////////////////////
-    // video
-    //////////////////////////////
-
-    LEVideo * pVideoHead;                                                                     // Liste mit Videos
-
-    LEVideo * videoGet(uint32_t);                                                             // diese Funktion liefert eine Referenz auf ein Video zurueck
-
-    //////////////////////////////
-    // window
-    //////////////////////////////
-
-    LEWindow window;                                                                          // diese Struktur speichert verschiedene Zustaende des Fenster
-
-    void handleWindow();                                                                      // diese Funktion behandelt das Fenster
-
-  public:
-
-    LEMoon();
-    ~LEMoon();
-
-    //////////////////////////////
-    // font
-    //////////////////////////////
-
-    int fontCreateTTF(uint32_t, const char*, int);                                            // (TS) diese Funktion fuegt einen Font hinzu
-    int fontDelete(uint32_t);                                                                 // (TS) diese Funktion loescht einen Font
-    void fontPrintBufferList();                                                               // (TS) diese Funktion gibt die komplette Font Buffer Liste aus
-    void fontPrintList();                                                                     // (TS) diese Funktion gibt die komplette Original Font Liste aus
-    int fontSetStyle(uint32_t, int);                                                          // (TS) diese Funktion setzt den Stil des Fonts, TTF_STYLE_BOLD, TTF_STYLE_ITALIC, TTF_STYLE_UNDERLINE, TTF_STYLE_STRIKETHROUGH
-    void fontUsingThread(bool);                                                               // (TS) mit dieser Funktion kann der Nutzer festlegen, ob er Font Funktionen in einem Thread benutzen moechte (LE_TRUE) oder diesen Vorgang beendet hat (LE_FALSE)
-
-    //////////////////////////////
-    // general
-    //////////////////////////////
-
-    void beginFrame();                                                                        // diese Funktion sollte am Anfang eines Frames in einem main loop erfolgen
-    double convertResHeight(double, double);                                                  // diese Funktion gibt die relative Y-Pixelgroesse eines Wertes anhand einer Ausgangsbildschirmaufloesung zurueck
-    double convertResWidth(double, double);                                                   // diese Funktion gibt die relative X-Pixelgroesse eines Wertes anhand einer Ausgangsbildschirmaufloesung zurueck
-    void delay(uint32_t);                                                                     // diese Funktion verzoegert die Anwendung um die angegebene Anzahl an Millisekunden
-    int drawFrame();                                                                          // diese Funktion zeichnet ein Frame, sie sollte nach lemoonBeginFrame() und vor lemoonEndFrame() aufgerufen werden
-    int endFrame();                                                                           // diese Funktion sollte am Ende eines Frames aufgerufen werden
-    bool engineInitialized();                                                                 // diese Funktion gibt ein flag zurueck, das aussagt, ob die Engine gestartet wurde
-    Color getBackgroundColor();                                                               // diese Funktion gibt die Hintergrundfarbe zurueck
-    uint16_t getFPS();                                                                        // diese Funktion gibt die Anzahl an Frames der letzten Sekunde zurueck
-    char * getPrefPath();                                                                     // diese Funktion gibt den externen Pref Pfad zurueck
-    int getScreenHeight();                                                                    // diese Funktion gibt die Hoehe der Bildschirmaufloesung zurueck
-    int getScreenWidth();                                                                     // diese Funktion gibt die Breite der Bildschirmaufloesung zurueck
-    uint32_t getTimestamp();                                                                  // diese Funktion gibt den aktuellen Zeitstempel zurueck
-    double getTimestep();                                                                     // diese Funktion gibt die Dauer des letzten Frames zurueck
-    int init(const char*);                                                                    // diese Funktion initialisiert die Engine
-    int initImage();                                                                          // diese Funktion initialisiert den Bilderteil der Engine
-    int initSound(int);                                                                       // diese Funktion initialisiert den Soundteil der Engine
-    int initTTF();                                                                            // diese Funktion initialisiert den TTF - Teil der Engine
-    bool keyEvent(uint32_t, SDL_Keycode);                                                     // diese Funktion prueft, ob ein SDL_Keycode (https://wiki.libsdl.org/SDL_Keycode) gedrueckt oder losgelassen wird
-    void messageBox(const char*, const char*);                                                // diese Funktion ruft eine Dialogbox auf mit einem gewaehlten Titel und einem gewaehlten Text
-    #ifdef LE_LINUX
-    void mkpath(const char*, mode_t);                                                         // diese Funktion erstellt einen Pfad unter Linux
-    #endif
-    bool mouseEvent(uint32_t, uint8_t);                                                       // diese Funktion prueft, ob ein Mousebutton gedrueckt oder losgelassen wurde
-    SDL_Point mouseGetPosition();                                                             // diese Funktion gibt die Mausposition zurueck
-    double percentToPixelX(double);                                                           // diese Funktion wandelt eine Prozentangabe in eine Pixelgroesse in X Dimension um
-    double percentToPixelY(double);                                                           // diese Funktion wandelt eine Prozentangabe in eine Pixelgroesse in Y Dimension um
-    double pixelToPercentX(double);                                                           // diese Funktion wandelt eine Pixelangabe in eine Prozentangabe in X Dimension um
-    double pixelToPercentY(double);                                                           // diese Funktion wandelt eine Pixelangabe in eine Prozentangabe in Y Dimension um
-    int pollEvent();                                                                          // diese Funktion prueft auf events
-    void printErrorMessage(const char*, const char*);                                         // diese Funktion ermoeglicht dem Programmierer eine Fehlermeldung in einem Fenster auszugeben
-    bool recentFPSAvailable();                                                                // diese Funktion sagt aus, ob aktuelle FPS verfuegbar sind, diese Funktion gibt nur einmal pro Sekunde LE_TRUE zurueck
-    void setBackgroundColor(uint8_t, uint8_t, uint8_t);                                       // diese Funktion setzt die Hintergrundfarbe der Anwendung
-    int showCursor(bool);                                                                     // diese Funktion versteckt den Cursor (LE_FALSE) oder zeigt ihn (LE_TRUE)
-
-    //////////////////////////////
-    // line
-    //////////////////////////////
-
-    int lineCreate(uint32_t);                                                                 // diese Funktion erstellt eine Linie
-    int lineDelete(uint32_t);                                                                 // diese Funktion loescht eine Linie
-    int lineSet(uint32_t, int, int, int, int);                                                // diese Funktion setzt die Linie
-    int lineSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                           // diese Funktion setzt die Farbe einer Linie
-    int lineSetVisible(uint32_t, bool);                                                       // diese Funktion setzt eine Linie auf sichtbar oder unsichtbar
-    int lineSetZindex(uint32_t, uint32_t);                                                    // diese Funktion setzt den Zindex fuer eine Linie, 0 nicht erlaubt
-
-    //////////////////////////////
-    // model
-    //////////////////////////////
-
-    int modelAddCollisionRect(uint32_t, uint32_t, SDL_Rect);                                  // diese Funktion fuegt eine Kollisionsbereich in Form eines Rechteckes hinzu
-    int modelAddDirection(uint32_t, uint32_t, glm::vec2);                                     // diese Funktion legt eine Bewegungsrichtung fuer ein Model an
-    int modelAddTextureSourceRect(uint32_t, uint32_t, uint32_t, int, int, int, int);          // diese Funktion fuegt einen Texturbereich hinzu aus welchem ausschliesslich gezeichnet werden soll
-    int modelChangeDirection(uint32_t, uint32_t, glm::vec2);                                  // diese Funktion aendert eine Bewegungsrichtung
-    bool modelCheckCollision(uint32_t, uint32_t);                                             // diese Funktion prueft, ob zwei Models miteinander kollidieren
-    bool modelCheckFrameBoxCollision(uint32_t, uint32_t);                                     // diese Funktion prueft, ob die groben Kollisionsbereiche von zwei Models miteinander kollidieren
-    int modelClearClones(uint32_t);                                                           // diese Funktion loescht alle Clones des Models
-    int modelCreate(uint32_t);                                                                // diese Funktion erzeugt ein Model mit Hilfe einer eindeutigen ID
-    int modelCreateClone(uint32_t, uint32_t);                                                 // diese Funktion erstellt einen Clone fuer ein Model
-    int modelCreateSurface(uint32_t, uint32_t, const char*);                                  // diese Funktion erstellt ein Surface aus einem Bild, um mit den Pixeldaten direkt arbeiten zu koennen
-    int modelCreateTexture(uint32_t, uint32_t, const char*);                                  // diese Funktion erzeugt eine Textur, alle Texturen sollten die selbe Groesse haben, wegen des groben Kollisionsbereiches!
-    int modelDelete(uint32_t);                                                                // diese Funktion loescht ein Model wieder
-    int modelDeleteSurface(uint32_t, uint32_t);                                               // diese Funktion loescht das Surface einer Textur wieder
-    int modelFadeTexture(uint32_t, uint32_t, double);                                         // diese Funktion blendet eine Textur ein oder aus
-    int modelFocusTextureSourceRect(uint32_t, uint32_t, uint32_t);                            // diese Funktion setzt den Fokus auf einen Texturbereich, sodass nur dieser gezeichnet werden soll
-    uint32_t modelGetAmountOfCollisionBoxes(uint32_t);                                        // diese Funktion gibt die Anzahl an Kollisionsbereichen zurueck
-    uint32_t modelGetAmountOfTextureSourceRectangles(uint32_t, uint32_t);                     // diese Funktion gibt die Anzahl an Texturbereichen einer Textur zurueck
-    LECollBox_d modelGetCollisionBox(uint32_t, uint32_t);                                     // diese Funktion gibt einen bestimmten Kollisionsbereich zurueck
-    glm::vec2 modelGetDirection(uint32_t, uint32_t);                                          // diese Funktion gibt eine Bewegungsrichtung zurueck
-    LECollBox_d modelGetFrameBox(uint32_t);                                                   // diese Funktion gibt den groben Kollisionsbereich eines Models zurueck
-    Color modelGetPixelRGBA(uint32_t, uint32_t, uint32_t, uint32_t);                          // diese Funktion gibt einen Pixel einer Textur zurueck, modelCreateSurface() muss vorher aufgerufen worden sein
-    glm::vec2 modelGetPositionD(uint32_t);                                                    // diese Funktion gibt die genauen Positionswerte des Models zurueck
-    SDL_Point modelGetPosition(uint32_t);                                                     // diese Funktion gibt die Position eines Models zurueck
-    SDL_Point modelGetSize(uint32_t);                                                         // diese Funktion gibt die Groesse eines Models zurueck
-    double modelGetSizeFactor(uint32_t);                                                      // diese Funktion gibt den Faktor der Modelgroesse zurueck
-    SDL_Surface * modelGetSurface(uint32_t, uint32_t);                                        // diese Funktion gibt einen Zeiger auf ein erstelltes Surface zurueck
-    double modelGetTextureAlpha(uint32_t, uint32_t);                                          // diese Funktion gibt den Alphawert einer Textur zurueck
-    bool modelGetVisible(uint32_t);                                                           // diese Funktion gibt visible zurueck
-    uint32_t modelGetZindex(uint32_t);                                                        // diese Funktion gibt den Z-index des Models zurueck
-    int modelMoveDirection(uint32_t, uint32_t);                                               // diese Funktion bewegt ein Model in eine vorher angelegte Richtung
-    int modelRotate(uint32_t, double);                                                        // diese Funktion rotiert ein Model um die angegebene Gradzahl pro Sekunde
-    int modelRotateDir(uint32_t, uint32_t, double);                                           // diese Funktion rotiert eine Bewegungsrichtung um eine angegebene Gradzahl pro Sekunde
-    int modelRotateOnce(uint32_t, double);                                                    // diese Funktion rotiert ein Model einmalig
-    int modelSetClonePosition(uint32_t, uint32_t, glm::vec2);                                 // diese Funktion setzt die Position eines Model Clones
-    int modelSetCloneVisible(uint32_t, uint32_t, bool);                                       // diese Funktion macht einen Clone eines Models sichtbar oder unsichtbar
-    int modelSetPosition(uint32_t, double, double);                                           // diese Funktion setzt die Position eines Models in NDC
-    int modelSetSize(uint32_t, int, int);                                                     // diese Funktion legt die Groesse des Models fest
-    double modelSetSize(uint32_t, double);                                                    // diese Funktion legt die Groesse des Models in Prozent fest und gibt den Vergroesserungsfaktor zurueck, der dabei entsteht
-    int modelSetSizeFactor(uint32_t, double);                                                 // diese Funktion setzt den Faktor der Modelgroesse
-    int modelSetTextureActive(uint32_t, uint32_t, bool);                                      // diese Funktion left fest, ob eine Textur sichtbar ist, oder nicht
-    int modelSetTextureAlpha(uint32_t, uint32_t, uint8_t);                                    // diese Funktion setzt einen Alphawert fuer eine Textur
-    int modelSetTextureZindex(uint32_t, uint32_t, uint32_t);                                  // diese Funktion setzt den zindex einer Textur innerhalb eines Models
-    int modelSetVisible(uint32_t, bool);                                                      // diese Funktion setzt ein Model auf sichtbar oder unsichtbar
-    int modelSetZindex(uint32_t, uint32_t);                                                   // diese Funktion setzt den zindex eines Models, 0 nicht erlaubt
-    bool modelTextureExists(uint32_t, uint32_t);                                              // diese Funktion prueft, ob eine Modeltextur ID existiert
-
-    //////////////////////////////
-    // point
-    //////////////////////////////
-
-    int pointAddDirection(uint32_t, uint32_t, glm::vec2);                                     // diese Funktion fuegt eine Bewegungsrichtung hinzu
-    int pointCreate(uint32_t);                                                                // diese Funktion fuegt einen Punkt hinzu
-    int pointDelete(uint32_t);                                                                // diese Funktion loescht einen Punkt
-    int pointFade(uint32_t, double);                                                          // diese Funktion blendet einen Punkt ein oder aus
-    Color pointGetColor(uint32_t);                                                            // diese Funktion gibt die Farbe eines Punktes zurueck
-    SDL_Point pointGetPosition(uint32_t);                                                     // diese Funktion gibt die Position eines Punktes zurueck
-    int pointMoveDirection(uint32_t, uint32_t);                                               // diese Funktion bewegt einen Punkt in eine zuvor erstelle Bewegungsrichtung
-    int pointRotate(uint32_t, double, SDL_Point);                                             // diese Funktion laesst einen Punkt um einen bestimmten Punkt rotieren
-    int pointSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                          // diese Funktion legt die Farbe eines Punktes fest
-    int pointSetPosition(uint32_t, int, int);                                                 // diese Funktion setzt die Position eines Punktes
-    int pointSetVisible(uint32_t, bool);                                                      // diese Funktion macht einen Punkt sichtbar oder unsichtbar
-    int pointSetZindex(uint32_t, uint32_t);                                                   // diese Funktion setzt den Z-index eines Punktes
-
-    //////////////////////////////
-    // sound
-    //////////////////////////////
-
-    int soundCreate(uint32_t);                                                                // diese Funktion fuegt einen Sound hinzu
-    int soundDelete(uint32_t);                                                                // diese Funktion loescht einen Sound
-    int soundFadeIn(uint32_t, int);                                                           // diese Funktion blendet einen Kanal oder alle Kanaele ein
-    void soundFadeOut(int);                                                                   // diese Funktion blendet einen Kanal oder alle Kanaele aus
-    int soundLoadWAV(uint32_t, const char*);                                                  // diese Funktion laedt eine WAV Datei fuer einen erstellten Sound
-    int soundLock(uint32_t, bool);                                                            // diese Funktion sperrt einen Sound, sodass er hier nach nicht wieder gespielt wird, bis er entsperrt ist
-    void soundPause();                                                                        // diese Funktion pausiert einen Sound
-    int soundPlay(uint32_t, int);                                                             // diese Funktion spielt einen Sound ab
-    void soundSetVolume(uint8_t);                                                             // diese Funktion setzt die Lautstaerke
-
-    //////////////////////////////
-    // text
-    //////////////////////////////
-
-    int textAddDirection(uint32_t, uint32_t, glm::vec2);                                      // diese Funktion fuegt einem Text eine Bewegungsrichtung hinzu
-    int textAddLetter(uint32_t, uint8_t);                                                     // diese Funktion fuegt einen Buchstaben an das Ende hinzu
-    int textAddString(uint32_t, const char*);                                                 // diese Funktion fuegt einen kompletten String dem Text hinzu
-    int textClear(uint32_t);                                                                  // diese Funktion loescht den kompletten Text
-    int textCreate(uint32_t);                                                                 // diese Funktion fuegt einen UTF8 Text hinzu
-    int textDelete(uint32_t);                                                                 // diese Funktion loescht einen Text
-    int textFade(uint32_t, double);                                                           // diese Funktion blendet einen Text ein oder aus
-    double textGetAlpha(uint32_t);                                                            // diese Funktion gibt den Alpha Wert eines Textes zurueck
-    SDL_Point textGetPosition(uint32_t);                                                      // diese Funktion gibt die Position des Textes zurueck
-    SDL_Point textGetSize(uint32_t);                                                          // diese Funktion gibt die Dimensionen des Textes zurueck
-    bool textGetVisible(uint32_t);                                                            // diese Funktion prueft, ob ein Text sichtbar ist
-    int textMoveDirection(uint32_t, uint32_t);                                                // diese Funktion bewegt eine Text in eine zuvor erstellte Bewegungsrichtung
-    int textPrepareForDrawing(uint32_t);                                                      // diese Funktion bereitet einen Text auf das Zeichnen vor, ein Text kann anschliessend gezeichnet werden
-    int textRelateFont(uint32_t, uint32_t);                                                   // diese Funktion ordnet dem Text einen Font zu, muss vor textPrepareForDrawing() aufgerufen werden
-    int textSetAlpha(uint32_t, uint8_t);                                                      // diese Funktion setzt den Alphawert eines Textes, muss nach textPrepareForDrawing() aufgerufen werden!
-    int textSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                           // diese Funktion setzt die Farbe eines Textes, muss vor textPrepareForDrawing() aufgerufen werden
-    int textSetPosition(uint32_t, int, int);                                                  // diese Funktion setzt die Position eines Textes
-    int textSetVisible(uint32_t, bool);                                                       // diese Funktion sagt aus, ob ein Text sichtbar ist, oder nicht
-    int textSetZindex(uint32_t, uint32_t);                                                    // diese Funktion setzt den z-index fuer einen Text, 0 nicht erlaubt
-    int textSubmit(uint32_t);                                                                 // diese Funktion erstellt aus allen Buchstaben einen Text
-
-    //////////////////////////////
-    // time event
-    //////////////////////////////
-
-    int timeEventCreate(uint32_t, uint32_t);                                                  // diese Funktion erstellt ein Zeitereignis
-    int timeEventDelete(uint32_t);                                                            // diese Funktion loescht ein Zeitereignis
-    uint32_t timeEventGetStamp(uint32_t);                                                     // diese Funktion gibt den Zeitstempel fuer das Zeitereignis zurueck
-    bool timeEventReached(uint32_t);                                                          // diese Funktion prueft, ob ein Zeitereignis bereits erreicht wurde
-    int timeEventReset(uint32_t, uint32_t);                                                   // diese Funktion setzt den Wert eines Zeitereignisses neu
-    int timeEventUpdate(uint32_t, uint32_t);                                                  // diese Funktion verlaengert ein Zeitereignis um eine Anzahl von Millisekunden
-    void timeEventUpdateValidALL(uint32_t);                                                   // diese Funktion verlaengert alle noch nicht erreichten Zeitereignisse um eine Anzahl von Millisekunden
-
-    //////////////////////////////
-    // video
-    //////////////////////////////
-
-    int videoCreate(uint32_t, const char*);                                                   // diese Funktion erstellt ein Video
-    int videoDelete(uint32_t);                                                                // diese Funktion loescht ein Video
-    bool videoPlay(uint32_t);                                                                 // diese Funktion legt fest, ob ein Video gespielt wird oder nicht
-
-    //////////////////////////////
-    // window
-    //////////////////////////////
-
-    bool windowFocused();                                                                     // diese Funktion prueft, ob das Fenster gerade im Focus ist, oder nicht
-} *LEMoonInstance;
-
-#endif
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
+  date:               18.05.2017
+  updated:            19.10.2026
+
+  NOTES:              (TS) = thread safe
+*/
+
+#ifndef H_LE_MOON
+#define H_LE_MOON
+
+#define SDL_MAIN_HANDLED
+#include "SDL_mixer.h"
+#include "SDL_ttf.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <atomic>
+#include <memory>
+//#include "theoraplay.h"
+#include "le_mdl.h"
+#include "le_mutex.h"
+#include "le_keyboard.h"
+#include "le_worker.h"
+
+struct sLEMoonModel;
+
+typedef struct sLECollisionProxy
+{
+  sLEMoonModel * pModel;                                                                      // das Model, zu dem dieser Eintrag im Kollisionsgitter gehoert
+  Clone * pClone;                                                                             // der Clone des Models oder nullptr fuer das Model selbst
+  uint32_t idClone;                                                                           // ID des Clones oder LE_CLONE_NONE
+  AABB_d bounds;                                                                              // achsenparallele Huelle des groben Kollisionsbereiches
+  int cellMinX;                                                                               // belegte Zellen im Kollisionsgitter
+  int cellMinY;
+  int cellMaxX;
+  int cellMaxY;
+  uint32_t layer;                                                                             // Kollisionsebenen, in deren Gitter der Eintrag einsortiert ist
+  bool inGrid;                                                                                // sagt aus, ob der Eintrag im Kollisionsgitter einsortiert ist
+  bool dirty;                                                                                 // sagt aus, ob der Eintrag vor der naechsten Abfrage neu einsortiert werden muss
+  bool pairSource;                                                                            // sagt aus, ob das Model bei der Paarsuche selbst abgefragt wird
+  uint32_t queryStamp;                                                                        // verhindert doppelte Treffer, wenn ein Eintrag mehrere Zellen belegt
+} LECollisionProxy;
+
+typedef struct sLECollisionGrid
+{
+  int cellSize;                                                                               // Kantenlaenge einer Zelle in Pixel
+  unordered_map<uint64_t, vector<LECollisionProxy*>> cells[LE_COLL_LAYERS];                   // belegte Zellen je Kollisionsebene, Schluessel aus Zellkoordinaten
+  vector<LECollisionProxy*> dirtyProxies;                                                     // Eintraege, die sich seit der letzten Abfrage veraendert haben
+  uint32_t queryStamp;
+  int minCellX;                                                                               // Zellen, die je belegt wurden, waechst nur und wird beim Leeren des Gitters zurueckgesetzt, minCellX > maxCellX = leer
+  int minCellY;
+  int maxCellX;
+  int maxCellY;
+} LECollisionGrid;
+
+typedef struct sLECollisionProxyPair
+{
+  LECollisionProxy * pProxy;
+  LECollisionProxy * pForeignProxy;
+} LECollisionProxyPair;
+
+typedef struct sLECollisionPair
+{
+  uint32_t idModel;
+  uint32_t idClone;                                                                           // ID des Clones oder LE_CLONE_NONE fuer das Model selbst
+  uint32_t idForeignModel;
+  uint32_t idForeignClone;
+} LECollisionPair;
+
+typedef struct sLECollisionHit
+{
+  sLEMoonModel * pModel;
+  double distance;                                                                            // Abstand zum Ursprung einer Abfrage
+} LECollisionHit;
+
+typedef struct sLEContact
+{
+  uint32_t idModel;
+  uint32_t idForeignModel;
+  uint8_t state;                                                                              // LE_CONTACT_BEGIN, LE_CONTACT_STAY oder LE_CONTACT_END
+} LEContact;
+
+typedef struct sLEContactPair
+{
+  sLEMoonModel * pModel;                                                                      // Model mit der kleineren ID
+  sLEMoonModel * pForeignModel;
+  uint32_t checkFrame;                                                                        // Frame, in dem das Paar zuletzt geprueft wurde
+  bool isNew;                                                                                 // sagt aus, ob das Paar in diesem Frame zum ersten Mal beruehrt
+} LEContactPair;
+
+typedef struct sLEContactCache
+{
+  bool enabled;
+  uint32_t frame;                                                                             // Nummer der aktuellen Auswertung
+  unordered_map<uint64_t, LEContactPair> pairs;                                               // alle sich beruehrenden Paare, Schluessel aus beiden IDs
+  vector<sLEMoonModel*> changedModels;                                                        // Models, die sich seit der letzten Auswertung veraendert haben
+  vector<LEContact> contacts;                                                                 // Ereignisse der letzten Auswertung
+  vector<LEContact> pendingContacts;                                                          // Ereignisse geloeschter Models fuer die naechste Auswertung
+} LEContactCache;
+
+typedef struct sLEMoonModel
+{
+  sLEMoonModel * pLeft;
+  sLEMoonModel * pRight;
+  uint32_t id;
+  uint32_t zindex;                                                                            // zindex, niedriger zindex wird zuerst gemalt 
+  bool visible;
+  LEMdl * pModel;
+  LECollisionProxy proxy;                                                                     // Eintrag im Kollisionsgitter
+  unordered_map<uint32_t, LECollisionProxy> cloneProxies;                                     // Eintraege der Clones im Kollisionsgitter, die Kollisionsbereiche werden vom Model geteilt
+  uint32_t collisionLayer;                                                                    // Bitmaske der Kollisionsebenen, auf denen das Model liegt
+  uint32_t collisionMask;                                                                     // Bitmaske der Kollisionsebenen, mit denen das Model kollidieren kann
+  uint32_t contactFrame;                                                                      // Auswertung, in der das Model zuletzt als veraendert vorgemerkt wurde
+} LEModel;
+
+typedef struct sLETimeEvent
+{
+  sLETimeEvent * pLeft;
+  sLETimeEvent * pRight;
+  uint32_t id;
+  uint32_t timestamp;
+  bool reached;
+} LETimeEvent;
+
+typedef struct sLEMouse
+{
+  int mouseX;
+  int mouseY;
+  uint8_t leftButton;
+  uint8_t rightButton;
+} LEMouse;
+
+typedef struct sLEPoint
+{
+  uint32_t id;
+  SDL_Point point;
+  double posX;
+  double posY;
+  SDL_Point pointBuffer;
+  Color color;
+  double currentAlpha;
+  double currentDegree;
+  bool visible;
+  uint32_t zindex;
+  LinkedVec2 * pDirectionHead;
+  sLEPoint * pLeft;
+  sLEPoint * pRight;
+} LEPoint;
+
+typedef struct sLESoundPending
+{
+  bool active;                                                                                // ein Abspielwunsch, waehrend der Sound noch dekodiert wird
+  int loops;
+  int ms;
+  bool positional;
+  uint32_t idModel;
+} LESoundPending;
+
+typedef struct sLESound
+{
+  uint32_t id;
+  Mix_Chunk * pSample;                                                                        // bei Sounds aus der Soundbank nur solange dekodiert im Speicher, wie das Budget reicht
+  bool lock;
+  shared_ptr<vector<uint8_t>> pCompressed;                                                    // komprimierte Datei aus der Soundbank, bleibt resident, wird mit dem Dekodierauftrag geteilt
+  uint32_t decodeRequest;                                                                     // laufender Lade- oder Dekodierauftrag, 0 = keiner
+  bool pinned;                                                                                // angeheftete Sounds werden nie aus dem Speicher verdraengt
+  uint64_t lastUse;                                                                           // Zeitpunkt der letzten Benutzung fuer die LRU Verdraengung, von soundBank.clock
+  uint8_t bus;                                                                                // LE_SOUND_BUS_SFX, LE_SOUND_BUS_UI oder LE_SOUND_BUS_DIALOG, standardmaessig LE_SOUND_BUS_SFX
+  LESoundPending pending;
+  uint8_t priority;                                                                           // wichtigere Sounds duerfen Kanaele unwichtigerer Sounds uebernehmen, wenn alle belegt sind
+  uint8_t maxInstances;                                                                       // so oft darf der Sound gleichzeitig laufen, 0 = unbegrenzt, darueber wird die aelteste Instanz neu gestartet
+  uint32_t retriggerInterval;                                                                 // Mindestabstand zwischen zwei Starts in Millisekunden
+  uint32_t lastStart;                                                                         // Zeitpunkt des letzten Starts
+  uint32_t lastFrame;                                                                         // Frame des letzten Starts, weitere Anforderungen im selben Frame werden zusammengefasst
+  sLESound * pLeft;
+  sLESound *pRight;
+} LESound;
+
+typedef struct sLESoundCommand
+{
+  uint8_t type;                                                                               // LE_SOUND_CMD_PLAY, LE_SOUND_CMD_FADE_IN, LE_SOUND_CMD_FADE_OUT, LE_SOUND_CMD_HALT, LE_SOUND_CMD_VOLUME, LE_SOUND_CMD_FREE, LE_SOUND_CMD_POSITION, ...
+  Mix_Chunk * pSample;
+  int channel;                                                                                // -1 = alle Kanaele
+  int loops;                                                                                  // Wiederholungen oder Winkel fuer Mix_SetPosition()
+  int value;                                                                                  // Millisekunden der Blende, Lautstaerke oder Entfernung fuer Mix_SetPosition()
+} LESoundCommand;
+
+typedef struct sLESoundQueue
+{
+  LESoundCommand commands[LE_SOUND_COMMANDS];                                                 // Ringpuffer, nur der Spielthread schreibt, gelesen wird im Audiothread, ohne Mix_HookMusic() im Spielthread
+  atomic<uint32_t> read;                                                                      // wird nur vom Leser erhoeht
+  atomic<uint32_t> write;                                                                     // wird nur vom Spielthread erhoeht
+  bool drained;                                                                               // sagt aus, ob der Audiothread die Befehle abarbeitet (Mix_HookMusic() ist registriert), sonst laufen sie sofort
+  bool stalled;                                                                               // der Ringpuffer blieb zuletzt trotz Warten voll, bis der Audiothread wieder liest, wird nicht mehr gewartet
+} LESoundQueue;
+
+typedef struct sLEVoice
+{
+  LESound * pSound;                                                                           // nullptr = Kanal frei
+  uint8_t priority;
+  uint32_t start;
+  uint32_t end;                                                                               // aus der Laenge des Samples berechnet, endlose Wiederholungen enden nie
+  bool positional;                                                                            // sagt aus, ob die Stimme einem Model folgt
+  uint32_t idModel;
+  bool culled;                                                                                // ausserhalb des Hoerradius, endlose Stimmen sind pausiert
+  int angle;                                                                                  // zuletzt an Mix_SetPosition() uebergeben, -1 = noch nie
+  int distance;
+} LEVoice;
+
+typedef struct sLESoundJob
+{
+  uint32_t idSound;
+  uint32_t request;                                                                           // verwirft das Ergebnis, wenn der Sound inzwischen geloescht wurde
+  shared_ptr<vector<uint8_t>> pData;                                                          // komprimierte Bytes aus der Soundbank oder
+  string file;                                                                                // eine WAV Datei, die im Hintergrund geladen wird
+  Mix_Chunk * pSample;                                                                        // Ergebnis, nullptr = Fehler
+} LESoundJob;
+
+typedef struct sLESoundBank
+{
+  size_t budget;                                                                              // so viele Bytes duerfen dekodierte Sounds aus der Soundbank belegen, standardmaessig 64 MB
+  size_t used;
+  uint64_t clock;                                                                             // wird bei jeder Benutzung erhoeht
+  uint32_t requests;
+  uint32_t pending;                                                                           // Anzahl laufender Lade- und Dekodierauftraege
+} LESoundBank;
+
+typedef struct sLESoundBus
+{
+  atomic<float> gain;                                                                         // vom Spielthread gesetzt, der Audiothread liest die Werte einmal je Puffer
+  atomic<float> cutoff;                                                                       // Grenzfrequenz des Tiefpasses in Hz, 0 = aus
+  atomic<int> duckBy;                                                                         // solange auf diesem Bus etwas laeuft, wird dieser Bus leiser, -1 = nie
+  atomic<float> duckGain;
+  float gainFrom;                                                                             // ab hier nur Audiothread: Verstaerkung am Anfang und Ende des aktuellen Puffers, dazwischen wird interpoliert
+  float gainTo;
+  float duck;                                                                                 // geglaetteter Faktor der Absenkung
+  float coefficientFrom;                                                                      // Koeffizienten des Tiefpasses am Anfang und Ende des aktuellen Puffers, 1 = aus
+  float coefficientTo;
+  float state[2];                                                                             // Tiefpass der Musik, die Kanaele haben eigene Zustaende
+  bool active;                                                                                // im letzten Puffer lief etwas auf dem Bus
+  bool activeNow;
+} LESoundBus;
+
+typedef struct sLESoundChannelMix
+{
+  uint8_t bus;
+  float state[2];                                                                             // Zustand des Tiefpasses je Stereokanal, wird beim Start zurueckgesetzt
+} LESoundChannelMix;
+
+typedef struct sLESoundMixer
+{
+  LESoundBus buses[LE_SOUND_BUSES];
+  vector<LESoundChannelMix> channels;                                                         // ein Eintrag je Mixer Kanal, nur im Audiothread
+  atomic<float> limit;                                                                        // Schwelle des Limiters auf der Summe, 1 = aus
+  float limiterGain;                                                                          // nur Audiothread
+  float headroomFrom;                                                                         // mit aktivem Limiter werden die Busse mit Reserve gemischt, damit SDL_mixer beim Summieren nicht kappt, nur Audiothread
+  float headroomTo;
+  int frequency;                                                                              // aus Mix_QuerySpec(), die Effekte arbeiten nur mit AUDIO_S16SYS in Stereo
+  bool supported;
+} LESoundMixer;
+
+typedef struct sLESoundListener
+{
+  glm::vec2 position;                                                                         // in Pixel
+  float radius;                                                                               // Hoerradius in Pixel, dahinter werden Stimmen nicht mehr gemischt, standardmaessig 1000
+} LESoundListener;
+
+typedef struct sLESoundEmitters
+{
+  vector<int> channels;                                                                       // Kanaele der Stimmen, die einem Model folgen, wird jeden Frame neu gesammelt
+  vector<float> x;                                                                            // Abstand zum Zuhoerer, getrennte Felder, damit die Entfernungen in einer Schleife ohne Abhaengigkeiten berechnet werden
+  vector<float> y;
+  vector<float> distance;
+} LESoundEmitters;
+
+typedef struct sLEMusic
+{
+  uint32_t id;
+  SDL_RWops * pSource;                                                                        // offene Datei oder Packdatei, wird beim Abspielen stueckweise gelesen
+  int64_t dataStart;                                                                          // Beginn der Samples in der Quelle
+  uint32_t dataSize;                                                                          // Laenge der Samples in Bytes
+  uint32_t dataRead;                                                                          // bereits gelesene Bytes der Samples
+  uint32_t blockAlign;                                                                        // Bytes je Sampleframe der Datei, es werden nur ganze Frames gelesen
+  SDL_AudioStream * pStream;                                                                  // wandelt Format, Kanaele und Frequenz der Datei in die des Geraets
+  SDL_AudioFormat format;
+  uint32_t bytesPerSecond;                                                                    // im Format des Geraets, fuer die Laenge der Blenden
+  uint8_t * pBuffer;                                                                          // Ringpuffer mit gewandelten Samples, der Hauptthread fuellt ihn, der Audiothread leert ihn
+  atomic<uint32_t> readPosition;                                                              // wird nur vom Audiothread erhoeht
+  atomic<uint32_t> writePosition;                                                             // wird nur vom Hauptthread erhoeht
+  int loops;                                                                                  // verbleibende Wiederholungen, -1 = endlos
+  bool sourceDone;                                                                            // die Quelle ist komplett gelesen und der Wandler geleert
+  atomic<bool> ended;                                                                         // alle Samples liegen im Ringpuffer, danach ist Schluss
+  atomic<bool> finished;                                                                      // setzt der Audiothread, wenn der Ringpuffer nach dem Ende leer oder eine Ausblende fertig ist
+  bool playing;                                                                               // sagt aus, ob die Musik in der Liste des Audiothreads steht
+  int volume;                                                                                 // 0 - MIX_MAX_VOLUME
+  int fadeFrom;                                                                               // Blende von 0 - MIX_MAX_VOLUME, wird mit volume verrechnet
+  int fadeTo;
+  uint32_t fadeLength;                                                                        // Laenge der Blende in Bytes, 0 = keine Blende
+  uint32_t fadePosition;
+  bool stopAfterFade;                                                                         // nach dem Ausblenden ist die Musik beendet
+  sLEMusic * pLeft;
+  sLEMusic * pRight;
+} LEMusic;
+
+typedef struct sLEGlyph
+{
+  SDL_Rect srcRect;                                                                           // Bereich des Glyphen im Atlas, w = 0 bei Glyphen ohne Pixel
+  int advance;                                                                                // Vorschub in Pixel bis zum naechsten Glyphen
+  int offsetX;                                                                                // Versatz zur Stiftposition, nur bei Bitmapschriften ungleich 0
+  int offsetY;
+  uint8_t page;                                                                               // Seite der Bitmapschrift, bei TTF Fonts immer 0
+} LEGlyph;
+
+typedef struct sLEGlyphAtlas
+{
+  bool enabled;                                                                               // sagt aus, ob Texte dieses Fonts aus dem Atlas gezeichnet werden
+  bool invalid;                                                                               // sagt aus, ob alle Glyphen vor der naechsten Benutzung neu gerastert werden muessen (z.B. nach fontSetStyle())
+  uint32_t generation;                                                                        // wird bei jedem Leeren erhoeht, Texte mit aelterer Nummer bauen ihre Glyphen neu auf
+  SDL_Surface * pSurface;                                                                     // Kopie der Pixel, damit der Atlas beim Vergroessern uebertragen werden kann
+  SDL_Texture * pTexture;
+  int penX;                                                                                   // naechste freie Position in der aktuellen Zeile
+  int penY;
+  int rowHeight;                                                                              // Hoehe der aktuellen Zeile
+  unordered_map<uint16_t, LEGlyph> glyphs;                                                    // bereits gerasterte Glyphen
+} LEGlyphAtlas;
+
+typedef struct sLEBitmapFont
+{
+  bool enabled;                                                                               // sagt aus, ob der Font eine Bitmapschrift (BMFont) ist, die Glyphen liegen dann fertig im Atlas
+  vector<SDL_Texture*> pages;                                                                 // Seiten mit allen Glyphen
+  unordered_map<uint32_t, int> kerning;                                                       // Unterschneidung je Glyphenpaar aus dem Descriptor
+} LEBitmapFont;
+
+typedef struct sLEFontFace
+{
+  string path;
+  unsigned char * pData;                                                                      // komplette Fontdatei, wird von allen Groessen und Stilen geteilt
+  size_t size;
+  uint32_t refCount;                                                                          // Anzahl der Fonthandles, die diese Datei benutzen
+} LEFontFace;
+
+typedef struct sLEFontHandle
+{
+  string key;                                                                                 // Schluessel aus Pfad, Groesse, Stil und Umriss
+  TTF_Font * pFont;
+  LEFontFace * pFace;
+  int size;
+  int outline;                                                                                // Breite des Umrisses, TTF_SetFontOutline() veraendert den ganzen TTF_Font, daher ein eigenes Handle
+  int style;
+  uint32_t refCount;                                                                          // Anzahl der Fonts, die dieses Handle benutzen
+  unordered_map<uint16_t, int> advances;                                                      // Vorschub je Glyph, wird ohne Rastern ermittelt
+  unordered_map<uint32_t, int> kerning;                                                       // Unterschneidung je Glyphenpaar, Schluessel aus beiden Zeichen
+  mutex mtxRender;                                                                            // SDL_ttf darf einen TTF_Font nicht in mehreren Threads gleichzeitig benutzen
+} LEFontHandle;
+
+typedef struct sLEFont
+{
+  uint32_t id;
+  bool markedAsDelete;
+  TTF_Font * pFont;
+  LEFontHandle * pHandle;                                                                     // geteiltes Handle aus dem Fontcache, pFont zeigt auf dessen TTF_Font
+  int height;                                                                                 // Hoehe einer Zeile in Pixel
+  int lineSkip;                                                                               // Abstand zwischen zwei Zeilen in Pixel
+  LEBitmapFont bitmap;
+  LEGlyphAtlas atlas;                                                                         // Glyphenatlas, wird erst beim ersten Zeichnen angelegt
+  uint32_t revision;                                                                          // wird bei jeder Aenderung erhoeht, nach der zugeordnete Texte neu gerastert werden muessen
+  sLEFont * pLeft;
+  sLEFont * pRight;
+} LEFont;
+
+typedef struct sLEGlyphQuad
+{
+  SDL_Rect srcRect;                                                                           // Bereich im Glyphenatlas
+  SDL_Rect dstRect;                                                                           // Bereich relativ zur Textposition
+  uint8_t page;                                                                               // Seite der Bitmapschrift
+} LEGlyphQuad;
+
+typedef struct sLETextLine
+{
+  uint32_t start;                                                                             // erstes Byte der Zeile
+  uint32_t length;                                                                            // Laenge in Bytes, ohne Zeilenumbruch und Leerzeichen am Umbruch
+  int width;                                                                                  // gemessene Breite in Pixel
+  int right;                                                                                  // rechter Rand der Glyphen, relativ zum Zeilenanfang
+  bool built;                                                                                 // sagt aus, ob die Glyphen der Zeile aus dem Atlas aufgebaut sind
+  vector<LEGlyphQuad> quads;                                                                  // Kopierbereiche aller Glyphen der Zeile, relativ zum Zeilenanfang
+} LETextLine;
+
+typedef struct sLETextLayout
+{
+  int maxWidth;                                                                               // maximale Zeilenbreite in Pixel, 0 = nur bei '\n' umbrechen
+  uint8_t align;                                                                              // LE_ALIGN_LEFT, LE_ALIGN_CENTER oder LE_ALIGN_RIGHT
+  int lineSpacing;                                                                            // zusaetzlicher Abstand zwischen zwei Zeilen in Pixel
+  bool dirty;                                                                                 // sagt aus, ob die Zeilen neu berechnet werden muessen (Inhalt, Breite oder Font veraendert)
+  uint32_t fontRevision;                                                                      // Stand des Fonts bei der letzten Berechnung
+  int width;                                                                                  // Breite der laengsten Zeile
+  bool edited;                                                                                // sagt aus, ob sich seit der letzten Berechnung nur der Bereich editStart bis editEnd veraendert hat
+  uint32_t editStart;                                                                         // veraenderter Bereich in Bytes, alles dahinter ist um editDelta verschoben, aber unveraendert
+  uint32_t editEnd;
+  int editDelta;
+  vector<LETextLine> lines;
+} LETextLayout;
+
+typedef struct sLETextEffect
+{
+  int outline;                                                                                // Breite des Umrisses in Pixel, 0 = kein Umriss
+  SDL_Color outlineColor;
+  SDL_Point shadowOffset;                                                                     // Versatz des Schattens in Pixel, 0, 0 = kein Schatten
+  SDL_Color shadowColor;
+} LETextEffect;
+
+typedef struct sLETextJob
+{
+  uint32_t idText;
+  uint32_t request;                                                                           // Nummer der Anforderung, aeltere Ergebnisse werden verworfen
+  LEFontHandle * pHandle;                                                                     // wird festgehalten, bis das Ergebnis hochgeladen oder verworfen wurde
+  string text;                                                                                // Kopie des Textes, der Text selbst darf sich waehrenddessen aendern
+  vector<LETextLine> lines;
+  vector<SDL_Point> linePositions;                                                            // Position jeder Zeile in der gemeinsamen Surface
+  int width;                                                                                  // Groesse der gemeinsamen Surface mehrzeiliger Texte
+  int height;
+  bool singleLine;                                                                            // sagt aus, ob der Text am Stueck gerastert wird
+  SDL_Color color;
+  LEFontHandle * pOutlineHandle;                                                              // Handle fuer den Umriss oder nullptr, wird wie pHandle festgehalten
+  LETextEffect effect;
+  SDL_Surface * pSurface;                                                                     // Ergebnis
+  SDL_Rect fillRect;                                                                          // Lage der Fuellung in der Surface, Umriss und Schatten liegen darum herum
+} LETextJob;
+
+typedef struct sLEText
+{
+  uint32_t id;
+  unsigned char * pText;																																			                                   // der Fliesstext, um ihn auszugeben
+  uint32_t length;                                                                            // Laenge des Textes in Bytes, ohne Nullterminierung
+  uint32_t capacity;                                                                          // Groesse des Textbuffers in Bytes, waechst nur
+  uint32_t cursor;                                                                            // Einfuegeposition in Bytes, neue Buchstaben werden hier eingefuegt
+  uint32_t anchor;                                                                            // anderes Ende der Auswahl, anchor = cursor bedeutet keine Auswahl
+  bool dirty;                                                                                 // sagt aus, ob Inhalt, Font oder Farbe seit dem letzten Rastern veraendert wurden
+  uint32_t fontRevision;                                                                      // Stand des Fonts beim letzten Rastern
+  LETextLayout layout;                                                                        // Zeilenumbruch und Ausrichtung, wird nur aus Glyphenmetriken berechnet
+  uint32_t renderRequest;                                                                     // wird bei jedem Rastern erhoeht, damit veraltete Ergebnisse aus dem Hintergrund verworfen werden
+  uint32_t zindex;
+  bool visible;
+  Color color;
+  LEFont * pFont;
+  LEFontHandle * pOutlineHandle;                                                              // Handle mit Umriss passend zu Datei, Groesse und Stil des Fonts, nullptr ohne Umriss
+  SDL_Texture * pTexture;
+  SDL_Rect textureRect;                                                                       // benutzter Bereich der Textur, Texturen aus dem Pool sind meist groesser als der Text
+  SDL_Point textureOffset;                                                                    // Versatz der Textur zur Textposition durch Umriss und Schatten
+  SDL_Rect posSize;
+  double alpha;
+  LETextEffect effect;                                                                        // Umriss und Schatten, werden zusammen mit der Fuellung in eine Textur gerastert
+  LinkedVec2 * pDirectionHead;                                                                // Liste mit Richtungsvektoren
+  glm::vec2 position;                                                                         // genauere Position fuer Bewegungsberechnungen
+  bool useAtlas;                                                                              // sagt aus, ob der Text aus dem Glyphenatlas seines Fonts gezeichnet wird
+  uint32_t atlasGeneration;                                                                   // Stand des Atlas, fuer den die Zeilen aufgebaut wurden
+  sLEText * pLeft;
+  sLEText * pRight;
+} LEText;
+
+typedef struct sLEFPS
+{
+  uint16_t framesPerSecond;                                                                   // hier werden die FPS gezaehlt
+  uint32_t countToTime;                                                                       // der Zeitpunkt, bis zu dem gezaehlt werden soll
+  uint16_t lastFPS;                                                                           // die FPS der letzten Sekunde
+  bool recentFPS;                                                                             // sagt aus, ob es neue FPS der letzten Sekunde gibt
+} FPS;
+
+typedef struct sLEStats
+{
+  uint32_t textRasterizations;                                                                // Anzahl neu gerasterter bzw. neu aus dem Glyphenatlas aufgebauter Texte
+} LEStats;
+
+typedef struct sLELine
+{
+  uint32_t id;
+  Line line;
+  uint32_t zindex;
+  Color color;
+  bool visible;
+  sLELine * pLeft;
+  sLELine * pRight;
+} LELine;
+
+typedef struct sLEMemory
+{
+  LEModel * pLastModel;
+  LEMusic * pLastMusic;
+  LESound * pLastSound;
+  LETimeEvent * pLastTimeEvent;
+  LEPoint * pLastPoint;
+  LEFont * pLastFont;
+  LEText * pLastText;
+  LELine * pLastLine;
+} LEMemory;
+
+typedef struct sLEVideo
+{
+  uint32_t id;
+  char * pFile;
+  sLEVideo * pLeft;
+  sLEVideo * pRight;
+} LEVideo;
+
+typedef struct sLEWindow
+{
+  bool focusGained;
+} LEWindow;
+
+typedef class LEMoon
+{
+  private:
+
+    //////////////////////////////
+    // threading
+    //////////////////////////////
+
+    LEMutexFont mtxFont;
+    LEMutexText mtxText;
+    LEMutexMusic mtxMusic;
+    LEMutexSound mtxSound;
+    LEMutexGeneral mtxGeneral;
+    LEWorker worker;                                                                          // Arbeitsthreads, z.B. fuer die Kollisionspruefung
+
+    //////////////////////////////
+    // memory
+    //////////////////////////////
+
+    void memoryClearFonts();                                                                  // diese Funktion loescht alle Fonts im Destruktor der Engine
+    void memoryClearLines();                                                                  // diese Funktion loescht alle Linien im Destruktor der Engine
+    void memoryClearModels();                                                                 // diese Funktion loescht alle Models im Destruktor der Engine
+    void memoryClearMusic();                                                                  // diese Funktion loescht alle Musikstuecke im Destruktor der Engine
+    void memoryClearPoints();                                                                 // diese Funktion loescht alle Punkte im Destruktor der Engine
+    void memoryClearSounds();                                                                 // diese Funktion loescht alle Sounds im Destruktor der Engine
+    void memoryClearTexts();                                                                  // diese Funktion loescht alle Texturen im Destruktor der Engine
+    void memoryClearTimeEvents();                                                             // diese Funktion loescht alle Zeitereignisse im Destruktor der Engine
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------
+
+    //////////////////////////////
+    // collision
+    //////////////////////////////
+
+    LECollisionGrid collisionGrid;                                                            // gleichmaessiges Gitter, um Kollisionskandidaten schnell zu finden
+
+    void collisionClearClones(LEModel*);                                                      // diese Funktion entfernt alle Clones eines Models aus dem Kollisionsgitter
+    void collisionConstructor();                                                              // diese Funktion wird im LEMoon constructor aufgerufen
+    void collisionFindPairs(const vector<LECollisionProxy*>&, bool, vector<LECollisionProxyPair>&); // diese Funktion sucht alle Kollisionen der angegebenen Eintraege (mit oder ohne Clones als Partner) verteilt auf die Arbeitsthreads, die Reihenfolge ist unabhaengig von der Anzahl der Threads
+    AABB_d collisionGetBounds(LECollisionProxy*);                                             // diese Funktion berechnet die achsenparallele Huelle eines Eintrages
+    Point_d collisionGetOffset(LECollisionProxy*);                                            // diese Funktion gibt den Abstand eines Clones zu seinem Model zurueck, fuer das Model selbst (0 | 0)
+    void collisionGridInsert(LECollisionProxy*);                                              // diese Funktion sortiert einen Eintrag in alle Zellen ein, die er ueberdeckt
+    void collisionGridRemove(LECollisionProxy*);                                              // diese Funktion entfernt einen Eintrag aus allen Zellen
+    void collisionGridUpdate();                                                               // diese Funktion sortiert alle veraenderten Eintraege neu ein, wird vor jeder Abfrage aufgerufen
+    bool collisionLayersMatch(LEModel*, LEModel*);                                            // diese Funktion prueft anhand der Kollisionsebenen und -masken, ob zwei Models ueberhaupt kollidieren koennen
+    void collisionMarkDirty(LECollisionProxy*);                                               // diese Funktion merkt einen Eintrag zum neu einsortieren vor
+    void collisionQuery(AABB_d, uint32_t, vector<LECollisionProxy*>&);                        // diese Funktion sammelt alle Eintraege der angegebenen Kollisionsebenen, deren Zellen ein Rechteck beruehren
+    void collisionQueryCell(int, int, uint32_t, vector<LECollisionProxy*>&);                  // diese Funktion sammelt alle noch nicht gefundenen Eintraege einer Zelle
+    void collisionQueryRay(Point_d, Point_d, double, uint32_t, vector<LECollisionHit>&);      // diese Funktion laeuft einen Strahl Zelle fuer Zelle ab und sammelt die naechsten Treffer sortiert nach Abstand
+    void collisionQueryShared(AABB_d, uint32_t, vector<LECollisionProxy*>&);                  // diese Funktion arbeitet wie collisionQuery(), veraendert aber nichts und darf aus mehreren Threads gleichzeitig aufgerufen werden, das Gitter muss aktuell sein
+
+    //////////////////////////////
+    // contact
+    //////////////////////////////
+
+    LEContactCache contactCache;                                                              // Paare, die sich beruehren, und die Ereignisse des letzten Frames
+
+    void contactConstructor();                                                                // diese Funktion wird im LEMoon constructor aufgerufen
+    void contactMarkChanged(LEModel*);                                                        // diese Funktion merkt ein Model fuer die naechste Auswertung vor
+    void contactRemoveModel(LEModel*);                                                        // diese Funktion entfernt alle Paare eines Models und merkt deren Ende vor
+    void contactUpdate();                                                                     // diese Funktion prueft veraenderte Models und erzeugt die Ereignisse, wird in endFrame() aufgerufen
+
+    //////////////////////////////
+    // font
+    //////////////////////////////
+
+    Notify notifyFont;                                                                        // sagt aus, ob Listen sich veraendert haben, und die Engine das merkt, oder der Nutzer die Listen veraendern moechte
+    LEFont * pFontHead;                                                                       // Liste mit Fonts
+    LEFont * pFontHeadBuffer;                                                                 // Liste mit Fonts zum hinzufuegen (threadfaehig)
+    unordered_map<string, LEFontFace*> fontFaces;                                             // geladene Fontdateien, Schluessel ist der Pfad
+    unordered_map<string, LEFontHandle*> fontHandles;                                         // geoeffnete Fonts, Schluessel aus Pfad, Groesse und Stil
+
+    LEFontHandle * fontAcquireHandle(const char*, int, int, int);                             // (TS) diese Funktion gibt ein geteiltes Handle fuer Pfad, Groesse, Stil und Umriss zurueck, die Datei wird nur einmal gelesen
+    LEFont * fontAddToBuffer(uint32_t);                                                       // diese Funktion haengt einen neuen Font an die Buffer Liste, bufferList muss gesperrt sein
+
+    void fontCleanList();                                                                     // diese Funktion loescht alle zum loeschen markierte Elemente der Original Liste
+    void fontCleanBufferList();                                                               // diese Funktion loescht alle zum loeschen markierte Elemente aus der Bufferliste
+    void fontConstructor();                                                                   // diese Funktion wird im LEMoon constructor aufgerufen
+    void fontDeleteBufferList();                                                              // diese Funktion loescht die Bufferliste 
+    void fontDestroyAtlas(LEFont*);                                                           // diese Funktion gibt Textur und Pixel des Glyphenatlas frei und leert ihn
+    LEFont * fontGet(uint32_t);																																                               // (TS) diese Funktion gibt eine Referenz auf einen Font aus der Original Liste zurueck
+    int fontGetAdvance(LEFont*, uint16_t);                                                    // diese Funktion gibt den zwischengespeicherten Vorschub eines Glyphen zurueck, ohne ihn zu rastern
+    LEFont * fontGetFromBuffer(uint32_t);                                                     // diese Funktion gibt eine Referenz auf einen Font aus der Buffer Liste zurueck
+    LEGlyph * fontGetGlyph(LEFont*, uint16_t);                                                // diese Funktion gibt einen Glyphen aus dem Atlas zurueck und rastert ihn beim ersten Mal hinein, nullptr, wenn er nicht in den Atlas passt
+    int fontGetKerning(LEFont*, uint16_t, uint16_t);                                          // diese Funktion gibt die zwischengespeicherte Unterschneidung eines Glyphenpaares zurueck
+    int fontGrowAtlas(LEFont*, int);                                                          // diese Funktion vergroessert den Glyphenatlas, bis eine Zeile der angegebenen Hoehe hineinpasst, vorhandene Glyphen behalten ihre Position
+    int fontLoadBitmap(LEFont*, const char*, const char*);                                    // diese Funktion liest einen BMFont Descriptor (Text oder binaer) und laedt seine Seiten
+    int fontMerge();                                                                          // diese Funktion fuegt alle Fonts zusammen aus beiden Listen und loescht die Buffer Liste, ACHTUNG: diese Funktion wird nie aufgerufen, wenn font Funktionen noch in Threads laufen!!!
+    void fontMergeLists();                                                                    // diese Funktion fuegt die Original- und die Buffer Liste zusammen
+    void fontReleaseHandle(LEFontHandle*);                                                    // (TS) diese Funktion gibt ein Handle zurueck und schliesst den Font bzw. die Datei, wenn sie niemand mehr benutzt
+    void fontRetainHandle(LEFontHandle*);                                                     // (TS) diese Funktion haelt ein Handle zusaetzlich fest, z.B. fuer einen Auftrag im Hintergrund
+
+    //////////////////////////////
+    // general
+    //////////////////////////////
+
+    bool initialized;
+    SDL_Window * pWindow;
+    SDL_DisplayMode displayMode;
+    SDL_Event event;
+    SDL_Renderer * pRenderer;
+    uint32_t timestamp;
+    double timestep;
+    LEKeyboard keyboard;                                                                      // keyboard 0 = inactive, 1 = pressed, 2 = released
+    LEMouse mouse;                                                                            // mouse 0 = inactive, 1 = pressed, 2 = released
+    Color backgroundColor;                                                                    // Hintergrundfarbe
+    FPS fps;                                                                                  // frames per second
+    LEStats stats;                                                                            // Zaehler des laufenden Frames
+    LEStats lastStats;                                                                        // Zaehler des letzten abgeschlossenen Frames
+    LEMemory memory;                                                                          // hier werden Zeiger fuer alle grossen Arten gespeichert, sodass die Suche durch Listen performanter wird
+    char * prefPath;                                                                          // der Pfad wo Dateien geschrieben werden koennen
+
+    void clearKeyboard();                                                                     // diese Funktion setzt alle Tasten auf 0
+    void clearMouse();                                                                        // diese Funktion setzt alle Maustasten auf 0
+    int drawWithZindex();                                                                     // diese Funktion zeichnet Objekte (Models / Texte) anhand ihres Zindex
+    void freeKey(uint8_t&);                                                                   // diese Funktion setzt eine Keyboard Taste zurueck
+    void freeKeyboardKeys();                                                                  // diese Funktion setzt alle Keys auf inactive, die vorher auf released standen
+    void freeMouse();                                                                         // diese Funktion setzt alle Maus Events wieder zurueck
+    void handleKeyboard();                                                                    // diese Funktion haelt alle keyboard events fest
+    void handleMouse();                                                                       // diese Funktion haelt alle Mouse events fest
+    int merge();                                                                              // diese Funktion fuegt die Bufferlisten und die Originallisten zusammen und loescht zum loeschen markierte Elemente
+    void printErrorDialog(int, const char*);                                                  // diese Funktion gibt einen Fehler in einem Dialogfenster aus
+
+    //////////////////////////////
+    // line
+    //////////////////////////////
+
+    LELine * pLineHead;                                                                       // Liste mit Linien
+
+    int lineDraw(LELine*);                                                                    // diese Funktion malt eine Linie
+    LELine * lineGet(uint32_t);                                                               // diese Funktion gibt eine Referenz auf eine Linie zurueck
+
+    //////////////////////////////
+    // model
+    //////////////////////////////
+
+    LEModel * pModelHead;
+
+    bool modelCheckCollision(LEModel*, LEModel*);                                             // diese Funktion prueft anhand von Kollisionsbereichen zweier Models, ob sie kollidieren
+    bool modelCheckCollision(LEModel*, Point_d, LEModel*, Point_d);                           // diese Funktion prueft wie modelCheckCollision(), verschiebt die Kollisionsbereiche aber vorher um die angegebenen Abstaende (Clones)
+    bool modelCheckFrameBoxCollision(LEModel*, LEModel*);                                     // diese Funktion prueft, ob zwei Models im groben Kollisionsbereich kollidieren
+    int modelDraw(LEModel*);                                                                  // diese Funktion zeichnet ein Model
+    LEModel * modelGet(uint32_t);                                                             // diese Funktion gibt eine Modelreferenz anhand einer eindeutigen ID zurueck
+    uint32_t modelGetAmount();                                                                // diese Funktion gibt die Anzahl aller Modelle zurueck
+    bool modelHitPoint(LEModel*, Point_d);                                                    // diese Funktion prueft, ob ein Punkt in einem Kollisionsbereich (oder ohne Kollisionsbereiche im groben Kollisionsbereich) eines Models liegt
+    bool modelHitRay(LEModel*, Point_d, Point_d, double, double*);                            // diese Funktion prueft, ob ein Strahl ein Model trifft und gibt den kleinsten Abstand zurueck
+    double modelSweep(LEModel*, glm::vec2, LEModel**);                                        // diese Funktion gibt den Zeitpunkt (0.0 - 1.0) des ersten Kontaktes eines bewegten Models zurueck, 1.0 wenn es keinen Kontakt gibt
+
+    //////////////////////////////
+    // music
+    //////////////////////////////
+
+    LEMusic * pMusicHead;                                                                     // Liste mit Musikstuecken
+    vector<LEMusic*> musicPlaying;                                                            // Musikstuecke, die der Audiothread mischt, wird nur unter mtxMusic.playing veraendert
+
+    void musicFade(LEMusic*, int, int, bool);                                                 // diese Funktion blendet von der aktuellen Lautstaerke zu einem Ziel (0 - MIX_MAX_VOLUME) in Millisekunden, optional mit Ende
+    void musicFill(LEMusic*);                                                                 // diese Funktion liest und wandelt Samples, bis der Ringpuffer voll oder die Quelle zu Ende ist
+    LEMusic * musicGet(uint32_t);                                                             // diese Funktion gibt eine Referenz auf ein Musikstueck zurueck
+    static void SDLCALL musicMix(void*, uint8_t*, int);                                       // diese Funktion arbeitet die Soundbefehle ab, bereitet die Busse fuer den Puffer vor und mischt alle spielenden Musikstuecke im Audiothread, wird mit Mix_HookMusic() registriert
+    int musicOpen(LEMusic*, const char*, int64_t);                                            // diese Funktion oeffnet eine WAV Datei ab einem Versatz und liest nur ihren Kopf
+    void musicRemove(LEMusic*);                                                               // diese Funktion nimmt ein Musikstueck aus der Liste des Audiothreads
+    int musicStart(uint32_t, int, int, int);                                                  // diese Funktion spielt ein Musikstueck von vorne ab und blendet von einer Startlautstaerke ein (Wiederholungen, Startlautstaerke, Millisekunden)
+    void musicUpdate();                                                                       // diese Funktion fuellt die Ringpuffer nach und entfernt beendete Musikstuecke, wird in beginFrame() aufgerufen
+
+    //////////////////////////////
+    // music
+    //////////////////////////////
+
+    int musicCreate(uint32_t);                                                                // diese Funktion fuegt ein Musikstueck hinzu
+    int musicCrossfade(uint32_t, int, int);                                                   // diese Funktion blendet alle spielenden Musikstuecke aus und gleichzeitig dieses ein (Wiederholungen, Millisekunden)
+    int musicDelete(uint32_t);                                                                // diese Funktion loescht ein Musikstueck
+    int musicLoad(uint32_t, const char*);                                                     // diese Funktion oeffnet eine WAV Datei, die Samples werden erst beim Abspielen stueckweise gelesen (konstanter Speicher)
+    int musicLoadFromPack(uint32_t, const char*, int64_t);                                    // diese Funktion oeffnet eine WAV Datei, die ab einem Versatz in einer Packdatei liegt
+    int musicPlay(uint32_t, int);                                                             // diese Funktion spielt ein Musikstueck von vorne ab, -1 = endlos wiederholen
+    int musicSetVolume(uint32_t, uint8_t);                                                    // diese Funktion setzt die Lautstaerke eines Musikstuecks, 0 - MIX_MAX_VOLUME
+    int musicStop(uint32_t, int);                                                             // diese Funktion stoppt ein Musikstueck, optional mit Ausblenden in Millisekunden
+
+    //////////////////////////////
+    // point
+    //////////////////////////////
+
+    LEPoint * pPointHead;                                                                     // Liste mit Punkten
+
+    int pointDraw(LEPoint*);                                                                  // diese Funktion malt einen Punkt
+    LEPoint * pointGet(uint32_t);                                                             // diese Funktion gibt eine Referenz auf einen Punkt zurueck
+    LinkedVec2 * pointGetDirection(LEPoint*, uint32_t);                                       // diese Funktion gibt eine Referenz auf eine Bewegungsrichtung zurueck
+
+    //////////////////////////////
+    // sound
+    //////////////////////////////
+
+    LESound * pSoundHead;                                                                     // Liste mit Sounds
+
+    LESoundQueue soundQueue;                                                                  // Befehle an SDL_mixer, damit der Spielthread nie auf die Sperre des Audiogeraets wartet
+    vector<LEVoice> soundVoices;                                                              // ein Eintrag je Mixer Kanal, die Kanaele werden selbst vergeben statt Mix_PlayChannel(-1, ...)
+    uint32_t soundFrame;                                                                      // wird in beginFrame() erhoeht
+    LESoundListener soundListener;
+    LESoundEmitters soundEmitters;
+    LESoundBank soundBank;
+    vector<LESoundJob*> finishedSoundJobs;                                                    // im Hintergrund dekodierte Sounds, werden in beginFrame() uebernommen
+    LESoundMixer soundMixer;                                                                  // Busse mit Verstaerkung, Absenkung und Tiefpass als Effekte der Kanaele, Limiter auf der Summe
+
+    void soundClearJobs();                                                                    // diese Funktion verwirft alle fertigen Dekodierauftraege
+    void soundDecode(LESound*, const char*);                                                  // diese Funktion dekodiert einen Sound aus der Soundbank oder laedt eine WAV Datei fuer soundLoadAsync() im Hintergrund, falls das nicht schon passiert
+    void soundDrainCommands();                                                                // diese Funktion fuehrt alle anstehenden Soundbefehle auf einmal aus, im Audiothread oder nachdem Mix_HookMusic() entfernt wurde
+    void soundEvict();                                                                        // diese Funktion gibt die am laengsten nicht benutzten dekodierten Sounds frei, bis die Soundbank wieder im Budget liegt
+    LESound * soundGet(uint32_t);                                                             // diese Funktion gibt eine Referenz auf einen Sound zurueck
+    int soundGetVoice(LESound*, uint32_t);                                                    // diese Funktion waehlt einen Kanal: frei, die aelteste Instanz ueber maxInstances oder die unwichtigste Stimme, -1 = keiner
+    static void SDLCALL soundMixChannel(int, void*, int, void*);                              // diese Funktion ist der Effekt eines Kanals, wird beim Start mit Mix_RegisterEffect() registriert
+    void soundMixUpdateBuses(int);                                                            // diese Funktion berechnet Absenkung, Verstaerkung und Tiefpass aller Busse fuer den naechsten Puffer, nur im Audiothread
+    void soundPositionVoice(int, float, float, float);                                        // diese Funktion richtet eine Stimme relativ zum Zuhoerer aus oder pausiert bzw. stoppt sie ausserhalb des Hoerradius (Kanal, x, y, Entfernung 0 - 255)
+    void soundPushCommand(uint8_t, Mix_Chunk*, int, int, int);                                // diese Funktion stellt einen Befehl in den Ringpuffer ohne zu sperren, ist er voll, wird kurz gewartet und der Befehl sonst verworfen, ohne Audiothread laeuft der Befehl sofort
+    static void soundRunCommand(LESoundMixer*, const LESoundCommand&);                        // diese Funktion fuehrt einen Soundbefehl aus
+    int soundStartVoice(LESound*, int, int, int*);                                            // diese Funktion startet einen Sound unter Beachtung von Prioritaet, Instanzen und Mindestabstand, optional eingeblendet, der belegte Kanal ist sonst -1
+    void soundUpdateEmitters();                                                               // diese Funktion berechnet Entfernung und Richtung aller Stimmen, die einem Model folgen, und pausiert oder stoppt sie ausserhalb des Hoerradius, wird in endFrame() aufgerufen
+    void soundUploadJobs();                                                                   // diese Funktion uebernimmt alle fertig dekodierten Sounds und spielt wartende ab, wird in beginFrame() aufgerufen
+
+    //////////////////////////////
+    // text
+    //////////////////////////////
+
+    LEText * pTextHead;                                                                       // Liste mit Texten
+    vector<LETextJob*> finishedTextJobs;                                                      // im Hintergrund gerasterte Texte, werden in beginFrame() hochgeladen
+    uint32_t textRenderRequests;                                                              // fortlaufende Nummer fuer Rasterauftraege
+    uint32_t textInputId;                                                                     // Text, der SDL_TEXTINPUT und die Bearbeitungstasten erhaelt
+    bool textInputEnabled;
+    unordered_map<uint32_t, vector<SDL_Texture*>> textTexturePool;                            // freie Streaming Texturen je Groessenklasse
+    SDL_Point textTextureMax;                                                                 // groesste Textur des Renderers aus SDL_RendererInfo, 0 = unbekannt
+
+    SDL_Texture * textAcquireTexture(int, int);                                               // diese Funktion gibt eine Streaming Textur aus dem Pool zurueck, die mindestens so gross ist, und erstellt sie nur, wenn keine frei ist, nullptr, wenn der Renderer so grosse Texturen nicht kann
+    int textBuildGlyphRun(LEText*);                                                           // diese Funktion setzt alle veraenderten Zeilen aus Glyphen des Atlas zusammen, ohne den ganzen Text zu rastern
+    void textClearJobs();                                                                     // diese Funktion verwirft alle fertigen Hintergrundergebnisse
+    void textClearTexturePool();                                                              // diese Funktion zerstoert alle freien Texturen des Pools
+    void textCreateJob(LEText*, LETextJob*);                                                  // diese Funktion haelt alles fest, was zum Rastern eines Textes ausserhalb des Hauptthreads noetig ist
+    uint32_t textDecodeUTF8(const unsigned char*, uint32_t*);                                 // diese Funktion liest ein Zeichen aus UTF-8 und setzt den Index auf das naechste Zeichen
+    int textDraw(LEText*);                                                                    // diese Funktion zeichnet einen Text
+    LEText * textGet(uint32_t);                                                               // diese Funktion gibt eine Referenz auf einen Text zurueck
+    uint32_t textGetAmount();                                                                 // diese Funktion gibt die Anzahl aller Texte zurueck
+    LinkedVec2 * textGetDirection(LEText*, uint32_t);                                         // diese Funktion gibt die Referenz auf eine Bewegungsrichtung zurueck
+    void textHandleInput();                                                                   // diese Funktion gibt Texteingaben und Bearbeitungstasten an den Eingabetext weiter, wird in pollEvent() fuer jedes Ereignis aufgerufen
+    void textInsert(LEText*, const unsigned char*, uint32_t);                                 // diese Funktion fuegt Bytes an der Cursorposition ein, eine Auswahl wird ersetzt
+    void textLayout(LEText*);                                                                 // diese Funktion berechnet die Zeilenumbrueche eines Textes aus den Glyphenmetriken, nach Bearbeitungen nur die betroffenen Zeilen
+    int textRasterize(LEText*);                                                               // diese Funktion rastert einen Text neu oder baut ihn aus dem Glyphenatlas auf
+    void textReleaseTexture(SDL_Texture*);                                                    // diese Funktion gibt eine Textur an den Pool zurueck, volle Groessenklassen zerstoeren sie
+    void textRemove(LEText*, uint32_t, uint32_t);                                             // diese Funktion entfernt einen Bereich in Bytes und setzt den Cursor an seinen Anfang
+    void textReserve(LEText*, uint32_t);                                                      // diese Funktion vergroessert den Textbuffer, falls noetig
+    void textUploadJobs();                                                                    // diese Funktion erstellt die Texturen aller fertigen Hintergrundergebnisse, wird in beginFrame() aufgerufen
+    int textUploadSurface(LEText*, LETextJob*);                                               // diese Funktion ersetzt die Textur eines Textes durch das Ergebnis eines Auftrags und gibt die Surface frei
+    void textUpdateOutline(LEText*);                                                          // diese Funktion holt das Handle fuer den Umriss eines Textes oder gibt es frei, wenn es nicht mehr passt
+
+    //////////////////////////////
+    // time event
+    //////////////////////////////
+
+    LETimeEvent * pTimeEventHead;
+
+    LETimeEvent * timeEventGet(uint32_t);                                                     // diese Funktion gibt eine Referenz auf ein Zeitereignis zurueck
+
+    //////////////////////////////
+    // video
+    //////////////////////////////
+
+    LEVideo * pVideoHead;                                                                     // Liste mit Videos
+
+    LEVideo * videoGet(uint32_t);                                                             // diese Funktion liefert eine Referenz auf ein Video zurueck
+
+    //////////////////////////////
+    // window
+    //////////////////////////////
+
+    LEWindow window;                                                                          // diese Struktur speichert verschiedene Zustaende des Fenster
+
+    void handleWindow();                                                                      // diese Funktion behandelt das Fenster
+
+  public:
+
+    LEMoon();
+    ~LEMoon();
+
+    //////////////////////////////
+    // collision
+    //////////////////////////////
+
+    uint32_t collisionGetPairs(LECollisionPair*, uint32_t);                                   // diese Funktion schreibt alle kollidierenden Paare aus Models und Clones sortiert nach IDs in ein Array und gibt deren Anzahl zurueck
+    int collisionSetCellSize(int);                                                            // diese Funktion setzt die Kantenlaenge einer Zelle des Kollisionsgitters in Pixel und sortiert alle Models neu ein
+
+    //////////////////////////////
+    // contact
+    //////////////////////////////
+
+    uint32_t contactGetList(LEContact*, uint32_t);                                            // diese Funktion kopiert die Kontaktereignisse des letzten Frames in ein Array und gibt deren Anzahl zurueck
+    void contactSetEnabled(bool);                                                             // diese Funktion schaltet die Kontaktereignisse ein oder aus, standardmaessig aus
+
+    //////////////////////////////
+    // font
+    //////////////////////////////
+
+    int fontCreateBitmap(uint32_t, const char*, const char*);                                 // diese Funktion fuegt eine Bitmapschrift (BMFont Descriptor und Bild der ersten Seite, nullptr = aus dem Descriptor) hinzu, Texturen werden erstellt, daher nur im Hauptthread aufrufen
+    int fontCreateTTF(uint32_t, const char*, int);                                            // (TS) diese Funktion fuegt einen Font hinzu
+    int fontDelete(uint32_t);                                                                 // (TS) diese Funktion loescht einen Font
+    int fontPrewarm(uint32_t, const char*);                                                   // diese Funktion legt Glyphen und Vorschuebe eines Zeichensatzes im Voraus an (UTF-8, nullptr = ASCII), Texturen werden erstellt, daher nur im Hauptthread aufrufen
+    void fontPrintBufferList();                                                               // (TS) diese Funktion gibt die komplette Font Buffer Liste aus
+    void fontPrintList();                                                                     // (TS) diese Funktion gibt die komplette Original Font Liste aus
+    int fontSetAtlas(uint32_t, bool);                                                         // (TS) diese Funktion legt fest, ob Texte des Fonts aus einem Glyphenatlas zusammengesetzt werden (kein Rastern und keine neue Textur bei Textaenderungen)
+    int fontSetStyle(uint32_t, int);                                                          // (TS) diese Funktion setzt den Stil des Fonts, TTF_STYLE_BOLD, TTF_STYLE_ITALIC, TTF_STYLE_UNDERLINE, TTF_STYLE_STRIKETHROUGH
+    void fontUsingThread(bool);                                                               // (TS) mit dieser Funktion kann der Nutzer festlegen, ob er Font Funktionen in einem Thread benutzen moechte (LE_TRUE) oder diesen Vorgang beendet hat (LE_FALSE)
+
+    //////////////////////////////
+    // general
+    //////////////////////////////
+
+    void beginFrame();                                                                        // diese Funktion sollte am Anfang eines Frames in einem main loop erfolgen
+    double convertResHeight(double, double);                                                  // diese Funktion gibt die relative Y-Pixelgroesse eines Wertes anhand einer Ausgangsbildschirmaufloesung zurueck
+    double convertResWidth(double, double);                                                   // diese Funktion gibt die relative X-Pixelgroesse eines Wertes anhand einer Ausgangsbildschirmaufloesung zurueck
+    void delay(uint32_t);                                                                     // diese Funktion verzoegert die Anwendung um die angegebene Anzahl an Millisekunden
+    int drawFrame();                                                                          // diese Funktion zeichnet ein Frame, sie sollte nach lemoonBeginFrame() und vor lemoonEndFrame() aufgerufen werden
+    int endFrame();                                                                           // diese Funktion sollte am Ende eines Frames aufgerufen werden
+    bool engineInitialized();                                                                 // diese Funktion gibt ein flag zurueck, das aussagt, ob die Engine gestartet wurde
+    Color getBackgroundColor();                                                               // diese Funktion gibt die Hintergrundfarbe zurueck
+    uint16_t getFPS();                                                                        // diese Funktion gibt die Anzahl an Frames der letzten Sekunde zurueck
+    char * getPrefPath();                                                                     // diese Funktion gibt den externen Pref Pfad zurueck
+    int getScreenHeight();                                                                    // diese Funktion gibt die Hoehe der Bildschirmaufloesung zurueck
+    int getScreenWidth();                                                                     // diese Funktion gibt die Breite der Bildschirmaufloesung zurueck
+    LEStats getStats();                                                                       // diese Funktion gibt die Zaehler des letzten abgeschlossenen Frames zurueck
+    uint32_t getTimestamp();                                                                  // diese Funktion gibt den aktuellen Zeitstempel zurueck
+    double getTimestep();                                                                     // diese Funktion gibt die Dauer des letzten Frames zurueck
+    int init(const char*);                                                                    // diese Funktion initialisiert die Engine
+    int initImage();                                                                          // diese Funktion initialisiert den Bilderteil der Engine
+    int initSound(int);                                                                       // diese Funktion initialisiert den Soundteil der Engine
+    int initTTF();                                                                            // diese Funktion initialisiert den TTF - Teil der Engine
+    bool keyEvent(uint32_t, SDL_Keycode);                                                     // diese Funktion prueft, ob ein SDL_Keycode (https://wiki.libsdl.org/SDL_Keycode) gedrueckt oder losgelassen wird
+    void messageBox(const char*, const char*);                                                // diese Funktion ruft eine Dialogbox auf mit einem gewaehlten Titel und einem gewaehlten Text
+    #ifdef LE_LINUX
+    void mkpath(const char*, mode_t);                                                         // diese Funktion erstellt einen Pfad unter Linux
+    #endif
+    bool mouseEvent(uint32_t, uint8_t);                                                       // diese Funktion prueft, ob ein Mousebutton gedrueckt oder losgelassen wurde
+    SDL_Point mouseGetPosition();                                                             // diese Funktion gibt die Mausposition zurueck
+    double percentToPixelX(double);                                                           // diese Funktion wandelt eine Prozentangabe in eine Pixelgroesse in X Dimension um
+    double percentToPixelY(double);                                                           // diese Funktion wandelt eine Prozentangabe in eine Pixelgroesse in Y Dimension um
+    double pixelToPercentX(double);                                                           // diese Funktion wandelt eine Pixelangabe in eine Prozentangabe in X Dimension um
+    double pixelToPercentY(double);                                                           // diese Funktion wandelt eine Pixelangabe in eine Prozentangabe in Y Dimension um
+    int pollEvent();                                                                          // diese Funktion prueft auf events
+    void printErrorMessage(const char*, const char*);                                         // diese Funktion ermoeglicht dem Programmierer eine Fehlermeldung in einem Fenster auszugeben
+    bool recentFPSAvailable();                                                                // diese Funktion sagt aus, ob aktuelle FPS verfuegbar sind, diese Funktion gibt nur einmal pro Sekunde LE_TRUE zurueck
+    void setBackgroundColor(uint8_t, uint8_t, uint8_t);                                       // diese Funktion setzt die Hintergrundfarbe der Anwendung
+    void setWorkerThreads(uint32_t);                                                          // diese Funktion legt die Anzahl an Arbeitsthreads fest (z.B. fuer Kollisionen), standardmaessig 0 = alles im Hauptthread
+    int showCursor(bool);                                                                     // diese Funktion versteckt den Cursor (LE_FALSE) oder zeigt ihn (LE_TRUE)
+
+    //////////////////////////////
+    // line
+    //////////////////////////////
+
+    int lineCreate(uint32_t);                                                                 // diese Funktion erstellt eine Linie
+    int lineDelete(uint32_t);                                                                 // diese Funktion loescht eine Linie
+    int lineSet(uint32_t, int, int, int, int);                                                // diese Funktion setzt die Linie
+    int lineSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                           // diese Funktion setzt die Farbe einer Linie
+    int lineSetVisible(uint32_t, bool);                                                       // diese Funktion setzt eine Linie auf sichtbar oder unsichtbar
+    int lineSetZindex(uint32_t, uint32_t);                                                    // diese Funktion setzt den Zindex fuer eine Linie, 0 nicht erlaubt
+
+    //////////////////////////////
+    // model
+    //////////////////////////////
+
+    int modelAddCollisionCircle(uint32_t, uint32_t, int, int, int);                           // diese Funktion fuegt einen kreisfoermigen Kollisionsbereich hinzu, Mittelpunkt relativ zum Model und Radius in Pixel
+    int modelAddCollisionPolygon(uint32_t, uint32_t, const SDL_Point*, uint32_t);             // diese Funktion fuegt einen Kollisionsbereich als konvexes Polygon hinzu, Ecken relativ zum Model, hoechstens LE_COLL_POLYGON_MAX Ecken
+    int modelAddCollisionRect(uint32_t, uint32_t, SDL_Rect);                                  // diese Funktion fuegt eine Kollisionsbereich in Form eines Rechteckes hinzu
+    int modelAddDirection(uint32_t, uint32_t, glm::vec2);                                     // diese Funktion legt eine Bewegungsrichtung fuer ein Model an
+    int modelAddTextureSourceRect(uint32_t, uint32_t, uint32_t, int, int, int, int);          // diese Funktion fuegt einen Texturbereich hinzu aus welchem ausschliesslich gezeichnet werden soll
+    int modelChangeDirection(uint32_t, uint32_t, glm::vec2);                                  // diese Funktion aendert eine Bewegungsrichtung
+    bool modelCheckCollision(uint32_t, uint32_t);                                             // diese Funktion prueft, ob zwei Models miteinander kollidieren
+    bool modelCheckFrameBoxCollision(uint32_t, uint32_t);                                     // diese Funktion prueft, ob die groben Kollisionsbereiche von zwei Models miteinander kollidieren
+    int modelClearClones(uint32_t);                                                           // diese Funktion loescht alle Clones des Models
+    int modelCreate(uint32_t);                                                                // diese Funktion erzeugt ein Model mit Hilfe einer eindeutigen ID
+    int modelCreateClone(uint32_t, uint32_t);                                                 // diese Funktion erstellt einen Clone fuer ein Model
+    int modelCreateSurface(uint32_t, uint32_t, const char*);                                  // diese Funktion erstellt ein Surface aus einem Bild, um mit den Pixeldaten direkt arbeiten zu koennen
+    int modelCreateTexture(uint32_t, uint32_t, const char*);                                  // diese Funktion erzeugt eine Textur, alle Texturen sollten die selbe Groesse haben, wegen des groben Kollisionsbereiches!
+    int modelDelete(uint32_t);                                                                // diese Funktion loescht ein Model wieder
+    int modelDeleteSurface(uint32_t, uint32_t);                                               // diese Funktion loescht das Surface einer Textur wieder
+    int modelFadeTexture(uint32_t, uint32_t, double);                                         // diese Funktion blendet eine Textur ein oder aus
+    int modelFocusTextureSourceRect(uint32_t, uint32_t, uint32_t);                            // diese Funktion setzt den Fokus auf einen Texturbereich, sodass nur dieser gezeichnet werden soll
+    uint32_t modelGetAmountOfCollisionBoxes(uint32_t);                                        // diese Funktion gibt die Anzahl an Kollisionsbereichen zurueck
+    uint32_t modelGetAmountOfTextureSourceRectangles(uint32_t, uint32_t);                     // diese Funktion gibt die Anzahl an Texturbereichen einer Textur zurueck
+    uint32_t modelGetCloneCollisions(uint32_t, uint32_t, LECollisionPair*, uint32_t);         // diese Funktion schreibt alle Kollisionen eines Clones (LE_CLONE_NONE = das Model selbst) mit anderen Models und deren Clones in ein Array und gibt deren Anzahl zurueck
+    LECollBox_d modelGetCollisionBox(uint32_t, uint32_t);                                     // diese Funktion gibt einen bestimmten Kollisionsbereich zurueck
+    uint32_t modelGetCollisions(uint32_t, uint32_t*, uint32_t);                               // diese Funktion schreibt die IDs aller Models, mit denen ein Model kollidiert, in ein Array und gibt deren Anzahl zurueck
+    uint32_t modelGetContacts(uint32_t, LEContact*, uint32_t);                                // diese Funktion kopiert die Kontaktereignisse eines Models aus dem letzten Frame in ein Array und gibt deren Anzahl zurueck
+    glm::vec2 modelGetDirection(uint32_t, uint32_t);                                          // diese Funktion gibt eine Bewegungsrichtung zurueck
+    LECollBox_d modelGetFrameBox(uint32_t);                                                   // diese Funktion gibt den groben Kollisionsbereich eines Models zurueck
+    Color modelGetPixelRGBA(uint32_t, uint32_t, uint32_t, uint32_t);                          // diese Funktion gibt einen Pixel einer Textur zurueck, modelCreateSurface() muss vorher aufgerufen worden sein
+    glm::vec2 modelGetPositionD(uint32_t);                                                    // diese Funktion gibt die genauen Positionswerte des Models zurueck
+    SDL_Point modelGetPosition(uint32_t);                                                     // diese Funktion gibt die Position eines Models zurueck
+    SDL_Point modelGetSize(uint32_t);                                                         // diese Funktion gibt die Groesse eines Models zurueck
+    double modelGetSizeFactor(uint32_t);                                                      // diese Funktion gibt den Faktor der Modelgroesse zurueck
+    SDL_Surface * modelGetSurface(uint32_t, uint32_t);                                        // diese Funktion gibt einen Zeiger auf ein erstelltes Surface zurueck
+    double modelGetTextureAlpha(uint32_t, uint32_t);                                          // diese Funktion gibt den Alphawert einer Textur zurueck
+    bool modelGetVisible(uint32_t);                                                           // diese Funktion gibt visible zurueck
+    double modelGetTimeOfImpact(uint32_t, uint32_t, uint32_t*);                               // diese Funktion gibt den Zeitpunkt (0.0 - 1.0) des ersten Kontaktes innerhalb dieses Frames zurueck, wenn das Model in eine Richtung bewegt wird, optional die ID des getroffenen Models
+    uint32_t modelGetZindex(uint32_t);                                                        // diese Funktion gibt den Z-index des Models zurueck
+    int modelMoveDirection(uint32_t, uint32_t);                                               // diese Funktion bewegt ein Model in eine vorher angelegte Richtung
+    int modelMoveDirectionSwept(uint32_t, uint32_t, uint32_t*);                               // diese Funktion bewegt ein Model in eine Richtung und haelt beim ersten Kontakt an, optional wird die ID des getroffenen Models gespeichert
+    bool modelQueryPoint(int, int, uint32_t*);                                                // diese Funktion sucht das oberste sichtbare Model (hoechster zindex) an einem Punkt, z.B. unter der Maus
+    uint32_t modelQueryRay(glm::vec2, glm::vec2, double, uint32_t*, double*, uint32_t);       // diese Funktion gibt die IDs (und Abstaende) der Models zurueck, die ein Strahl bis zu einer maximalen Laenge trifft, sortiert nach Abstand
+    int modelRotate(uint32_t, double);                                                        // diese Funktion rotiert ein Model um die angegebene Gradzahl pro Sekunde
+    int modelRotateDir(uint32_t, uint32_t, double);                                           // diese Funktion rotiert eine Bewegungsrichtung um eine angegebene Gradzahl pro Sekunde
+    int modelRotateOnce(uint32_t, double);                                                    // diese Funktion rotiert ein Model einmalig
+    int modelSetClonePosition(uint32_t, uint32_t, glm::vec2);                                 // diese Funktion setzt die Position eines Model Clones
+    int modelSetCollisionLayer(uint32_t, uint32_t);                                           // diese Funktion legt die Kollisionsebenen (Bitmaske) eines Models fest, standardmaessig LE_COLL_LAYER_DEFAULT
+    int modelSetCollisionMask(uint32_t, uint32_t);                                            // diese Funktion legt fest, mit welchen Kollisionsebenen (Bitmaske) ein Model kollidiert, standardmaessig LE_COLL_MASK_ALL
+    int modelSetCloneVisible(uint32_t, uint32_t, bool);                                       // diese Funktion macht einen Clone eines Models sichtbar oder unsichtbar
+    int modelSetPosition(uint32_t, double, double);                                           // diese Funktion setzt die Position eines Models in NDC
+    int modelSetSize(uint32_t, int, int);                                                     // diese Funktion legt die Groesse des Models fest
+    double modelSetSize(uint32_t, double);                                                    // diese Funktion legt die Groesse des Models in Prozent fest und gibt den Vergroesserungsfaktor zurueck, der dabei entsteht
+    int modelSetSizeFactor(uint32_t, double);                                                 // diese Funktion setzt den Faktor der Modelgroesse
+    int modelSetTextureActive(uint32_t, uint32_t, bool);                                      // diese Funktion left fest, ob eine Textur sichtbar ist, oder nicht
+    int modelSetTextureAlpha(uint32_t, uint32_t, uint8_t);                                    // diese Funktion setzt einen Alphawert fuer eine Textur
+    int modelSetTextureZindex(uint32_t, uint32_t, uint32_t);                                  // diese Funktion setzt den zindex einer Textur innerhalb eines Models
+    int modelSetVisible(uint32_t, bool);                                                      // diese Funktion setzt ein Model auf sichtbar oder unsichtbar
+    int modelSetZindex(uint32_t, uint32_t);                                                   // diese Funktion setzt den zindex eines Models, 0 nicht erlaubt
+    bool modelTextureExists(uint32_t, uint32_t);                                              // diese Funktion prueft, ob eine Modeltextur ID existiert
+
+    //////////////////////////////
+    // point
+    //////////////////////////////
+
+    int pointAddDirection(uint32_t, uint32_t, glm::vec2);                                     // diese Funktion fuegt eine Bewegungsrichtung hinzu
+    int pointCreate(uint32_t);                                                                // diese Funktion fuegt einen Punkt hinzu
+    int pointDelete(uint32_t);                                                                // diese Funktion loescht einen Punkt
+    int pointFade(uint32_t, double);                                                          // diese Funktion blendet einen Punkt ein oder aus
+    Color pointGetColor(uint32_t);                                                            // diese Funktion gibt die Farbe eines Punktes zurueck
+    SDL_Point pointGetPosition(uint32_t);                                                     // diese Funktion gibt die Position eines Punktes zurueck
+    int pointMoveDirection(uint32_t, uint32_t);                                               // diese Funktion bewegt einen Punkt in eine zuvor erstelle Bewegungsrichtung
+    int pointRotate(uint32_t, double, SDL_Point);                                             // diese Funktion laesst einen Punkt um einen bestimmten Punkt rotieren
+    int pointSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                          // diese Funktion legt die Farbe eines Punktes fest
+    int pointSetPosition(uint32_t, int, int);                                                 // diese Funktion setzt die Position eines Punktes
+    int pointSetVisible(uint32_t, bool);                                                      // diese Funktion macht einen Punkt sichtbar oder unsichtbar
+    int pointSetZindex(uint32_t, uint32_t);                                                   // diese Funktion setzt den Z-index eines Punktes
+
+    //////////////////////////////
+    // sound
+    //////////////////////////////
+
+    int soundCreate(uint32_t);                                                                // diese Funktion fuegt einen Sound hinzu
+    int soundDelete(uint32_t);                                                                // diese Funktion loescht einen Sound
+    int soundFadeIn(uint32_t, int);                                                           // diese Funktion blendet einen Kanal oder alle Kanaele ein
+    void soundFadeOut(int);                                                                   // diese Funktion blendet einen Kanal oder alle Kanaele aus
+    uint32_t soundGetPendingLoads();                                                          // diese Funktion gibt die Anzahl der noch laufenden Lade- und Dekodierauftraege zurueck, z.B. fuer einen Ladebildschirm
+    bool soundIsLoaded(uint32_t);                                                             // diese Funktion sagt aus, ob ein Sound fertig geladen ist und sofort abgespielt werden kann
+    int soundLoadAsync(uint32_t, const char*);                                                // diese Funktion laedt eine WAV Datei im Hintergrund, soundPlay() spielt den Sound ab, sobald er fertig ist
+    int soundLoadBatchAsync(uint32_t, const uint32_t*, const char**);                         // diese Funktion laedt mehrere WAV Dateien parallel im Hintergrund (Anzahl, IDs, Dateien)
+    int soundLoadCompressed(uint32_t, const char*);                                           // diese Funktion liest eine komprimierte Datei (z.B. OGG) in die Soundbank, dekodiert wird erst beim ersten Abspielen im Hintergrund
+    int soundLoadWAV(uint32_t, const char*);                                                  // diese Funktion laedt eine WAV Datei fuer einen erstellten Sound
+    int soundLock(uint32_t, bool);                                                            // diese Funktion sperrt einen Sound, sodass er hier nach nicht wieder gespielt wird, bis er entsperrt ist
+    static void soundMixBus(LESoundBus*, int16_t*, int, float*);                              // diese Funktion wendet Verstaerkung und Tiefpass eines Busses auf einen Stereopuffer an, ohne Audiogeraet aufrufbar (Bus, Samples, Anzahl, Tiefpass)
+    static void SDLCALL soundMixMaster(void*, uint8_t*, int);                                 // diese Funktion gleicht die Reserve der Busse aus und begrenzt die Summe, wird mit Mix_SetPostMix() registriert, ohne Audiogeraet aufrufbar
+    void soundPause();                                                                        // diese Funktion pausiert einen Sound
+    int soundPin(uint32_t, bool);                                                             // diese Funktion heftet einen Sound aus der Soundbank an, er wird sofort dekodiert und nie verdraengt
+    int soundPlay(uint32_t, int);                                                             // diese Funktion spielt einen Sound ab
+    int soundPlayAt(uint32_t, uint32_t, int);                                                 // diese Funktion spielt einen Sound ab, der der Mitte eines Models folgt (Sound, Model, Wiederholungen)
+    void soundSetAudibleRadius(double);                                                       // diese Funktion setzt den Hoerradius in Pixel, weiter entfernte Stimmen werden nicht gemischt
+    void soundSetBankBudget(size_t);                                                          // diese Funktion setzt, wie viele Bytes dekodierte Sounds aus der Soundbank belegen duerfen
+    int soundSetBus(uint32_t, uint8_t);                                                       // diese Funktion legt fest, ueber welchen Bus ein Sound gemischt wird
+    int soundSetBusDucking(uint8_t, int, double);                                             // diese Funktion senkt einen Bus ab, solange auf einem anderen etwas laeuft, z.B. Musik unter Dialogen (Bus, anderer Bus oder -1, Faktor)
+    int soundSetBusGain(uint8_t, double);                                                     // diese Funktion setzt die Verstaerkung eines Busses, Aenderungen werden ueber einen Puffer interpoliert
+    int soundSetBusLowPass(uint8_t, double);                                                  // diese Funktion setzt die Grenzfrequenz des Tiefpasses eines Busses in Hz, 0 = aus
+    void soundSetLimiter(double);                                                             // diese Funktion setzt die Schwelle des Limiters auf der Summe (0.0 - 1.0), 1.0 = aus, sonst werden die Busse mit 6 dB Reserve gemischt
+    void soundSetListener(double, double);                                                    // diese Funktion setzt die Position des Zuhoerers in Pixel, z.B. die Mitte der Kamera
+    int soundSetMaxInstances(uint32_t, uint8_t);                                              // diese Funktion begrenzt, wie oft ein Sound gleichzeitig laufen darf, 0 = unbegrenzt
+    int soundSetPriority(uint32_t, uint8_t);                                                  // diese Funktion setzt die Prioritaet eines Sounds, standardmaessig 128, bei vollen Kanaelen verdraengt sie gleich- oder unwichtigere Sounds
+    int soundSetRetriggerInterval(uint32_t, uint32_t);                                        // diese Funktion setzt den Mindestabstand zwischen zwei Starts eines Sounds in Millisekunden
+    void soundSetVolume(uint8_t);                                                             // diese Funktion setzt die Lautstaerke
+
+    //////////////////////////////
+    // text
+    //////////////////////////////
+
+    int textAddDirection(uint32_t, uint32_t, glm::vec2);                                      // diese Funktion fuegt einem Text eine Bewegungsrichtung hinzu
+    int textAddLetter(uint32_t, uint8_t);                                                     // diese Funktion fuegt einen Buchstaben an der Cursorposition hinzu, standardmaessig am Ende, eine Auswahl wird ersetzt
+    int textAddString(uint32_t, const char*);                                                 // diese Funktion fuegt einen kompletten String an der Cursorposition hinzu, eine Auswahl wird ersetzt
+    int textClear(uint32_t);                                                                  // diese Funktion loescht den kompletten Text
+    int textCreate(uint32_t);                                                                 // diese Funktion fuegt einen UTF8 Text hinzu
+    int textDelete(uint32_t);                                                                 // diese Funktion loescht einen Text
+    int textErase(uint32_t, int);                                                             // diese Funktion loescht Zeichen am Cursor, negativ = davor (Backspace), positiv = dahinter (Entf), eine Auswahl wird stattdessen geloescht
+    int textFade(uint32_t, double);                                                           // diese Funktion blendet einen Text ein oder aus
+    double textGetAlpha(uint32_t);                                                            // diese Funktion gibt den Alpha Wert eines Textes zurueck
+    uint32_t textGetCursor(uint32_t);                                                         // diese Funktion gibt die Cursorposition in Bytes zurueck
+    SDL_Point textGetPosition(uint32_t);                                                      // diese Funktion gibt die Position des Textes zurueck
+    SDL_Point textGetSelection(uint32_t);                                                     // diese Funktion gibt Anfang (x) und Ende (y) der Auswahl in Bytes zurueck, x = y bedeutet keine Auswahl
+    SDL_Point textGetSize(uint32_t);                                                          // diese Funktion gibt die Dimensionen des Textes zurueck, veraenderte Texte werden nur vermessen und nicht gerastert
+    bool textGetVisible(uint32_t);                                                            // diese Funktion prueft, ob ein Text sichtbar ist
+    int textMoveCursor(uint32_t, int, bool);                                                  // diese Funktion bewegt den Cursor um eine Anzahl Zeichen, LE_TRUE erweitert dabei die Auswahl
+    int textMoveDirection(uint32_t, uint32_t);                                                // diese Funktion bewegt eine Text in eine zuvor erstellte Bewegungsrichtung
+    int textPrepareForDrawing(uint32_t);                                                      // diese Funktion rastert einen veraenderten Text sofort, sonst geschieht das automatisch vor dem Zeichnen
+    int textPrepareForDrawingAsync(uint32_t);                                                 // diese Funktion rastert einen veraenderten Text in einem Arbeitsthread, die alte Textur bleibt bis zum Hochladen in beginFrame() sichtbar
+    int textRelateFont(uint32_t, uint32_t);                                                   // diese Funktion ordnet dem Text einen Font zu
+    int textSetAlign(uint32_t, uint8_t);                                                      // diese Funktion setzt die Ausrichtung der Zeilen, LE_ALIGN_LEFT, LE_ALIGN_CENTER oder LE_ALIGN_RIGHT
+    int textSetAlpha(uint32_t, uint8_t);                                                      // diese Funktion setzt den Alphawert eines Textes
+    int textSetColor(uint32_t, uint8_t, uint8_t, uint8_t, uint8_t);                           // diese Funktion setzt die Farbe eines Textes
+    int textSetCursor(uint32_t, uint32_t, bool);                                              // diese Funktion setzt den Cursor auf eine Position in Bytes, LE_TRUE erweitert dabei die Auswahl
+    int textSetInput(uint32_t, bool);                                                         // diese Funktion legt fest, ob ein Text SDL_TEXTINPUT Ereignisse, Backspace, Entf, Pfeiltasten, Pos1 und Ende aus pollEvent() erhaelt
+    int textSetLineSpacing(uint32_t, int);                                                    // diese Funktion setzt den zusaetzlichen Abstand zwischen zwei Zeilen in Pixel
+    int textSetMaxWidth(uint32_t, int);                                                       // diese Funktion setzt die maximale Zeilenbreite, laengere Zeilen werden am letzten Leerzeichen umgebrochen, 0 = kein automatischer Umbruch
+    int textSetOutline(uint32_t, int, uint8_t, uint8_t, uint8_t, uint8_t);                    // diese Funktion setzt Breite und Farbe des Umrisses, 0 = kein Umriss, Umriss, Schatten und Fuellung ergeben eine Textur
+    int textSetPosition(uint32_t, int, int);                                                  // diese Funktion setzt die Position eines Textes
+    int textSetSelection(uint32_t, uint32_t, uint32_t);                                       // diese Funktion waehlt einen Bereich in Bytes aus, der Cursor steht am Ende
+    int textSetShadow(uint32_t, int, int, uint8_t, uint8_t, uint8_t, uint8_t);                // diese Funktion setzt Versatz und Farbe des Schattens, 0, 0 = kein Schatten, Texte mit Effekten benutzen keinen Glyphenatlas
+    int textSetString(uint32_t, const char*);                                                 // diese Funktion ersetzt den kompletten Text
+    int textSetVisible(uint32_t, bool);                                                       // diese Funktion sagt aus, ob ein Text sichtbar ist, oder nicht
+    int textSetZindex(uint32_t, uint32_t);                                                    // diese Funktion setzt den z-index fuer einen Text, 0 nicht erlaubt
+    int textSubmit(uint32_t);                                                                 // diese Funktion ist nur noch aus Kompatibilitaetsgruenden vorhanden, Aenderungen werden automatisch uebernommen
+
+    //////////////////////////////
+    // time event
+    //////////////////////////////
+
+    int timeEventCreate(uint32_t, uint32_t);                                                  // diese Funktion erstellt ein Zeitereignis
+    int timeEventDelete(uint32_t);                                                            // diese Funktion loescht ein Zeitereignis
+    uint32_t timeEventGetStamp(uint32_t);                                                     // diese Funktion gibt den Zeitstempel fuer das Zeitereignis zurueck
+    bool timeEventReached(uint32_t);                                                          // diese Funktion prueft, ob ein Zeitereignis bereits erreicht wurde
+    int timeEventReset(uint32_t, uint32_t);                                                   // diese Funktion setzt den Wert eines Zeitereignisses neu
+    int timeEventUpdate(uint32_t, uint32_t);                                                  // diese Funktion verlaengert ein Zeitereignis um eine Anzahl von Millisekunden
+    void timeEventUpdateValidALL(uint32_t);                                                   // diese Funktion verlaengert alle noch nicht erreichten Zeitereignisse um eine Anzahl von Millisekunden
+
+    //////////////////////////////
+    // video
+    //////////////////////////////
+
+    int videoCreate(uint32_t, const char*);                                                   // diese Funktion erstellt ein Video
+    int videoDelete(uint32_t);                                                                // diese Funktion loescht ein Video
+    bool videoPlay(uint32_t);                                                                 // diese Funktion legt fest, ob ein Video gespielt wird oder nicht
+
+    //////////////////////////////
+    // window
+    //////////////////////////////
+
+    bool windowFocused();                                                                     // diese Funktion prueft, ob das Fenster gerade im Focus ist, oder nicht
+} *LEMoonInstance;
+
+#endif
@@ -1,46 +1,72 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
-  date:               11.04.2018
-  updated:            18.04.2018
-*/
-
-#ifndef H_LE_MUTEX
-#define H_LE_MUTEX
-
-#include <mutex>
-using namespace std;
-
-struct LEMutexFont
-{
-  // general
-
-  mutex originalList;
-  mutex bufferList;
-
-  // public
-
-  mutex fontCreateTTF;
-  mutex fontDelete;
-  mutex fontPrintBufferList;
-  mutex fontPrintList;
-  mutex fontSetStyle;
-  mutex fontUsingThread;
-
-  // locked by merge
-
-  bool fontCreateTTFLockedByMerge;
-  bool fontDeleteLockedByMerge;
-};
-
-struct LEMutexGeneral
-{
-  // private
-
-  mutex printErrorDialog;
-
-  // public
-};
-
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
+  date:               11.04.2018
+  updated:            19.10.2026
+*/
+
+#ifndef H_LE_MUTEX
+#define H_LE_MUTEX
+
+#include <mutex>
+using namespace std;
+
+struct LEMutexFont
+{
+  // general
+
+  mutex originalList;
+  mutex bufferList;
+  mutex fontCache;
+
+  // public
+
+  mutex fontCreateBitmap;
+  mutex fontCreateTTF;
+  mutex fontDelete;
+  mutex fontPrewarm;
+  mutex fontPrintBufferList;
+  mutex fontPrintList;
+  mutex fontSetAtlas;
+  mutex fontSetStyle;
+  mutex fontUsingThread;
+
+  // locked by merge
+
+  bool fontCreateBitmapLockedByMerge;
+  bool fontCreateTTFLockedByMerge;
+  bool fontDeleteLockedByMerge;
+};
+
+struct LEMutexText
+{
+  // private
+
+  mutex finishedJobs;
+};
+
+struct LEMutexMusic
+{
+  // private
+
+  mutex playing;
+};
+
+struct LEMutexSound
+{
+  // private
+
+  mutex finishedJobs;
+};
+
+struct LEMutexGeneral
+{
+  // private
+
+  mutex printErrorDialog;
+
+  // public
+};
+
 #endif
\ No newline at end of file
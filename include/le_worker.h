@@ -0,0 +1,46 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+*/
+
+#ifndef H_LE_WORKER
+#define H_LE_WORKER
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class LEWorker
+{
+  private:
+
+    vector<thread> threads;                                                         // Arbeitsthreads, die Aufgaben aus der Warteschlange abarbeiten
+    deque<function<void()>> tasks;                                                  // Warteschlange mit Aufgaben
+    mutex mtxTasks;
+    condition_variable cvTasks;                                                     // weckt Arbeitsthreads, sobald eine Aufgabe ansteht
+    bool stop;                                                                      // sagt aus, ob die Arbeitsthreads sich beenden sollen
+
+    void workerLoop();                                                              // diese Funktion laeuft in jedem Arbeitsthread und arbeitet Aufgaben ab
+
+  public:
+
+    LEWorker();
+    ~LEWorker();
+
+    uint32_t workerGetAmountOfThreads();                                            // diese Funktion gibt die Anzahl an Arbeitsthreads zurueck
+    void workerParallelFor(uint32_t, const function<void(uint32_t)>&);              // diese Funktion ruft eine Funktion fuer jeden Index auf, verteilt auf alle Arbeitsthreads und den aufrufenden Thread, und kehrt erst zurueck, wenn alle fertig sind
+    void workerPost(const function<void()>&);                                       // diese Funktion stellt eine Aufgabe in die Warteschlange, ohne auf sie zu warten (ohne Arbeitsthreads wird sie sofort ausgefuehrt)
+    void workerStart(uint32_t);                                                     // diese Funktion startet die angegebene Anzahl an Arbeitsthreads, 0 = alles im aufrufenden Thread
+    void workerStop();                                                              // diese Funktion arbeitet die Warteschlange ab und beendet alle Arbeitsthreads
+};
+
+#endif
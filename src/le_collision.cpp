@@ -0,0 +1,606 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+
+  NOTES:              das Kollisionsgitter wird nicht sofort aktualisiert, veraenderte Models werden vorgemerkt und erst vor der naechsten Abfrage neu einsortiert
+*/
+
+#include "../include/le_moon.h"
+#include <algorithm>
+#include <climits>
+
+#define LE_COLL_CELL_SIZE_DEFAULT       128
+#define LE_COLL_MODELS_PER_JOB          32
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private collision
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static uint64_t collisionCellKey(int cellX, int cellY)
+{
+  return ((uint64_t)(uint32_t)cellX << 32) | (uint64_t)(uint32_t)cellY;
+}
+
+static bool collisionHitCloser(const LECollisionHit &hitA, const LECollisionHit &hitB)
+{
+  return hitA.distance < hitB.distance;
+}
+
+static bool collisionPairLess(const LECollisionPair &pairA, const LECollisionPair &pairB)
+{
+  if(pairA.idModel != pairB.idModel)
+    {return pairA.idModel < pairB.idModel;}
+  if(pairA.idClone != pairB.idClone)
+    {return pairA.idClone < pairB.idClone;}
+  if(pairA.idForeignModel != pairB.idForeignModel)
+    {return pairA.idForeignModel < pairB.idForeignModel;}
+
+  return pairA.idForeignClone < pairB.idForeignClone;
+}
+
+static bool collisionProxyLess(const LECollisionProxy * pProxyA, const LECollisionProxy * pProxyB)
+{
+  return (pProxyA->pModel->id != pProxyB->pModel->id) ? pProxyA->pModel->id < pProxyB->pModel->id : pProxyA->idClone < pProxyB->idClone;
+}
+
+static LECollisionPair collisionMakePair(const LECollisionProxy * pProxy, const LECollisionProxy * pForeignProxy)
+{
+  LECollisionPair pair = {pProxy->pModel->id, pProxy->idClone, pForeignProxy->pModel->id, pForeignProxy->idClone};
+
+  return pair;
+}
+
+void LEMoon::collisionClearClones(LEModel * pModel)
+{
+  unordered_map<uint32_t, LECollisionProxy>::iterator clone;
+
+  for(clone = pModel->cloneProxies.begin() ; clone != pModel->cloneProxies.end() ; clone++)
+    {this->collisionGridRemove(&clone->second);}
+
+  pModel->cloneProxies.clear();
+}
+
+void LEMoon::collisionConstructor()
+{
+  this->collisionGrid.cellSize = LE_COLL_CELL_SIZE_DEFAULT;
+  this->collisionGrid.queryStamp = 0;
+  this->collisionGrid.minCellX = INT_MAX;
+  this->collisionGrid.minCellY = INT_MAX;
+  this->collisionGrid.maxCellX = INT_MIN;
+  this->collisionGrid.maxCellY = INT_MIN;
+}
+
+void LEMoon::collisionFindPairs(const vector<LECollisionProxy*> &proxies, bool withClones, vector<LECollisionProxyPair> &pairs)
+{
+  uint32_t amountJobs = (uint32_t)((proxies.size() + LE_COLL_MODELS_PER_JOB - 1) / LE_COLL_MODELS_PER_JOB);
+  vector<vector<LECollisionProxyPair>> jobPairs(amountJobs);
+
+  this->collisionGridUpdate();
+
+  for(size_t i = 0 ; i < proxies.size() ; i++)
+    {proxies[i]->pairSource = LE_TRUE;}
+
+  // feste Bloecke von Eintraegen je Aufgabe, jede Aufgabe schreibt nur in ihren eigenen Puffer
+
+  this->worker.workerParallelFor(amountJobs, [this, &proxies, withClones, &jobPairs](uint32_t job)
+  {
+    LECollisionProxy * pProxy = nullptr;
+    LECollisionProxy * pCandidate = nullptr;
+    LECollisionProxyPair pair;
+    Point_d offset;
+    vector<LECollisionProxy*> candidates;
+    size_t last = (job + 1) * LE_COLL_MODELS_PER_JOB;
+
+    for(size_t i = job * LE_COLL_MODELS_PER_JOB ; i < last && i < proxies.size() ; i++)
+    {
+      pProxy = proxies[i];
+
+      // unsichtbare Clones nehmen nicht an Kollisionen teil
+
+      if(pProxy->pClone != nullptr && !pProxy->pClone->visible)
+        {continue;}
+
+      offset = this->collisionGetOffset(pProxy);
+      candidates.clear();
+      this->collisionQueryShared(pProxy->bounds, pProxy->pModel->collisionMask, candidates);
+
+      for(size_t j = 0 ; j < candidates.size() ; j++)
+      {
+        pCandidate = candidates[j];
+
+        // ein Model kollidiert weder mit seinen eigenen Clones noch diese untereinander
+
+        if(pCandidate->pModel == pProxy->pModel || (pCandidate->pClone != nullptr && (!withClones || !pCandidate->pClone->visible)))
+          {continue;}
+
+        // wird der Partner selbst abgefragt, prueft nur der Eintrag mit der kleineren ID
+
+        if(pCandidate->pairSource && collisionProxyLess(pCandidate, pProxy))
+          {continue;}
+
+        if(mathBoundsIntersection(pProxy->bounds, pCandidate->bounds) && this->modelCheckCollision(pProxy->pModel, offset, pCandidate->pModel, this->collisionGetOffset(pCandidate)))
+        {
+          pair.pProxy = pProxy;
+          pair.pForeignProxy = pCandidate;
+          jobPairs[job].push_back(pair);
+        }
+      }
+    }
+  });
+
+  // zusammenfuegen in Reihenfolge der Bloecke, nicht der Threads
+
+  for(uint32_t job = 0 ; job < amountJobs ; job++)
+    {pairs.insert(pairs.end(), jobPairs[job].begin(), jobPairs[job].end());}
+
+  for(size_t i = 0 ; i < proxies.size() ; i++)
+    {proxies[i]->pairSource = LE_FALSE;}
+}
+
+AABB_d LEMoon::collisionGetBounds(LECollisionProxy * pProxy)
+{
+  AABB_d bounds = mathCollBoxBounds(pProxy->pModel->pModel->mdlGetFrameBox());
+  Point_d offset = this->collisionGetOffset(pProxy);
+
+  bounds.minX += offset.x;
+  bounds.minY += offset.y;
+  bounds.maxX += offset.x;
+  bounds.maxY += offset.y;
+
+  return bounds;
+}
+
+Point_d LEMoon::collisionGetOffset(LECollisionProxy * pProxy)
+{
+  Point_d offset = {0.0f, 0.0f};
+  glm::vec2 position;
+
+  // ein Clone wird wie beim Zeichnen an seine eigene Position verschoben
+
+  if(pProxy->pClone != nullptr)
+  {
+    position = pProxy->pModel->pModel->mdlGetPositionD();
+    offset.x = pProxy->pClone->position.x - position.x;
+    offset.y = pProxy->pClone->position.y - position.y;
+  }
+
+  return offset;
+}
+
+void LEMoon::collisionGridInsert(LECollisionProxy * pProxy)
+{
+  double cellSize = (double) this->collisionGrid.cellSize;
+
+  pProxy->bounds = this->collisionGetBounds(pProxy);
+  pProxy->cellMinX = (int)floor(pProxy->bounds.minX / cellSize);
+  pProxy->cellMinY = (int)floor(pProxy->bounds.minY / cellSize);
+  pProxy->cellMaxX = (int)floor(pProxy->bounds.maxX / cellSize);
+  pProxy->cellMaxY = (int)floor(pProxy->bounds.maxY / cellSize);
+  pProxy->layer = pProxy->pModel->collisionLayer;
+
+  // Strahlen brauchen nur innerhalb dieser Grenzen zu laufen
+
+  if(pProxy->layer != 0)
+  {
+    this->collisionGrid.minCellX = (pProxy->cellMinX < this->collisionGrid.minCellX) ? pProxy->cellMinX : this->collisionGrid.minCellX;
+    this->collisionGrid.minCellY = (pProxy->cellMinY < this->collisionGrid.minCellY) ? pProxy->cellMinY : this->collisionGrid.minCellY;
+    this->collisionGrid.maxCellX = (pProxy->cellMaxX > this->collisionGrid.maxCellX) ? pProxy->cellMaxX : this->collisionGrid.maxCellX;
+    this->collisionGrid.maxCellY = (pProxy->cellMaxY > this->collisionGrid.maxCellY) ? pProxy->cellMaxY : this->collisionGrid.maxCellY;
+  }
+
+  // ein Eintrag wird in jede seiner Kollisionsebenen einsortiert
+
+  for(uint32_t layer = 0 ; layer < LE_COLL_LAYERS ; layer++)
+  {
+    if(pProxy->layer & (1u << layer))
+    {
+      for(int y = pProxy->cellMinY ; y <= pProxy->cellMaxY ; y++)
+      {
+        for(int x = pProxy->cellMinX ; x <= pProxy->cellMaxX ; x++)
+          {this->collisionGrid.cells[layer][collisionCellKey(x, y)].push_back(pProxy);}
+      }
+    }
+  }
+
+  pProxy->inGrid = LE_TRUE;
+}
+
+void LEMoon::collisionGridRemove(LECollisionProxy * pProxy)
+{
+  unordered_map<uint64_t, vector<LECollisionProxy*>>::iterator cell;
+
+  if(pProxy->inGrid)
+  {
+    for(uint32_t layer = 0 ; layer < LE_COLL_LAYERS ; layer++)
+    {
+      if(!(pProxy->layer & (1u << layer)))
+        {continue;}
+
+      for(int y = pProxy->cellMinY ; y <= pProxy->cellMaxY ; y++)
+      {
+        for(int x = pProxy->cellMinX ; x <= pProxy->cellMaxX ; x++)
+        {
+          cell = this->collisionGrid.cells[layer].find(collisionCellKey(x, y));
+
+          if(cell != this->collisionGrid.cells[layer].end())
+          {
+            for(size_t i = 0 ; i < cell->second.size() ; i++)
+            {
+              if(cell->second[i] == pProxy)
+              {
+                cell->second[i] = cell->second.back();
+                cell->second.pop_back();
+                break;
+              }
+            }
+
+            if(cell->second.empty())
+              {this->collisionGrid.cells[layer].erase(cell);}
+          }
+        }
+      }
+    }
+
+    pProxy->inGrid = LE_FALSE;
+  }
+
+  // nicht mehr vormerken
+
+  if(pProxy->dirty)
+  {
+    for(size_t i = 0 ; i < this->collisionGrid.dirtyProxies.size() ; i++)
+    {
+      if(this->collisionGrid.dirtyProxies[i] == pProxy)
+      {
+        this->collisionGrid.dirtyProxies[i] = this->collisionGrid.dirtyProxies.back();
+        this->collisionGrid.dirtyProxies.pop_back();
+        break;
+      }
+    }
+
+    pProxy->dirty = LE_FALSE;
+  }
+}
+
+void LEMoon::collisionGridUpdate()
+{
+  LECollisionProxy * pProxy = nullptr;
+  AABB_d bounds;
+  double cellSize = (double) this->collisionGrid.cellSize;
+
+  for(size_t i = 0 ; i < this->collisionGrid.dirtyProxies.size() ; i++)
+  {
+    pProxy = this->collisionGrid.dirtyProxies[i];
+    pProxy->dirty = LE_FALSE;
+
+    // belegt das Model noch die selben Zellen, muss nur die Huelle aktualisiert werden
+
+    bounds = this->collisionGetBounds(pProxy);
+
+    if(pProxy->inGrid && pProxy->layer == pProxy->pModel->collisionLayer &&
+       (int)floor(bounds.minX / cellSize) == pProxy->cellMinX && (int)floor(bounds.minY / cellSize) == pProxy->cellMinY &&
+       (int)floor(bounds.maxX / cellSize) == pProxy->cellMaxX && (int)floor(bounds.maxY / cellSize) == pProxy->cellMaxY)
+      {pProxy->bounds = bounds;}
+    else
+    {
+      this->collisionGridRemove(pProxy);
+      this->collisionGridInsert(pProxy);
+    }
+  }
+
+  this->collisionGrid.dirtyProxies.clear();
+}
+
+bool LEMoon::collisionLayersMatch(LEModel * pModel, LEModel * pForeignModel)
+{
+  return (pModel->collisionLayer & pForeignModel->collisionMask) && (pForeignModel->collisionLayer & pModel->collisionMask);
+}
+
+void LEMoon::collisionMarkDirty(LECollisionProxy * pProxy)
+{
+  unordered_map<uint32_t, LECollisionProxy>::iterator clone;
+
+  if(!pProxy->dirty)
+  {
+    pProxy->dirty = LE_TRUE;
+    this->collisionGrid.dirtyProxies.push_back(pProxy);
+  }
+
+  // Clones teilen Groesse, Rotation und Kollisionsbereiche mit dem Model und werden mit ihm neu einsortiert
+
+  if(pProxy->pClone == nullptr)
+  {
+    for(clone = pProxy->pModel->cloneProxies.begin() ; clone != pProxy->pModel->cloneProxies.end() ; clone++)
+      {this->collisionMarkDirty(&clone->second);}
+
+    this->contactMarkChanged(pProxy->pModel);
+  }
+}
+
+void LEMoon::collisionQuery(AABB_d bounds, uint32_t mask, vector<LECollisionProxy*> &candidates)
+{
+  double cellSize = (double) this->collisionGrid.cellSize;
+  int cellMinX = (int)floor(bounds.minX / cellSize);
+  int cellMinY = (int)floor(bounds.minY / cellSize);
+  int cellMaxX = (int)floor(bounds.maxX / cellSize);
+  int cellMaxY = (int)floor(bounds.maxY / cellSize);
+
+  this->collisionGridUpdate();
+  this->collisionGrid.queryStamp++;
+
+  for(int y = cellMinY ; y <= cellMaxY ; y++)
+  {
+    for(int x = cellMinX ; x <= cellMaxX ; x++)
+      {this->collisionQueryCell(x, y, mask, candidates);}
+  }
+}
+
+void LEMoon::collisionQueryCell(int x, int y, uint32_t mask, vector<LECollisionProxy*> &candidates)
+{
+  unordered_map<uint64_t, vector<LECollisionProxy*>>::iterator cell;
+  uint64_t key = collisionCellKey(x, y);
+
+  // Kollisionsebenen ausserhalb der Maske werden gar nicht erst besucht
+
+  for(uint32_t layer = 0 ; layer < LE_COLL_LAYERS ; layer++)
+  {
+    if(!(mask & (1u << layer)) || this->collisionGrid.cells[layer].empty())
+      {continue;}
+
+    cell = this->collisionGrid.cells[layer].find(key);
+
+    if(cell != this->collisionGrid.cells[layer].end())
+    {
+      for(size_t i = 0 ; i < cell->second.size() ; i++)
+      {
+        if(cell->second[i]->queryStamp != this->collisionGrid.queryStamp)
+        {
+          cell->second[i]->queryStamp = this->collisionGrid.queryStamp;
+          candidates.push_back(cell->second[i]);
+        }
+      }
+    }
+  }
+}
+
+void LEMoon::collisionQueryRay(Point_d origin, Point_d direction, double maxDistance, uint32_t maxHits, vector<LECollisionHit> &hits)
+{
+  double length = sqrt(direction.x * direction.x + direction.y * direction.y);
+  double cellSize = (double) this->collisionGrid.cellSize;
+  double tMaxX = HUGE_VAL;
+  double tMaxY = HUGE_VAL;
+  double tDeltaX = HUGE_VAL;
+  double tDeltaY = HUGE_VAL;
+  double tNext = 0.0f;
+  int cellX = (int)floor(origin.x / cellSize);
+  int cellY = (int)floor(origin.y / cellSize);
+  int stepX = 0;
+  int stepY = 0;
+  LECollisionHit hit;
+  vector<LECollisionProxy*> candidates;
+
+  if(length > 0.0f && maxDistance > 0.0f)
+  {
+    direction.x /= length;
+    direction.y /= length;
+
+    this->collisionGridUpdate();
+    this->collisionGrid.queryStamp++;
+
+    // Schrittweiten fuer das Ablaufen der Zellen (Amanatides & Woo)
+
+    if(direction.x > 0.0f)
+    {
+      stepX = 1;
+      tDeltaX = cellSize / direction.x;
+      tMaxX = ((cellX + 1) * cellSize - origin.x) / direction.x;
+    }
+    else if(direction.x < 0.0f)
+    {
+      stepX = -1;
+      tDeltaX = -cellSize / direction.x;
+      tMaxX = (cellX * cellSize - origin.x) / direction.x;
+    }
+
+    if(direction.y > 0.0f)
+    {
+      stepY = 1;
+      tDeltaY = cellSize / direction.y;
+      tMaxY = ((cellY + 1) * cellSize - origin.y) / direction.y;
+    }
+    else if(direction.y < 0.0f)
+    {
+      stepY = -1;
+      tDeltaY = -cellSize / direction.y;
+      tMaxY = (cellY * cellSize - origin.y) / direction.y;
+    }
+
+    while(LE_TRUE)
+    {
+      // ausserhalb der je belegten Zellen und in Gegenrichtung gibt es nichts mehr zu treffen, auch ohne Reichweitenbegrenzung
+
+      if((cellX > this->collisionGrid.maxCellX && stepX >= 0) || (cellX < this->collisionGrid.minCellX && stepX <= 0) ||
+         (cellY > this->collisionGrid.maxCellY && stepY >= 0) || (cellY < this->collisionGrid.minCellY && stepY <= 0))
+        {break;}
+
+      candidates.clear();
+      this->collisionQueryCell(cellX, cellY, LE_COLL_MASK_ALL, candidates);
+
+      for(size_t i = 0 ; i < candidates.size() ; i++)
+      {
+        if(candidates[i]->pClone == nullptr && this->modelHitRay(candidates[i]->pModel, origin, direction, maxDistance, &hit.distance))
+        {
+          hit.pModel = candidates[i]->pModel;
+          hits.insert(upper_bound(hits.begin(), hits.end(), hit, collisionHitCloser), hit);
+        }
+      }
+
+      // Treffer in spaeteren Zellen koennen nicht naeher sein als der Eintritt in die naechste Zelle
+
+      tNext = (tMaxX < tMaxY) ? tMaxX : tMaxY;
+
+      if(tNext > maxDistance || (maxHits > 0 && hits.size() >= maxHits && hits[maxHits - 1].distance <= tNext))
+        {break;}
+
+      if(tMaxX < tMaxY)
+      {
+        cellX += stepX;
+        tMaxX += tDeltaX;
+      }
+      else
+      {
+        cellY += stepY;
+        tMaxY += tDeltaY;
+      }
+    }
+
+    if(maxHits > 0 && hits.size() > maxHits)
+      {hits.resize(maxHits);}
+  }
+}
+
+void LEMoon::collisionQueryShared(AABB_d bounds, uint32_t mask, vector<LECollisionProxy*> &candidates)
+{
+  unordered_map<uint64_t, vector<LECollisionProxy*>>::const_iterator cell;
+  double cellSize = (double) this->collisionGrid.cellSize;
+  int cellMinX = (int)floor(bounds.minX / cellSize);
+  int cellMinY = (int)floor(bounds.minY / cellSize);
+  int cellMaxX = (int)floor(bounds.maxX / cellSize);
+  int cellMaxY = (int)floor(bounds.maxY / cellSize);
+
+  for(uint32_t layer = 0 ; layer < LE_COLL_LAYERS ; layer++)
+  {
+    if(!(mask & (1u << layer)) || this->collisionGrid.cells[layer].empty())
+      {continue;}
+
+    for(int y = cellMinY ; y <= cellMaxY ; y++)
+    {
+      for(int x = cellMinX ; x <= cellMaxX ; x++)
+      {
+        cell = this->collisionGrid.cells[layer].find(collisionCellKey(x, y));
+
+        if(cell != this->collisionGrid.cells[layer].end())
+          {candidates.insert(candidates.end(), cell->second.begin(), cell->second.end());}
+      }
+    }
+  }
+
+  // ohne queryStamp werden doppelte Eintraege nachtraeglich entfernt
+
+  sort(candidates.begin(), candidates.end());
+  candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public collision
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+uint32_t LEMoon::collisionGetPairs(LECollisionPair * pPairs, uint32_t maxPairs)
+{
+  uint32_t amount = 0;
+  LEModel * pCurrent = nullptr;
+  unordered_map<uint32_t, LECollisionProxy>::iterator clone;
+  vector<LECollisionProxy*> proxies;
+  vector<LECollisionProxyPair> proxyPairs;
+  vector<LECollisionPair> sortedPairs;
+
+  if(this->pModelHead != nullptr)
+  {
+    pCurrent = this->pModelHead->pRight;
+
+    while(pCurrent != this->pModelHead)
+    {
+      proxies.push_back(&pCurrent->proxy);
+
+      for(clone = pCurrent->cloneProxies.begin() ; clone != pCurrent->cloneProxies.end() ; clone++)
+        {proxies.push_back(&clone->second);}
+
+      pCurrent = pCurrent->pRight;
+    }
+
+    this->collisionFindPairs(proxies, LE_TRUE, proxyPairs);
+
+    // der Eintrag mit der kleineren ID steht vorne
+
+    for(size_t i = 0 ; i < proxyPairs.size() ; i++)
+    {
+      if(collisionProxyLess(proxyPairs[i].pProxy, proxyPairs[i].pForeignProxy))
+        {sortedPairs.push_back(collisionMakePair(proxyPairs[i].pProxy, proxyPairs[i].pForeignProxy));}
+      else
+        {sortedPairs.push_back(collisionMakePair(proxyPairs[i].pForeignProxy, proxyPairs[i].pProxy));}
+    }
+
+    sort(sortedPairs.begin(), sortedPairs.end(), collisionPairLess);
+
+    for(size_t i = 0 ; i < sortedPairs.size() && amount < maxPairs ; i++)
+    {
+      if(pPairs != nullptr)
+        {pPairs[amount] = sortedPairs[i];}
+
+      amount++;
+    }
+  }
+
+  return amount;
+}
+
+int LEMoon::collisionSetCellSize(int cellSize)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pCurrent = nullptr;
+  unordered_map<uint32_t, LECollisionProxy>::iterator clone;
+
+  if(cellSize > 0)
+  {
+    this->collisionGrid.cellSize = cellSize;
+
+    for(uint32_t layer = 0 ; layer < LE_COLL_LAYERS ; layer++)
+      {this->collisionGrid.cells[layer].clear();}
+
+    this->collisionGrid.dirtyProxies.clear();
+    this->collisionGrid.minCellX = INT_MAX;
+    this->collisionGrid.minCellY = INT_MAX;
+    this->collisionGrid.maxCellX = INT_MIN;
+    this->collisionGrid.maxCellY = INT_MIN;
+
+    if(this->pModelHead != nullptr)
+    {
+      pCurrent = this->pModelHead->pRight;
+
+      while(pCurrent != this->pModelHead)
+      {
+        pCurrent->proxy.inGrid = LE_FALSE;
+        pCurrent->proxy.dirty = LE_FALSE;
+
+        for(clone = pCurrent->cloneProxies.begin() ; clone != pCurrent->cloneProxies.end() ; clone++)
+        {
+          clone->second.inGrid = LE_FALSE;
+          clone->second.dirty = LE_FALSE;
+        }
+
+        this->collisionMarkDirty(&pCurrent->proxy);
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::collisionSetCellSize(%d)\n\n", cellSize);
+      this->printErrorDialog(LE_COLL_CELL_SIZE, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_COLL_CELL_SIZE;
+  }
+
+  return result;
+}
@@ -0,0 +1,193 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+
+  NOTES:              nur veraenderte Models werden neu geprueft, Paare aus unveraenderten Models bleiben ohne Pruefung bestehen
+*/
+
+#include "../include/le_moon.h"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private contact
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static uint64_t contactPairKey(uint32_t idModel, uint32_t idForeignModel)
+{
+  return (idModel < idForeignModel) ? ((uint64_t)idModel << 32) | idForeignModel : ((uint64_t)idForeignModel << 32) | idModel;
+}
+
+static bool contactLess(const LEContact &contactA, const LEContact &contactB)
+{
+  return (contactA.idModel != contactB.idModel) ? contactA.idModel < contactB.idModel : contactA.idForeignModel < contactB.idForeignModel;
+}
+
+static void contactPush(vector<LEContact> &contacts, LEContactPair &pair, uint8_t state)
+{
+  LEContact contact = {pair.pModel->id, pair.pForeignModel->id, state};
+
+  contacts.push_back(contact);
+}
+
+void LEMoon::contactConstructor()
+{
+  this->contactCache.enabled = LE_FALSE;
+  this->contactCache.frame = 1;
+}
+
+void LEMoon::contactMarkChanged(LEModel * pModel)
+{
+  if(this->contactCache.enabled && pModel->contactFrame != this->contactCache.frame)
+  {
+    pModel->contactFrame = this->contactCache.frame;
+    this->contactCache.changedModels.push_back(pModel);
+  }
+}
+
+void LEMoon::contactRemoveModel(LEModel * pModel)
+{
+  unordered_map<uint64_t, LEContactPair>::iterator pair = this->contactCache.pairs.begin();
+
+  while(pair != this->contactCache.pairs.end())
+  {
+    if(pair->second.pModel == pModel || pair->second.pForeignModel == pModel)
+    {
+      contactPush(this->contactCache.pendingContacts, pair->second, LE_CONTACT_END);
+      pair = this->contactCache.pairs.erase(pair);
+    }
+    else
+      {pair++;}
+  }
+
+  for(size_t i = 0 ; i < this->contactCache.changedModels.size() ; i++)
+  {
+    if(this->contactCache.changedModels[i] == pModel)
+    {
+      this->contactCache.changedModels.erase(this->contactCache.changedModels.begin() + i);
+      break;
+    }
+  }
+}
+
+void LEMoon::contactUpdate()
+{
+  uint32_t frame = this->contactCache.frame;
+  LEContactPair newPair;
+  LEModel * pModel = nullptr;
+  LEModel * pForeignModel = nullptr;
+  vector<LECollisionProxy*> proxies;
+  vector<LECollisionProxyPair> touching;
+  unordered_map<uint64_t, LEContactPair>::iterator pair;
+
+  this->contactCache.contacts.swap(this->contactCache.pendingContacts);
+  this->contactCache.pendingContacts.clear();
+
+  // nur Paare mit mindestens einem veraenderten Model werden neu geprueft, verteilt auf die Arbeitsthreads, Clones erzeugen keine Kontaktereignisse
+
+  for(size_t i = 0 ; i < this->contactCache.changedModels.size() ; i++)
+    {proxies.push_back(&this->contactCache.changedModels[i]->proxy);}
+
+  this->collisionFindPairs(proxies, LE_FALSE, touching);
+
+  for(size_t i = 0 ; i < touching.size() ; i++)
+  {
+    pModel = touching[i].pProxy->pModel;
+    pForeignModel = touching[i].pForeignProxy->pModel;
+    pair = this->contactCache.pairs.find(contactPairKey(pModel->id, pForeignModel->id));
+
+    if(pair == this->contactCache.pairs.end())
+    {
+      newPair.pModel = (pModel->id < pForeignModel->id) ? pModel : pForeignModel;
+      newPair.pForeignModel = (pModel->id < pForeignModel->id) ? pForeignModel : pModel;
+      newPair.checkFrame = frame;
+      newPair.isNew = LE_TRUE;
+      this->contactCache.pairs[contactPairKey(pModel->id, pForeignModel->id)] = newPair;
+    }
+    else
+      {pair->second.checkFrame = frame;}
+  }
+
+  // Ereignisse erzeugen, Paare veraenderter Models ohne Treffer sind beendet
+
+  pair = this->contactCache.pairs.begin();
+
+  while(pair != this->contactCache.pairs.end())
+  {
+    if(pair->second.checkFrame == frame)
+    {
+      contactPush(this->contactCache.contacts, pair->second, pair->second.isNew ? LE_CONTACT_BEGIN : LE_CONTACT_STAY);
+      pair->second.isNew = LE_FALSE;
+      pair++;
+    }
+    else if(pair->second.pModel->contactFrame == frame || pair->second.pForeignModel->contactFrame == frame)
+    {
+      contactPush(this->contactCache.contacts, pair->second, LE_CONTACT_END);
+      pair = this->contactCache.pairs.erase(pair);
+    }
+    else
+    {
+      contactPush(this->contactCache.contacts, pair->second, LE_CONTACT_STAY);
+      pair++;
+    }
+  }
+
+  // feste Reihenfolge, unabhaengig von der Reihenfolge in der Hashtabelle
+
+  sort(this->contactCache.contacts.begin(), this->contactCache.contacts.end(), contactLess);
+  this->contactCache.changedModels.clear();
+  this->contactCache.frame++;
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public contact
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+uint32_t LEMoon::contactGetList(LEContact * pContacts, uint32_t maxContacts)
+{
+  uint32_t amount = 0;
+
+  for(size_t i = 0 ; i < this->contactCache.contacts.size() && amount < maxContacts ; i++)
+  {
+    if(pContacts != nullptr)
+      {pContacts[amount] = this->contactCache.contacts[i];}
+
+    amount++;
+  }
+
+  return amount;
+}
+
+void LEMoon::contactSetEnabled(bool enabled)
+{
+  LEModel * pCurrent = nullptr;
+
+  if(enabled != this->contactCache.enabled)
+  {
+    this->contactCache.enabled = enabled;
+    this->contactCache.pairs.clear();
+    this->contactCache.changedModels.clear();
+    this->contactCache.contacts.clear();
+    this->contactCache.pendingContacts.clear();
+    this->contactCache.frame++;
+
+    // beim Einschalten werden alle Models einmal komplett geprueft
+
+    if(enabled && this->pModelHead != nullptr)
+    {
+      pCurrent = this->pModelHead->pRight;
+
+      while(pCurrent != this->pModelHead)
+      {
+        this->contactMarkChanged(pCurrent);
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+}
@@ -1,430 +1,1225 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
-  date:               11.04.2018
-  updated:            18.04.2018
-*/
-
-#include "../include/le_moon.h"
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// private font
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-LEFont * LEMoon::fontGet(uint32_t id)
-{
-  this->mtxFont.originalList.lock();
-  LEFont * pRet = nullptr;
-  LEFont * pCurrent = nullptr;
-
-  // try original font list
-
-  if(this->pFontHead != nullptr)
-  {
-    if(this->memory.pLastFont != nullptr && this->memory.pLastFont->id == id)
-      {pRet = this->memory.pLastFont;}
-    else
-    {
-      pCurrent = this->pFontHead->pRight;
-
-      while(pCurrent != this->pFontHead)
-      {
-        if(pCurrent->id == id)
-        {
-          pRet = pCurrent;
-          this->memory.pLastFont = pCurrent;
-          break;
-        }
-
-        pCurrent = pCurrent->pRight;
-      }
-    }
-  }
-
-  this->mtxFont.originalList.unlock();
-  return pRet;
-}
-
-LEFont * LEMoon::fontGetFromBuffer(uint32_t id)
-{
-  this->mtxFont.bufferList.lock();
-  LEFont * pRet = nullptr;
-  LEFont * pCurrent = nullptr;
-
-  // try buffer font list
-  
-  if(this->pFontHeadBuffer != nullptr)
-  {
-    if(this->memory.pLastFont != nullptr && this->memory.pLastFont->id == id)
-      {pRet = this->memory.pLastFont;}
-    else
-    {
-      pCurrent = this->pFontHeadBuffer->pRight;
-
-      while(pCurrent != this->pFontHeadBuffer)
-      {
-        if(pCurrent->id == id)
-        {
-          pRet = pCurrent;
-          this->memory.pLastFont = pCurrent;
-          break;
-        }
-
-        pCurrent = pCurrent->pRight;
-      }
-    }
-  }
-
-  this->mtxFont.bufferList.unlock();
-  return pRet;
-}
-
-void LEMoon::fontCleanList()
-{
-  LEFont * pCurrent = nullptr;
-  LEFont * pNext = nullptr;
-
-  if(this->pFontHead != nullptr)
-  {
-    pCurrent = this->pFontHead->pRight;
-
-    while(pCurrent != this->pFontHead)
-    {
-      pNext = pCurrent->pRight;
-
-      if(pCurrent->markedAsDelete)
-      {
-        pCurrent->pRight->pLeft = pCurrent->pLeft;
-        pCurrent->pLeft->pRight = pCurrent->pRight;
-
-        if(pCurrent->pFont != nullptr)
-          {TTF_CloseFont(pCurrent->pFont);}
-
-        delete pCurrent;
-      }
-
-      pCurrent = pNext;
-    }
-  }
-}
-
-void LEMoon::fontCleanBufferList()
-{
-  LEFont * pCurrent = nullptr;
-  LEFont * pNext = nullptr;
-
-  if(this->pFontHeadBuffer != nullptr)
-  {
-    pCurrent = this->pFontHeadBuffer->pRight;
-
-    while(pCurrent != this->pFontHeadBuffer)
-    {
-      pNext = pCurrent->pRight;
-
-      if(pCurrent->markedAsDelete)
-      {
-        pCurrent->pRight->pLeft = pCurrent->pLeft;
-        pCurrent->pLeft->pRight = pCurrent->pRight;
-
-        if(pCurrent->pFont != nullptr)
-          {TTF_CloseFont(pCurrent->pFont);}
-
-        delete pCurrent;
-      }
-
-      pCurrent = pNext;
-    }
-  }
-}
-
-void LEMoon::fontDeleteBufferList()
-{
-  if(this->pFontHeadBuffer != nullptr)
-  {
-    this->pFontHeadBuffer->pLeft = this->pFontHeadBuffer;
-    this->pFontHeadBuffer->pRight = this->pFontHeadBuffer;
-    delete this->pFontHeadBuffer;
-    this->pFontHeadBuffer = nullptr;
-  }
-}
-
-int LEMoon::fontMerge()
-{
-  int result = LE_NO_ERROR;
-  bool lockedAll = LE_FALSE;
-
-  if(this->notifyFont.notifyByEngine && !this->notifyFont.notifyByUser)
-  {
-    // lock all
-
-    if(this->mtxFont.fontCreateTTF.try_lock())
-      {this->mtxFont.fontCreateTTFLockedByMerge = LE_TRUE;}
-    if(this->mtxFont.fontDelete.try_lock())
-      {this->mtxFont.fontDeleteLockedByMerge = LE_TRUE;}
-
-    lockedAll = this->mtxFont.fontCreateTTFLockedByMerge && this->mtxFont.fontDeleteLockedByMerge;
-
-    // delete (from both list), merge(buffer to original) and delete buffer
-
-    if(lockedAll)
-    {
-      this->fontCleanList();
-      this->fontCleanBufferList();
-      this->fontMergeLists();
-      this->fontDeleteBufferList();
-      this->memory.pLastFont = nullptr;
-      this->notifyFont.notifyByEngine = LE_FALSE;
-    }
-
-    // unlock all
-
-    if(this->mtxFont.fontCreateTTFLockedByMerge)
-      {this->mtxFont.fontCreateTTF.unlock();}
-    if(this->mtxFont.fontDeleteLockedByMerge)
-      {this->mtxFont.fontDelete.unlock();}
-
-    this->mtxFont.fontCreateTTFLockedByMerge = LE_FALSE;
-    this->mtxFont.fontDeleteLockedByMerge = LE_FALSE;
-  }
-
-  return result;
-}
-
-void LEMoon::fontConstructor()
-{
-  this->pFontHead = nullptr;
-  this->pFontHeadBuffer = nullptr;
-
-  this->notifyFont.notifyByEngine = LE_FALSE;
-  this->notifyFont.notifyByUser = LE_FALSE;
-
-  this->mtxFont.fontCreateTTFLockedByMerge = LE_FALSE;
-  this->mtxFont.fontDeleteLockedByMerge = LE_FALSE;
-}
-
-void LEMoon::fontMergeLists()
-{
-  LEFont * pCurrent = nullptr;
-  LEFont * pNext = nullptr;
-
-  if(this->pFontHeadBuffer != nullptr)
-  {
-    pCurrent = this->pFontHeadBuffer->pRight;
-
-    while(pCurrent != this->pFontHeadBuffer)
-    {
-      pNext = pCurrent->pRight;
-      pCurrent->pRight = this->pFontHead;
-      pCurrent->pLeft = this->pFontHead->pLeft;
-      this->pFontHead->pLeft->pRight = pCurrent;
-      this->pFontHead->pLeft = pCurrent;
-      pCurrent = pNext;
-    }
-  }
-}
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// public font
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::fontCreateTTF(uint32_t id, const char * pFile, int fontSize)
-{
-  this->mtxFont.fontCreateTTF.lock();
-  int result = LE_NO_ERROR;
-  LEFont * pNew = this->fontGet(id);
-
-  if(pNew == nullptr)
-    {pNew = this->fontGetFromBuffer(id);}
-
-  if(pNew == nullptr)
-  {
-    this->mtxFont.originalList.lock();
-
-    if(this->pFontHead == nullptr)
-    {
-      this->pFontHead = new LEFont;
-      this->pFontHead->pLeft = this->pFontHead;
-      this->pFontHead->pRight = this->pFontHead;
-      this->pFontHead->id = 1989;
-    }
-
-    this->mtxFont.originalList.unlock();
-    this->mtxFont.bufferList.lock();
-
-    if(this->pFontHeadBuffer == nullptr)
-    {
-      this->pFontHeadBuffer = new LEFont;
-      this->pFontHeadBuffer->pLeft = this->pFontHeadBuffer;
-      this->pFontHeadBuffer->pRight = this->pFontHeadBuffer;
-      this->pFontHeadBuffer->id = 28092017;
-    }
-
-    pNew = new LEFont;
-    pNew->pLeft = this->pFontHeadBuffer->pLeft;
-    pNew->pRight = this->pFontHeadBuffer;
-    this->pFontHeadBuffer->pLeft->pRight = pNew;
-    this->pFontHeadBuffer->pLeft = pNew;
-    pNew->id = id;
-    pNew->markedAsDelete = LE_FALSE;
-    pNew->pFont = TTF_OpenFont(pFile, fontSize);
-
-    if(pNew->pFont == nullptr)
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::fontCreateTTF(%u, %s, %d)\n\n", id, pFile, fontSize);
-        this->printErrorDialog(LE_OPEN_FONT, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_OPEN_FONT;
-    }
-
-    this->mtxFont.bufferList.unlock();
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::fontCreateTTF(%u)\n\n", id);
-      this->printErrorDialog(LE_FONT_EXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_FONT_EXIST;
-  }
-
-  if(!result)
-    {this->notifyFont.notifyByEngine = LE_TRUE;}
-
-  this->mtxFont.fontCreateTTF.unlock();
-  return result;
-}
-
-int LEMoon::fontDelete(uint32_t id)
-{
-  this->mtxFont.fontDelete.lock();
-  int result = LE_NO_ERROR;
-  LEFont * pFont = this->fontGet(id);
-
-  if(pFont == nullptr)
-    {pFont = this->fontGetFromBuffer(id);}
-
-  if(pFont != nullptr)
-    {pFont->markedAsDelete = LE_TRUE;}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::fontDelete(%u)\n\n", id);
-      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_FONT_NOEXIST;
-  }
-
-  if(!result)
-    {this->notifyFont.notifyByEngine = LE_TRUE;}
-
-  this->mtxFont.fontDelete.unlock();
-  return result;
-}
-
-void LEMoon::fontPrintList()
-{
-  this->mtxFont.fontPrintList.lock();
-  this->mtxFont.originalList.lock();
-  LEFont * pCurrent = nullptr;
-
-  if(this->pFontHead != nullptr)
-  {
-    pCurrent = this->pFontHead->pRight;
-
-    if(pCurrent != nullptr)
-    {
-      printf("ORIGINAL: Head: %d", this->pFontHead->id);
-
-      while(pCurrent != this->pFontHead)
-      {
-        printf(" <-> %d", pCurrent->id);
-        pCurrent = pCurrent->pRight;
-      }
-
-      printf(" <-> Head: %d\n", this->pFontHead->id);
-    }
-  }
-
-  this->mtxFont.originalList.unlock();
-  this->mtxFont.fontPrintList.unlock();
-}
-
-void LEMoon::fontPrintBufferList()
-{
-  this->mtxFont.fontPrintBufferList.lock();
-  this->mtxFont.bufferList.lock();
-  LEFont * pCurrent = nullptr;
-
-  if(this->pFontHeadBuffer != nullptr)
-  {
-    pCurrent = this->pFontHeadBuffer->pRight;
-
-    if(pCurrent != nullptr)
-    {
-      printf("BUFFER: Head: %d", this->pFontHeadBuffer->id);
-
-      while(pCurrent != this->pFontHeadBuffer)
-      {
-        printf(" <-> %d", pCurrent->id);
-        pCurrent = pCurrent->pRight;
-      }
-
-      printf(" <-> Head: %d\n", this->pFontHeadBuffer->id);
-    }
-  }
-
-  this->mtxFont.bufferList.unlock();
-  this->mtxFont.fontPrintBufferList.unlock();
-}
-
-int LEMoon::fontSetStyle(uint32_t id, int style)
-{
-  this->mtxFont.fontSetStyle.lock();
-  int result = LE_NO_ERROR;
-  LEFont * pFont = this->fontGet(id);
-
-  if(pFont == nullptr)
-    {pFont = this->fontGetFromBuffer(id);}
-
-  if(pFont != nullptr)
-  {
-    if(pFont->pFont != nullptr)
-      {TTF_SetFontStyle(pFont->pFont, style);}
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::fontSetStyle(%u)\n\n", id);
-      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_FONT_NOEXIST;
-  }
-
-  this->mtxFont.fontSetStyle.unlock();
-  return result;
-}
-
-void LEMoon::fontUsingThread(bool flag)
-{
-  this->mtxFont.fontUsingThread.lock();
-  this->notifyFont.notifyByUser = flag;
-  this->mtxFont.fontUsingThread.unlock();
-}
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               11.04.2018
+  updated:            19.10.2026
+*/
+
+#include "../include/le_moon.h"
+#include <string.h>
+
+#define LE_FONT_ATLAS_WIDTH             512
+#define LE_FONT_ATLAS_HEIGHT            128                       // Anfangshoehe, der Atlas waechst in Zweierpotenzen
+#define LE_FONT_ATLAS_MAX_HEIGHT        4096
+#define LE_FONT_ATLAS_PADDING           1                         // Abstand zwischen Glyphen, damit beim Skalieren keine Nachbarpixel durchscheinen
+#define LE_FONT_PREWARM_ASCII           " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private font
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+LEFont * LEMoon::fontGet(uint32_t id)
+{
+  this->mtxFont.originalList.lock();
+  LEFont * pRet = nullptr;
+  LEFont * pCurrent = nullptr;
+
+  // try original font list
+
+  if(this->pFontHead != nullptr)
+  {
+    if(this->memory.pLastFont != nullptr && this->memory.pLastFont->id == id)
+      {pRet = this->memory.pLastFont;}
+    else
+    {
+      pCurrent = this->pFontHead->pRight;
+
+      while(pCurrent != this->pFontHead)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastFont = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  this->mtxFont.originalList.unlock();
+  return pRet;
+}
+
+LEFont * LEMoon::fontGetFromBuffer(uint32_t id)
+{
+  this->mtxFont.bufferList.lock();
+  LEFont * pRet = nullptr;
+  LEFont * pCurrent = nullptr;
+
+  // try buffer font list
+  
+  if(this->pFontHeadBuffer != nullptr)
+  {
+    if(this->memory.pLastFont != nullptr && this->memory.pLastFont->id == id)
+      {pRet = this->memory.pLastFont;}
+    else
+    {
+      pCurrent = this->pFontHeadBuffer->pRight;
+
+      while(pCurrent != this->pFontHeadBuffer)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastFont = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  this->mtxFont.bufferList.unlock();
+  return pRet;
+}
+
+static int fontBitmapValue(const string & line, const char * pKey)
+{
+  size_t position = line.find(string(" ") + pKey + "=");
+
+  return (position != string::npos) ? atoi(line.c_str() + position + strlen(pKey) + 2) : 0;
+}
+
+static string fontBitmapString(const string & line, const char * pKey)
+{
+  size_t position = line.find(string(" ") + pKey + "=\"");
+  size_t end = 0;
+  string value;
+
+  if(position != string::npos)
+  {
+    position += strlen(pKey) + 3;
+    end = line.find('"', position);
+
+    if(end != string::npos)
+      {value = line.substr(position, end - position);}
+  }
+
+  return value;
+}
+
+static uint32_t fontBitmapRead(const unsigned char * pData, int bytes)
+{
+  uint32_t value = 0;
+
+  // BMFont speichert binaer in Little Endian
+
+  for(int i = bytes - 1 ; i >= 0 ; i--)
+    {value = (value << 8) | pData[i];}
+
+  return value;
+}
+
+static void fontBitmapAddGlyph(LEFont * pFont, uint32_t id, int x, int y, int width, int height, int offsetX, int offsetY, int advance, int page)
+{
+  LEGlyph glyph;
+
+  // die Glyphen werden wie beim Glyphenatlas ueber UCS-2 gesucht
+
+  if(id <= 0xFFFF)
+  {
+    glyph.srcRect = {x, y, (height > 0) ? width : 0, height};
+    glyph.advance = advance;
+    glyph.offsetX = offsetX;
+    glyph.offsetY = offsetY;
+    glyph.page = (uint8_t) page;
+    pFont->atlas.glyphs[(uint16_t) id] = glyph;
+  }
+}
+
+static void fontBitmapAddKerning(LEFont * pFont, uint32_t first, uint32_t second, int amount)
+{
+  if(first <= 0xFFFF && second <= 0xFFFF)
+    {pFont->bitmap.kerning[(first << 16) | second] = amount;}
+}
+
+void LEMoon::fontCleanList()
+{
+  LEFont * pCurrent = nullptr;
+  LEFont * pNext = nullptr;
+
+  if(this->pFontHead != nullptr)
+  {
+    pCurrent = this->pFontHead->pRight;
+
+    while(pCurrent != this->pFontHead)
+    {
+      pNext = pCurrent->pRight;
+
+      if(pCurrent->markedAsDelete)
+      {
+        pCurrent->pRight->pLeft = pCurrent->pLeft;
+        pCurrent->pLeft->pRight = pCurrent->pRight;
+
+        if(pCurrent->pHandle != nullptr)
+          {this->fontReleaseHandle(pCurrent->pHandle);}
+
+        this->fontDestroyAtlas(pCurrent);
+        delete pCurrent;
+      }
+
+      pCurrent = pNext;
+    }
+  }
+}
+
+void LEMoon::fontCleanBufferList()
+{
+  LEFont * pCurrent = nullptr;
+  LEFont * pNext = nullptr;
+
+  if(this->pFontHeadBuffer != nullptr)
+  {
+    pCurrent = this->pFontHeadBuffer->pRight;
+
+    while(pCurrent != this->pFontHeadBuffer)
+    {
+      pNext = pCurrent->pRight;
+
+      if(pCurrent->markedAsDelete)
+      {
+        pCurrent->pRight->pLeft = pCurrent->pLeft;
+        pCurrent->pLeft->pRight = pCurrent->pRight;
+
+        if(pCurrent->pHandle != nullptr)
+          {this->fontReleaseHandle(pCurrent->pHandle);}
+
+        this->fontDestroyAtlas(pCurrent);
+        delete pCurrent;
+      }
+
+      pCurrent = pNext;
+    }
+  }
+}
+
+void LEMoon::fontDeleteBufferList()
+{
+  if(this->pFontHeadBuffer != nullptr)
+  {
+    this->pFontHeadBuffer->pLeft = this->pFontHeadBuffer;
+    this->pFontHeadBuffer->pRight = this->pFontHeadBuffer;
+    delete this->pFontHeadBuffer;
+    this->pFontHeadBuffer = nullptr;
+  }
+}
+
+int LEMoon::fontMerge()
+{
+  int result = LE_NO_ERROR;
+  bool lockedAll = LE_FALSE;
+
+  if(this->notifyFont.notifyByEngine && !this->notifyFont.notifyByUser)
+  {
+    // lock all
+
+    if(this->mtxFont.fontCreateBitmap.try_lock())
+      {this->mtxFont.fontCreateBitmapLockedByMerge = LE_TRUE;}
+    if(this->mtxFont.fontCreateTTF.try_lock())
+      {this->mtxFont.fontCreateTTFLockedByMerge = LE_TRUE;}
+    if(this->mtxFont.fontDelete.try_lock())
+      {this->mtxFont.fontDeleteLockedByMerge = LE_TRUE;}
+
+    lockedAll = this->mtxFont.fontCreateBitmapLockedByMerge && this->mtxFont.fontCreateTTFLockedByMerge && this->mtxFont.fontDeleteLockedByMerge;
+
+    // delete (from both list), merge(buffer to original) and delete buffer
+
+    if(lockedAll)
+    {
+      this->fontCleanList();
+      this->fontCleanBufferList();
+      this->fontMergeLists();
+      this->fontDeleteBufferList();
+      this->memory.pLastFont = nullptr;
+      this->notifyFont.notifyByEngine = LE_FALSE;
+    }
+
+    // unlock all
+
+    if(this->mtxFont.fontCreateBitmapLockedByMerge)
+      {this->mtxFont.fontCreateBitmap.unlock();}
+    if(this->mtxFont.fontCreateTTFLockedByMerge)
+      {this->mtxFont.fontCreateTTF.unlock();}
+    if(this->mtxFont.fontDeleteLockedByMerge)
+      {this->mtxFont.fontDelete.unlock();}
+
+    this->mtxFont.fontCreateBitmapLockedByMerge = LE_FALSE;
+    this->mtxFont.fontCreateTTFLockedByMerge = LE_FALSE;
+    this->mtxFont.fontDeleteLockedByMerge = LE_FALSE;
+  }
+
+  return result;
+}
+
+void LEMoon::fontConstructor()
+{
+  this->pFontHead = nullptr;
+  this->pFontHeadBuffer = nullptr;
+
+  this->notifyFont.notifyByEngine = LE_FALSE;
+  this->notifyFont.notifyByUser = LE_FALSE;
+
+  this->mtxFont.fontCreateBitmapLockedByMerge = LE_FALSE;
+  this->mtxFont.fontCreateTTFLockedByMerge = LE_FALSE;
+  this->mtxFont.fontDeleteLockedByMerge = LE_FALSE;
+}
+
+void LEMoon::fontDestroyAtlas(LEFont * pFont)
+{
+  if(pFont->atlas.pTexture != nullptr)
+  {
+    SDL_DestroyTexture(pFont->atlas.pTexture);
+    pFont->atlas.pTexture = nullptr;
+  }
+
+  if(pFont->atlas.pSurface != nullptr)
+  {
+    SDL_FreeSurface(pFont->atlas.pSurface);
+    pFont->atlas.pSurface = nullptr;
+  }
+
+  // die Seiten einer Bitmapschrift werden nur beim Loeschen des Fonts freigegeben, ihr Atlas wird nie ungueltig
+
+  for(size_t i = 0 ; i < pFont->bitmap.pages.size() ; i++)
+  {
+    if(pFont->bitmap.pages[i] != nullptr)
+      {SDL_DestroyTexture(pFont->bitmap.pages[i]);}
+  }
+
+  pFont->bitmap.pages.clear();
+  pFont->bitmap.kerning.clear();
+  pFont->atlas.glyphs.clear();
+  pFont->atlas.penX = 0;
+  pFont->atlas.penY = 0;
+  pFont->atlas.rowHeight = 0;
+  pFont->atlas.invalid = LE_FALSE;
+  pFont->atlas.generation++;
+}
+
+int LEMoon::fontGetAdvance(LEFont * pFont, uint16_t character)
+{
+  int advance = 0;
+  unordered_map<uint16_t, int>::iterator cached;
+  unordered_map<uint16_t, LEGlyph>::iterator glyph;
+
+  if(pFont->bitmap.enabled)
+  {
+    glyph = pFont->atlas.glyphs.find(character);
+
+    if(glyph != pFont->atlas.glyphs.end())
+      {advance = glyph->second.advance;}
+  }
+  else if(pFont->pHandle != nullptr)
+  {
+    cached = pFont->pHandle->advances.find(character);
+
+    if(cached != pFont->pHandle->advances.end())
+      {advance = cached->second;}
+    else
+    {
+      pFont->pHandle->mtxRender.lock();
+
+      if(TTF_GlyphMetrics(pFont->pFont, character, nullptr, nullptr, nullptr, nullptr, &advance))
+        {advance = 0;}
+
+      pFont->pHandle->mtxRender.unlock();
+
+      pFont->pHandle->advances[character] = advance;
+    }
+  }
+
+  return advance;
+}
+
+LEGlyph * LEMoon::fontGetGlyph(LEFont * pFont, uint16_t character)
+{
+  LEGlyph * pGlyph = nullptr;
+  LEGlyph glyph;
+  SDL_Surface * pGlyphSurface = nullptr;
+  SDL_Color white = {255, 255, 255, 255};
+  unordered_map<uint16_t, LEGlyph>::iterator cached;
+
+  if(pFont->atlas.invalid)
+    {this->fontDestroyAtlas(pFont);}
+
+  cached = pFont->atlas.glyphs.find(character);
+
+  if(cached != pFont->atlas.glyphs.end())
+    {pGlyph = &cached->second;}
+  else if(pFont->bitmap.enabled)
+  {
+    // Zeichen, die die Bitmapschrift nicht kennt, werden leer und ohne Vorschub gemerkt
+
+    glyph.srcRect = {0, 0, 0, 0};
+    glyph.advance = 0;
+    glyph.offsetX = 0;
+    glyph.offsetY = 0;
+    glyph.page = 0;
+    pGlyph = &(pFont->atlas.glyphs[character] = glyph);
+  }
+  else if(pFont->pHandle != nullptr)
+  {
+    // weiss rastern, die Farbe wird beim Zeichnen ueber SDL_SetTextureColorMod() gesetzt
+
+    glyph.advance = this->fontGetAdvance(pFont, character);
+    glyph.srcRect = {0, 0, 0, 0};
+    glyph.offsetX = 0;
+    glyph.offsetY = 0;
+    glyph.page = 0;
+    pFont->pHandle->mtxRender.lock();
+    pGlyphSurface = TTF_RenderGlyph_Blended(pFont->pFont, character, white);
+    pFont->pHandle->mtxRender.unlock();
+
+    if(pGlyphSurface != nullptr && pGlyphSurface->w <= LE_FONT_ATLAS_WIDTH)
+    {
+      // Regalverfahren: Glyphen nebeneinander, bei voller Zeile in die naechste
+
+      if(pFont->atlas.penX + pGlyphSurface->w > LE_FONT_ATLAS_WIDTH)
+      {
+        pFont->atlas.penX = 0;
+        pFont->atlas.penY += pFont->atlas.rowHeight + LE_FONT_ATLAS_PADDING;
+        pFont->atlas.rowHeight = 0;
+      }
+
+      if(pFont->atlas.pSurface == nullptr || pFont->atlas.penY + pGlyphSurface->h > pFont->atlas.pSurface->h)
+      {
+        if(this->fontGrowAtlas(pFont, pFont->atlas.penY + pGlyphSurface->h))
+        {
+          SDL_FreeSurface(pGlyphSurface);
+          pGlyphSurface = nullptr;
+        }
+      }
+
+      if(pGlyphSurface != nullptr)
+      {
+        glyph.srcRect = {pFont->atlas.penX, pFont->atlas.penY, pGlyphSurface->w, pGlyphSurface->h};
+        SDL_SetSurfaceBlendMode(pGlyphSurface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(pGlyphSurface, nullptr, pFont->atlas.pSurface, &glyph.srcRect);
+        SDL_UpdateTexture(pFont->atlas.pTexture, &glyph.srcRect, (uint8_t*) pFont->atlas.pSurface->pixels + glyph.srcRect.y * pFont->atlas.pSurface->pitch + glyph.srcRect.x * 4, pFont->atlas.pSurface->pitch);
+        SDL_FreeSurface(pGlyphSurface);
+        pFont->atlas.penX += glyph.srcRect.w + LE_FONT_ATLAS_PADDING;
+
+        if(glyph.srcRect.h > pFont->atlas.rowHeight)
+          {pFont->atlas.rowHeight = glyph.srcRect.h;}
+
+        pGlyph = &(pFont->atlas.glyphs[character] = glyph);
+      }
+    }
+    else if(pGlyphSurface == nullptr)
+    {
+      // Glyphen ohne Pixel bestehen nur aus ihrem Vorschub
+
+      pGlyph = &(pFont->atlas.glyphs[character] = glyph);
+    }
+    else
+      {SDL_FreeSurface(pGlyphSurface);}
+  }
+
+  return pGlyph;
+}
+
+int LEMoon::fontGetKerning(LEFont * pFont, uint16_t previous, uint16_t character)
+{
+  int kerning = 0;
+  uint32_t key = ((uint32_t) previous << 16) | character;
+  unordered_map<uint32_t, int>::iterator cached;
+
+  if(pFont->bitmap.enabled)
+  {
+    cached = pFont->bitmap.kerning.find(key);
+
+    if(cached != pFont->bitmap.kerning.end())
+      {kerning = cached->second;}
+  }
+  else if(pFont->pHandle != nullptr && TTF_GetFontKerning(pFont->pFont))
+  {
+    cached = pFont->pHandle->kerning.find(key);
+
+    if(cached != pFont->pHandle->kerning.end())
+      {kerning = cached->second;}
+    else
+    {
+      pFont->pHandle->mtxRender.lock();
+      kerning = TTF_GetFontKerningSizeGlyphs(pFont->pFont, previous, character);
+      pFont->pHandle->mtxRender.unlock();
+      pFont->pHandle->kerning[key] = kerning;
+    }
+  }
+
+  return kerning;
+}
+
+int LEMoon::fontGrowAtlas(LEFont * pFont, int minHeight)
+{
+  int result = LE_NO_ERROR;
+  int height = (pFont->atlas.pSurface != nullptr) ? pFont->atlas.pSurface->h : LE_FONT_ATLAS_HEIGHT;
+  SDL_Surface * pSurface = nullptr;
+  SDL_Texture * pTexture = nullptr;
+
+  while(height < minHeight)
+    {height *= 2;}
+
+  if(height <= LE_FONT_ATLAS_MAX_HEIGHT)
+  {
+    pSurface = SDL_CreateRGBSurfaceWithFormat(0, LE_FONT_ATLAS_WIDTH, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    pTexture = SDL_CreateTexture(this->pRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, LE_FONT_ATLAS_WIDTH, height);
+  }
+
+  if(pSurface != nullptr && pTexture != nullptr)
+  {
+    // die alten Pixel werden an die selbe Stelle kopiert, die Bereiche aller Glyphen bleiben gueltig
+
+    if(pFont->atlas.pSurface != nullptr)
+    {
+      SDL_SetSurfaceBlendMode(pFont->atlas.pSurface, SDL_BLENDMODE_NONE);
+      SDL_BlitSurface(pFont->atlas.pSurface, nullptr, pSurface, nullptr);
+      SDL_FreeSurface(pFont->atlas.pSurface);
+    }
+
+    if(pFont->atlas.pTexture != nullptr)
+      {SDL_DestroyTexture(pFont->atlas.pTexture);}
+
+    SDL_UpdateTexture(pTexture, nullptr, pSurface->pixels, pSurface->pitch);
+    SDL_SetTextureBlendMode(pTexture, SDL_BLENDMODE_BLEND);
+    pFont->atlas.pSurface = pSurface;
+    pFont->atlas.pTexture = pTexture;
+  }
+  else
+  {
+    if(pSurface != nullptr)
+      {SDL_FreeSurface(pSurface);}
+    if(pTexture != nullptr)
+      {SDL_DestroyTexture(pTexture);}
+
+    result = LE_FONT_ATLAS;
+  }
+
+  return result;
+}
+
+int LEMoon::fontLoadBitmap(LEFont * pFont, const char * pFile, const char * pImageFile)
+{
+  int result = LE_NO_ERROR;
+  SDL_RWops * pRW = nullptr;
+  SDL_Surface * pSurface = nullptr;
+  SDL_Texture * pPage = nullptr;
+  Sint64 fileSize = 0;
+  vector<unsigned char> data;
+  vector<string> pageFiles;
+  string path = pFile;
+  string line;
+  size_t position = 0;
+  size_t end = 0;
+  size_t blockSize = 0;
+  int lineHeight = 0;
+  int page = 0;
+  const unsigned char * pBlock = nullptr;
+
+  pRW = SDL_RWFromFile(pFile, "rb");
+
+  if(pRW != nullptr)
+  {
+    fileSize = SDL_RWsize(pRW);
+
+    if(fileSize > 0)
+    {
+      data.resize((size_t) fileSize);
+
+      if(SDL_RWread(pRW, data.data(), 1, data.size()) != data.size())
+        {data.clear();}
+    }
+
+    SDL_RWclose(pRW);
+  }
+
+  if(data.size() >= 4 && data[0] == 'B' && data[1] == 'M' && data[2] == 'F' && data[3] == 3)
+  {
+    // binaeres Format: Bloecke aus Typ (1 Byte), Groesse (4 Byte) und Inhalt
+
+    position = 4;
+
+    while(position + 5 <= data.size())
+    {
+      blockSize = fontBitmapRead(&data[position + 1], 4);
+      pBlock = &data[position + 5];
+
+      if(position + 5 + blockSize > data.size())
+        {break;}
+
+      if(data[position] == 2 && blockSize >= 4)
+        {lineHeight = (int) fontBitmapRead(pBlock, 2);}
+      else if(data[position] == 3)
+      {
+        for(size_t i = 0 ; i < blockSize ; i += strnlen((const char*) pBlock + i, blockSize - i) + 1)
+          {pageFiles.push_back(string((const char*) pBlock + i, strnlen((const char*) pBlock + i, blockSize - i)));}
+      }
+      else if(data[position] == 4)
+      {
+        for(size_t i = 0 ; i + 20 <= blockSize ; i += 20)
+        {
+          fontBitmapAddGlyph(pFont, fontBitmapRead(pBlock + i, 4), (int) fontBitmapRead(pBlock + i + 4, 2), (int) fontBitmapRead(pBlock + i + 6, 2), (int) fontBitmapRead(pBlock + i + 8, 2),
+                             (int) fontBitmapRead(pBlock + i + 10, 2), (int16_t) fontBitmapRead(pBlock + i + 12, 2), (int16_t) fontBitmapRead(pBlock + i + 14, 2),
+                             (int16_t) fontBitmapRead(pBlock + i + 16, 2), pBlock[i + 18]);
+        }
+      }
+      else if(data[position] == 5)
+      {
+        for(size_t i = 0 ; i + 10 <= blockSize ; i += 10)
+          {fontBitmapAddKerning(pFont, fontBitmapRead(pBlock + i, 4), fontBitmapRead(pBlock + i + 4, 4), (int16_t) fontBitmapRead(pBlock + i + 8, 2));}
+      }
+
+      position += 5 + blockSize;
+    }
+  }
+  else
+  {
+    // Textformat: eine Zeile je Eintrag mit Schluessel=Wert Paaren
+
+    while(position < data.size())
+    {
+      end = position;
+
+      while(end < data.size() && data[end] != '\n')
+        {end++;}
+
+      line.assign((const char*) data.data() + position, end - position);
+      position = end + 1;
+
+      if(line.compare(0, 7, "common ") == 0)
+        {lineHeight = fontBitmapValue(line, "lineHeight");}
+      else if(line.compare(0, 5, "page ") == 0)
+      {
+        page = fontBitmapValue(line, "id");
+
+        if(page >= 0 && page < 256)
+        {
+          if((size_t) page >= pageFiles.size())
+            {pageFiles.resize(page + 1);}
+
+          pageFiles[page] = fontBitmapString(line, "file");
+        }
+      }
+      else if(line.compare(0, 5, "char ") == 0)
+      {
+        fontBitmapAddGlyph(pFont, (uint32_t) fontBitmapValue(line, "id"), fontBitmapValue(line, "x"), fontBitmapValue(line, "y"), fontBitmapValue(line, "width"), fontBitmapValue(line, "height"),
+                           fontBitmapValue(line, "xoffset"), fontBitmapValue(line, "yoffset"), fontBitmapValue(line, "xadvance"), fontBitmapValue(line, "page"));
+      }
+      else if(line.compare(0, 8, "kerning ") == 0)
+        {fontBitmapAddKerning(pFont, (uint32_t) fontBitmapValue(line, "first"), (uint32_t) fontBitmapValue(line, "second"), fontBitmapValue(line, "amount"));}
+    }
+  }
+
+  // ein uebergebenes Bild ersetzt die erste Seite, alle anderen Seiten liegen neben dem Descriptor
+
+  if(pImageFile != nullptr)
+  {
+    if(pageFiles.empty())
+      {pageFiles.resize(1);}
+
+    pageFiles[0] = pImageFile;
+  }
+
+  position = path.find_last_of("/\\");
+  path = (position != string::npos) ? path.substr(0, position + 1) : "";
+
+  if(lineHeight <= 0 || pageFiles.empty() || pFont->atlas.glyphs.empty())
+    {result = LE_FONT_BITMAP;}
+
+  for(size_t i = 0 ; i < pageFiles.size() && !result ; i++)
+  {
+    pSurface = IMG_Load((i == 0 && pImageFile != nullptr) ? pImageFile : (path + pageFiles[i]).c_str());
+    pPage = (pSurface != nullptr) ? SDL_CreateTextureFromSurface(this->pRenderer, pSurface) : nullptr;
+
+    if(pSurface != nullptr)
+      {SDL_FreeSurface(pSurface);}
+
+    if(pPage != nullptr)
+    {
+      SDL_SetTextureBlendMode(pPage, SDL_BLENDMODE_BLEND);
+      pFont->bitmap.pages.push_back(pPage);
+    }
+    else
+      {result = LE_FONT_BITMAP;}
+  }
+
+  // Glyphen auf Seiten, die es nicht gibt, werden nicht gezeichnet
+
+  for(unordered_map<uint16_t, LEGlyph>::iterator glyph = pFont->atlas.glyphs.begin() ; glyph != pFont->atlas.glyphs.end() ; glyph++)
+  {
+    if(glyph->second.page >= pFont->bitmap.pages.size())
+      {glyph->second.srcRect.w = 0;}
+  }
+
+  pFont->height = lineHeight;
+  pFont->lineSkip = lineHeight;
+
+  return result;
+}
+
+void LEMoon::fontMergeLists()
+{
+  LEFont * pCurrent = nullptr;
+  LEFont * pNext = nullptr;
+
+  if(this->pFontHeadBuffer != nullptr)
+  {
+    pCurrent = this->pFontHeadBuffer->pRight;
+
+    while(pCurrent != this->pFontHeadBuffer)
+    {
+      pNext = pCurrent->pRight;
+      pCurrent->pRight = this->pFontHead;
+      pCurrent->pLeft = this->pFontHead->pLeft;
+      this->pFontHead->pLeft->pRight = pCurrent;
+      this->pFontHead->pLeft = pCurrent;
+      pCurrent = pNext;
+    }
+  }
+}
+
+LEFontHandle * LEMoon::fontAcquireHandle(const char * pFile, int fontSize, int style, int outline)
+{
+  this->mtxFont.fontCache.lock();
+  LEFontHandle * pHandle = nullptr;
+  LEFontFace * pFace = nullptr;
+  SDL_RWops * pRW = nullptr;
+  Sint64 fileSize = 0;
+  string key = string(pFile) + "|" + to_string(fontSize) + "|" + to_string(style) + "|" + to_string(outline);
+  unordered_map<string, LEFontHandle*>::iterator handle = this->fontHandles.find(key);
+  unordered_map<string, LEFontFace*>::iterator face;
+
+  if(handle != this->fontHandles.end())
+  {
+    pHandle = handle->second;
+    pHandle->refCount++;
+  }
+  else
+  {
+    // die Datei wird nur beim ersten Font eines Pfades gelesen, weitere Groessen oeffnen den Speicher
+
+    face = this->fontFaces.find(pFile);
+
+    if(face != this->fontFaces.end())
+      {pFace = face->second;}
+    else
+    {
+      pRW = SDL_RWFromFile(pFile, "rb");
+
+      if(pRW != nullptr)
+      {
+        fileSize = SDL_RWsize(pRW);
+
+        if(fileSize > 0)
+        {
+          pFace = new LEFontFace;
+          pFace->path = pFile;
+          pFace->size = (size_t) fileSize;
+          pFace->pData = new unsigned char[pFace->size];
+          pFace->refCount = 0;
+
+          if(SDL_RWread(pRW, pFace->pData, 1, pFace->size) == pFace->size)
+            {this->fontFaces[pFace->path] = pFace;}
+          else
+          {
+            delete [] pFace->pData;
+            delete pFace;
+            pFace = nullptr;
+          }
+        }
+
+        SDL_RWclose(pRW);
+      }
+    }
+
+    if(pFace != nullptr)
+    {
+      pHandle = new LEFontHandle;
+      pHandle->key = key;
+      pHandle->pFace = pFace;
+      pHandle->size = fontSize;
+      pHandle->style = style;
+      pHandle->outline = outline;
+      pHandle->refCount = 1;
+      pHandle->pFont = TTF_OpenFontRW(SDL_RWFromConstMem(pFace->pData, (int) pFace->size), 1, fontSize);
+
+      if(pHandle->pFont != nullptr)
+      {
+        if(style != TTF_STYLE_NORMAL)
+          {TTF_SetFontStyle(pHandle->pFont, style);}
+
+        if(outline > 0)
+          {TTF_SetFontOutline(pHandle->pFont, outline);}
+
+        pFace->refCount++;
+        this->fontHandles[key] = pHandle;
+      }
+      else
+      {
+        delete pHandle;
+        pHandle = nullptr;
+
+        if(pFace->refCount == 0)
+        {
+          this->fontFaces.erase(pFace->path);
+          delete [] pFace->pData;
+          delete pFace;
+        }
+      }
+    }
+  }
+
+  this->mtxFont.fontCache.unlock();
+  return pHandle;
+}
+
+LEFont * LEMoon::fontAddToBuffer(uint32_t id)
+{
+  LEFont * pNew = nullptr;
+
+  this->mtxFont.originalList.lock();
+
+  if(this->pFontHead == nullptr)
+  {
+    this->pFontHead = new LEFont;
+    this->pFontHead->pLeft = this->pFontHead;
+    this->pFontHead->pRight = this->pFontHead;
+    this->pFontHead->id = 1989;
+  }
+
+  this->mtxFont.originalList.unlock();
+
+  if(this->pFontHeadBuffer == nullptr)
+  {
+    this->pFontHeadBuffer = new LEFont;
+    this->pFontHeadBuffer->pLeft = this->pFontHeadBuffer;
+    this->pFontHeadBuffer->pRight = this->pFontHeadBuffer;
+    this->pFontHeadBuffer->id = 28092017;
+  }
+
+  pNew = new LEFont;
+  pNew->pLeft = this->pFontHeadBuffer->pLeft;
+  pNew->pRight = this->pFontHeadBuffer;
+  this->pFontHeadBuffer->pLeft->pRight = pNew;
+  this->pFontHeadBuffer->pLeft = pNew;
+  pNew->id = id;
+  pNew->markedAsDelete = LE_FALSE;
+  pNew->revision = 0;
+  pNew->atlas.enabled = LE_FALSE;
+  pNew->atlas.invalid = LE_FALSE;
+  pNew->atlas.generation = 0;
+  pNew->atlas.pSurface = nullptr;
+  pNew->atlas.pTexture = nullptr;
+  pNew->atlas.penX = 0;
+  pNew->atlas.penY = 0;
+  pNew->atlas.rowHeight = 0;
+  pNew->pFont = nullptr;
+  pNew->pHandle = nullptr;
+  pNew->height = 0;
+  pNew->lineSkip = 0;
+  pNew->bitmap.enabled = LE_FALSE;
+
+  return pNew;
+}
+
+void LEMoon::fontReleaseHandle(LEFontHandle * pHandle)
+{
+  this->mtxFont.fontCache.lock();
+  LEFontFace * pFace = pHandle->pFace;
+
+  pHandle->refCount--;
+
+  if(pHandle->refCount == 0)
+  {
+    this->fontHandles.erase(pHandle->key);
+    TTF_CloseFont(pHandle->pFont);
+    delete pHandle;
+    pFace->refCount--;
+
+    if(pFace->refCount == 0)
+    {
+      this->fontFaces.erase(pFace->path);
+      delete [] pFace->pData;
+      delete pFace;
+    }
+  }
+
+  this->mtxFont.fontCache.unlock();
+}
+
+void LEMoon::fontRetainHandle(LEFontHandle * pHandle)
+{
+  this->mtxFont.fontCache.lock();
+  pHandle->refCount++;
+  this->mtxFont.fontCache.unlock();
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public font
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::fontCreateBitmap(uint32_t id, const char * pFile, const char * pImageFile)
+{
+  this->mtxFont.fontCreateBitmap.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pNew = this->fontGet(id);
+
+  if(pNew == nullptr)
+    {pNew = this->fontGetFromBuffer(id);}
+
+  if(pNew == nullptr)
+  {
+    this->mtxFont.bufferList.lock();
+
+    // die Glyphen liegen fertig auf den Seiten, daher wird nie ueber SDL_ttf gerastert und der Text immer aus dem Atlas gezeichnet
+
+    pNew = this->fontAddToBuffer(id);
+    pNew->bitmap.enabled = LE_TRUE;
+    pNew->atlas.enabled = LE_TRUE;
+    result = this->fontLoadBitmap(pNew, pFile, pImageFile);
+
+    if(result)
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::fontCreateBitmap(%u, %s)\n\n", id, pFile);
+        this->printErrorDialog(result, pErrorString);
+        delete [] pErrorString;
+      #endif
+    }
+
+    this->mtxFont.bufferList.unlock();
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontCreateBitmap(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_EXIST;
+  }
+
+  if(!result)
+    {this->notifyFont.notifyByEngine = LE_TRUE;}
+
+  this->mtxFont.fontCreateBitmap.unlock();
+  return result;
+}
+
+int LEMoon::fontCreateTTF(uint32_t id, const char * pFile, int fontSize)
+{
+  this->mtxFont.fontCreateTTF.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pNew = this->fontGet(id);
+
+  if(pNew == nullptr)
+    {pNew = this->fontGetFromBuffer(id);}
+
+  if(pNew == nullptr)
+  {
+    this->mtxFont.bufferList.lock();
+    pNew = this->fontAddToBuffer(id);
+    pNew->pHandle = this->fontAcquireHandle(pFile, fontSize, TTF_STYLE_NORMAL, 0);
+    pNew->pFont = (pNew->pHandle != nullptr) ? pNew->pHandle->pFont : nullptr;
+    pNew->height = (pNew->pFont != nullptr) ? TTF_FontHeight(pNew->pFont) : 0;
+    pNew->lineSkip = (pNew->pFont != nullptr) ? TTF_FontLineSkip(pNew->pFont) : 0;
+
+    if(pNew->pFont == nullptr)
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::fontCreateTTF(%u, %s, %d)\n\n", id, pFile, fontSize);
+        this->printErrorDialog(LE_OPEN_FONT, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_OPEN_FONT;
+    }
+
+    this->mtxFont.bufferList.unlock();
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontCreateTTF(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_EXIST;
+  }
+
+  if(!result)
+    {this->notifyFont.notifyByEngine = LE_TRUE;}
+
+  this->mtxFont.fontCreateTTF.unlock();
+  return result;
+}
+
+int LEMoon::fontDelete(uint32_t id)
+{
+  this->mtxFont.fontDelete.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pFont = this->fontGet(id);
+
+  if(pFont == nullptr)
+    {pFont = this->fontGetFromBuffer(id);}
+
+  if(pFont != nullptr)
+    {pFont->markedAsDelete = LE_TRUE;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontDelete(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_NOEXIST;
+  }
+
+  if(!result)
+    {this->notifyFont.notifyByEngine = LE_TRUE;}
+
+  this->mtxFont.fontDelete.unlock();
+  return result;
+}
+
+int LEMoon::fontPrewarm(uint32_t id, const char * pCharacters)
+{
+  this->mtxFont.fontPrewarm.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pFont = this->fontGet(id);
+  const unsigned char * pSet = (const unsigned char*) ((pCharacters != nullptr) ? pCharacters : LE_FONT_PREWARM_ASCII);
+  uint32_t index = 0;
+  uint32_t codepoint = 0;
+  uint16_t character = 0;
+
+  if(pFont == nullptr)
+    {pFont = this->fontGetFromBuffer(id);}
+
+  if(pFont != nullptr)
+  {
+    // Vorschuebe braucht jedes Layout, Glyphen nur Fonts mit Glyphenatlas, bei allen anderen wird der ganze Text gerastert
+
+    while(pSet[index] != '\0' && !result)
+    {
+      codepoint = this->textDecodeUTF8(pSet, &index);
+      character = (codepoint > 0xFFFF) ? '?' : (uint16_t) codepoint;
+      this->fontGetAdvance(pFont, character);
+
+      if(pFont->atlas.enabled && this->fontGetGlyph(pFont, character) == nullptr)
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::fontPrewarm(%u)\n\n", id);
+          this->printErrorDialog(LE_FONT_ATLAS, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_FONT_ATLAS;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontPrewarm(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_NOEXIST;
+  }
+
+  this->mtxFont.fontPrewarm.unlock();
+  return result;
+}
+
+void LEMoon::fontPrintList()
+{
+  this->mtxFont.fontPrintList.lock();
+  this->mtxFont.originalList.lock();
+  LEFont * pCurrent = nullptr;
+
+  if(this->pFontHead != nullptr)
+  {
+    pCurrent = this->pFontHead->pRight;
+
+    if(pCurrent != nullptr)
+    {
+      printf("ORIGINAL: Head: %d", this->pFontHead->id);
+
+      while(pCurrent != this->pFontHead)
+      {
+        printf(" <-> %d", pCurrent->id);
+        pCurrent = pCurrent->pRight;
+      }
+
+      printf(" <-> Head: %d\n", this->pFontHead->id);
+    }
+  }
+
+  this->mtxFont.originalList.unlock();
+  this->mtxFont.fontPrintList.unlock();
+}
+
+void LEMoon::fontPrintBufferList()
+{
+  this->mtxFont.fontPrintBufferList.lock();
+  this->mtxFont.bufferList.lock();
+  LEFont * pCurrent = nullptr;
+
+  if(this->pFontHeadBuffer != nullptr)
+  {
+    pCurrent = this->pFontHeadBuffer->pRight;
+
+    if(pCurrent != nullptr)
+    {
+      printf("BUFFER: Head: %d", this->pFontHeadBuffer->id);
+
+      while(pCurrent != this->pFontHeadBuffer)
+      {
+        printf(" <-> %d", pCurrent->id);
+        pCurrent = pCurrent->pRight;
+      }
+
+      printf(" <-> Head: %d\n", this->pFontHeadBuffer->id);
+    }
+  }
+
+  this->mtxFont.bufferList.unlock();
+  this->mtxFont.fontPrintBufferList.unlock();
+}
+
+int LEMoon::fontSetAtlas(uint32_t id, bool enabled)
+{
+  this->mtxFont.fontSetAtlas.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pFont = this->fontGet(id);
+
+  if(pFont == nullptr)
+    {pFont = this->fontGetFromBuffer(id);}
+
+  // der Atlas selbst wird erst beim naechsten textPrepareForDrawing() im Hauptthread angelegt
+
+  // Bitmapschriften werden immer aus ihren Seiten gezeichnet
+
+  if(pFont != nullptr)
+  {
+    if(!pFont->bitmap.enabled && pFont->atlas.enabled != enabled)
+    {
+      pFont->atlas.enabled = enabled;
+      pFont->revision++;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontSetAtlas(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_NOEXIST;
+  }
+
+  this->mtxFont.fontSetAtlas.unlock();
+  return result;
+}
+
+int LEMoon::fontSetStyle(uint32_t id, int style)
+{
+  this->mtxFont.fontSetStyle.lock();
+  int result = LE_NO_ERROR;
+  LEFont * pFont = this->fontGet(id);
+  LEFontHandle * pHandle = nullptr;
+
+  if(pFont == nullptr)
+    {pFont = this->fontGetFromBuffer(id);}
+
+  if(pFont != nullptr)
+  {
+    // Fonts teilen sich ihr Handle, daher wird das passende Handle des neuen Stils benutzt statt den Stil zu veraendern, beim selben Stil bleiben Atlas und Texte unberuehrt
+
+    if(pFont->pHandle != nullptr && pFont->pHandle->style != style)
+    {
+      pHandle = this->fontAcquireHandle(pFont->pHandle->pFace->path.c_str(), pFont->pHandle->size, style, 0);
+
+      if(pHandle != nullptr)
+      {
+        this->fontReleaseHandle(pFont->pHandle);
+        pFont->pHandle = pHandle;
+        pFont->pFont = pHandle->pFont;
+        pFont->height = TTF_FontHeight(pFont->pFont);
+        pFont->lineSkip = TTF_FontLineSkip(pFont->pFont);
+
+        // gerasterte Glyphen und Texte passen nicht mehr zum neuen Stil, Bitmapschriften haben keinen Stil
+
+        if(!pFont->bitmap.enabled)
+        {
+          pFont->atlas.invalid = LE_TRUE;
+          pFont->revision++;
+        }
+      }
+      else
+      {
+        // der Font behaelt sein bisheriges Handle, Atlas und Texte bleiben gueltig
+
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::fontSetStyle(%u, %d)\n\n", id, style);
+          this->printErrorDialog(LE_OPEN_FONT, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_OPEN_FONT;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::fontSetStyle(%u)\n\n", id);
+      this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_FONT_NOEXIST;
+  }
+
+  this->mtxFont.fontSetStyle.unlock();
+  return result;
+}
+
+void LEMoon::fontUsingThread(bool flag)
+{
+  this->mtxFont.fontUsingThread.lock();
+  this->notifyFont.notifyByUser = flag;
+  this->mtxFont.fontUsingThread.unlock();
+}
@@ -3,15 +3,280 @@
   e-mail:             pmattulat@outlook.de
   Dev-Tool:           Ubuntu 16.04, g++ Compiler
   date:               09.06.2017
-  updated:            11.04.2018
+  updated:            19.10.2026
 */
 
 #include "../include/le_math.h"
 
+#define LE_MATH_RECT_BATCH              4
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #define LE_MATH_X86
+  #include <emmintrin.h>
+  #include <immintrin.h>
+
+  #if defined(__GNUC__)
+    #define LE_MATH_TARGET_SSE2 __attribute__((target("sse2")))
+    #define LE_MATH_TARGET_AVX2 __attribute__((target("avx2")))
+  #else
+    #define LE_MATH_TARGET_SSE2
+    #define LE_MATH_TARGET_AVX2
+  #endif
+#endif
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// batch kernels
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+typedef void (*LEKernelRotatePoints)(Point_d*, const Point_d*, uint32_t, uint32_t, double, double);
+typedef void (*LEKernelLineIntersections)(const Line_d*, const Line_d*, bool*, uint32_t);
+
+typedef struct sLEMathKernels
+{
+  LEKernelRotatePoints rotatePoints;                            // rotiert Punkte um Mittelpunkte, Mittelpunkt Schrittweite 0 = ein gemeinsamer Mittelpunkt
+  LEKernelLineIntersections lineIntersections;                  // schneidet Paare von Strecken
+} LEMathKernels;
+
+static void mathRotatePointsScalar(Point_d * pPoints, const Point_d * pCenters, uint32_t centerStride, uint32_t amount, double cosine, double sine)
+{
+  double dx = 0.0f;
+  double dy = 0.0f;
+  const Point_d * pCenter = nullptr;
+
+  for(uint32_t i = 0 ; i < amount ; i++)
+  {
+    pCenter = &pCenters[i * centerStride];
+    dx = pPoints[i].x - pCenter->x;
+    dy = pPoints[i].y - pCenter->y;
+    pPoints[i].x = pCenter->x + dx * cosine - dy * sine;
+    pPoints[i].y = pCenter->y + dx * sine + dy * cosine;
+  }
+}
+
+static void mathLineIntersectionsScalar(const Line_d * pLinesA, const Line_d * pLinesB, bool * pResults, uint32_t amount)
+{
+  double rx, ry, sx, sy, d1, d2, d3, d4;
+  const Line_d * a = nullptr;
+  const Line_d * b = nullptr;
+
+  for(uint32_t i = 0 ; i < amount ; i++)
+  {
+    a = &pLinesA[i];
+    b = &pLinesB[i];
+    rx = a->p2.x - a->p1.x;
+    ry = a->p2.y - a->p1.y;
+    sx = b->p2.x - b->p1.x;
+    sy = b->p2.y - b->p1.y;
+    d1 = sx * (a->p1.y - b->p1.y) - sy * (a->p1.x - b->p1.x);
+    d2 = sx * (a->p2.y - b->p1.y) - sy * (a->p2.x - b->p1.x);
+    d3 = rx * (b->p1.y - a->p1.y) - ry * (b->p1.x - a->p1.x);
+    d4 = rx * (b->p2.y - a->p1.y) - ry * (b->p2.x - a->p1.x);
+
+    // beide Strecken liegen auf verschiedenen Seiten der jeweils anderen, die Huellen entscheiden bei kollinearen Strecken
+
+    pResults[i] = d1 * d2 <= 0.0f && d3 * d4 <= 0.0f &&
+                  fmax(fmin(a->p1.x, a->p2.x), fmin(b->p1.x, b->p2.x)) <= fmin(fmax(a->p1.x, a->p2.x), fmax(b->p1.x, b->p2.x)) &&
+                  fmax(fmin(a->p1.y, a->p2.y), fmin(b->p1.y, b->p2.y)) <= fmin(fmax(a->p1.y, a->p2.y), fmax(b->p1.y, b->p2.y));
+  }
+}
+
+#ifdef LE_MATH_X86
+
+LE_MATH_TARGET_SSE2 static void mathRotatePointsSSE2(Point_d * pPoints, const Point_d * pCenters, uint32_t centerStride, uint32_t amount, double cosine, double sine)
+{
+  __m128d vCos = _mm_set1_pd(cosine);
+  __m128d vSin = _mm_set_pd(sine, -sine);
+  __m128d center, delta, swapped;
+
+  // ein Punkt (x, y) pro Register
+
+  for(uint32_t i = 0 ; i < amount ; i++)
+  {
+    center = _mm_loadu_pd(&pCenters[i * centerStride].x);
+    delta = _mm_sub_pd(_mm_loadu_pd(&pPoints[i].x), center);
+    swapped = _mm_shuffle_pd(delta, delta, 1);
+    _mm_storeu_pd(&pPoints[i].x, _mm_add_pd(center, _mm_add_pd(_mm_mul_pd(delta, vCos), _mm_mul_pd(swapped, vSin))));
+  }
+}
+
+LE_MATH_TARGET_AVX2 static void mathRotatePointsAVX2(Point_d * pPoints, const Point_d * pCenters, uint32_t centerStride, uint32_t amount, double cosine, double sine)
+{
+  __m256d vCos = _mm256_set1_pd(cosine);
+  __m256d vSin = _mm256_set_pd(sine, -sine, sine, -sine);
+  __m256d center = _mm256_broadcast_pd((const __m128d*) &pCenters[0].x);
+  __m256d delta, swapped;
+  uint32_t i = 0;
+
+  // zwei Punkte pro Register
+
+  for( ; i + 2 <= amount ; i += 2)
+  {
+    if(centerStride != 0)
+      {center = _mm256_loadu_pd(&pCenters[i].x);}
+
+    delta = _mm256_sub_pd(_mm256_loadu_pd(&pPoints[i].x), center);
+    swapped = _mm256_permute_pd(delta, 5);
+    _mm256_storeu_pd(&pPoints[i].x, _mm256_add_pd(center, _mm256_add_pd(_mm256_mul_pd(delta, vCos), _mm256_mul_pd(swapped, vSin))));
+  }
+
+  if(i < amount)
+    {mathRotatePointsScalar(&pPoints[i], &pCenters[i * centerStride], centerStride, amount - i, cosine, sine);}
+}
+
+LE_MATH_TARGET_SSE2 static void mathLineIntersectionsSSE2(const Line_d * pLinesA, const Line_d * pLinesB, bool * pResults, uint32_t amount)
+{
+  __m128d zero = _mm_setzero_pd();
+  __m128d a0, a1, b0, b1, c0, c1, d0, d1;
+  __m128d p1x, p1y, p2x, p2y, q1x, q1y, q2x, q2y;
+  __m128d rx, ry, sx, sy, cross1, cross2, cross3, cross4, hit;
+  int mask = 0;
+  uint32_t i = 0;
+
+  // zwei Streckenpaare pro Durchlauf, aus (x, y) Paaren werden x und y Register
+
+  for( ; i + 2 <= amount ; i += 2)
+  {
+    a0 = _mm_loadu_pd(&pLinesA[i].p1.x);
+    a1 = _mm_loadu_pd(&pLinesA[i + 1].p1.x);
+    b0 = _mm_loadu_pd(&pLinesA[i].p2.x);
+    b1 = _mm_loadu_pd(&pLinesA[i + 1].p2.x);
+    c0 = _mm_loadu_pd(&pLinesB[i].p1.x);
+    c1 = _mm_loadu_pd(&pLinesB[i + 1].p1.x);
+    d0 = _mm_loadu_pd(&pLinesB[i].p2.x);
+    d1 = _mm_loadu_pd(&pLinesB[i + 1].p2.x);
+    p1x = _mm_unpacklo_pd(a0, a1);
+    p1y = _mm_unpackhi_pd(a0, a1);
+    p2x = _mm_unpacklo_pd(b0, b1);
+    p2y = _mm_unpackhi_pd(b0, b1);
+    q1x = _mm_unpacklo_pd(c0, c1);
+    q1y = _mm_unpackhi_pd(c0, c1);
+    q2x = _mm_unpacklo_pd(d0, d1);
+    q2y = _mm_unpackhi_pd(d0, d1);
+
+    rx = _mm_sub_pd(p2x, p1x);
+    ry = _mm_sub_pd(p2y, p1y);
+    sx = _mm_sub_pd(q2x, q1x);
+    sy = _mm_sub_pd(q2y, q1y);
+    cross1 = _mm_sub_pd(_mm_mul_pd(sx, _mm_sub_pd(p1y, q1y)), _mm_mul_pd(sy, _mm_sub_pd(p1x, q1x)));
+    cross2 = _mm_sub_pd(_mm_mul_pd(sx, _mm_sub_pd(p2y, q1y)), _mm_mul_pd(sy, _mm_sub_pd(p2x, q1x)));
+    cross3 = _mm_sub_pd(_mm_mul_pd(rx, _mm_sub_pd(q1y, p1y)), _mm_mul_pd(ry, _mm_sub_pd(q1x, p1x)));
+    cross4 = _mm_sub_pd(_mm_mul_pd(rx, _mm_sub_pd(q2y, p1y)), _mm_mul_pd(ry, _mm_sub_pd(q2x, p1x)));
+
+    hit = _mm_and_pd(_mm_cmple_pd(_mm_mul_pd(cross1, cross2), zero), _mm_cmple_pd(_mm_mul_pd(cross3, cross4), zero));
+    hit = _mm_and_pd(hit, _mm_cmple_pd(_mm_max_pd(_mm_min_pd(p1x, p2x), _mm_min_pd(q1x, q2x)), _mm_min_pd(_mm_max_pd(p1x, p2x), _mm_max_pd(q1x, q2x))));
+    hit = _mm_and_pd(hit, _mm_cmple_pd(_mm_max_pd(_mm_min_pd(p1y, p2y), _mm_min_pd(q1y, q2y)), _mm_min_pd(_mm_max_pd(p1y, p2y), _mm_max_pd(q1y, q2y))));
+    mask = _mm_movemask_pd(hit);
+    pResults[i] = (mask & 1) != 0;
+    pResults[i + 1] = (mask & 2) != 0;
+  }
+
+  if(i < amount)
+    {mathLineIntersectionsScalar(&pLinesA[i], &pLinesB[i], &pResults[i], amount - i);}
+}
+
+LE_MATH_TARGET_AVX2 static void mathLineIntersectionsAVX2(const Line_d * pLinesA, const Line_d * pLinesB, bool * pResults, uint32_t amount)
+{
+  __m256d zero = _mm256_setzero_pd();
+  __m256d l0, l1, l2, l3, t0, t1, t2, t3;
+  __m256d p1x, p1y, p2x, p2y, q1x, q1y, q2x, q2y;
+  __m256d rx, ry, sx, sy, cross1, cross2, cross3, cross4, hit;
+  int mask = 0;
+  uint32_t i = 0;
+
+  // vier Streckenpaare pro Durchlauf, eine Strecke (x1, y1, x2, y2) pro Register, danach 4x4 transponieren
+
+  for( ; i + 4 <= amount ; i += 4)
+  {
+    l0 = _mm256_loadu_pd(&pLinesA[i].p1.x);
+    l1 = _mm256_loadu_pd(&pLinesA[i + 1].p1.x);
+    l2 = _mm256_loadu_pd(&pLinesA[i + 2].p1.x);
+    l3 = _mm256_loadu_pd(&pLinesA[i + 3].p1.x);
+    t0 = _mm256_unpacklo_pd(l0, l1);
+    t1 = _mm256_unpackhi_pd(l0, l1);
+    t2 = _mm256_unpacklo_pd(l2, l3);
+    t3 = _mm256_unpackhi_pd(l2, l3);
+    p1x = _mm256_permute2f128_pd(t0, t2, 0x20);
+    p2x = _mm256_permute2f128_pd(t0, t2, 0x31);
+    p1y = _mm256_permute2f128_pd(t1, t3, 0x20);
+    p2y = _mm256_permute2f128_pd(t1, t3, 0x31);
+
+    l0 = _mm256_loadu_pd(&pLinesB[i].p1.x);
+    l1 = _mm256_loadu_pd(&pLinesB[i + 1].p1.x);
+    l2 = _mm256_loadu_pd(&pLinesB[i + 2].p1.x);
+    l3 = _mm256_loadu_pd(&pLinesB[i + 3].p1.x);
+    t0 = _mm256_unpacklo_pd(l0, l1);
+    t1 = _mm256_unpackhi_pd(l0, l1);
+    t2 = _mm256_unpacklo_pd(l2, l3);
+    t3 = _mm256_unpackhi_pd(l2, l3);
+    q1x = _mm256_permute2f128_pd(t0, t2, 0x20);
+    q2x = _mm256_permute2f128_pd(t0, t2, 0x31);
+    q1y = _mm256_permute2f128_pd(t1, t3, 0x20);
+    q2y = _mm256_permute2f128_pd(t1, t3, 0x31);
+
+    rx = _mm256_sub_pd(p2x, p1x);
+    ry = _mm256_sub_pd(p2y, p1y);
+    sx = _mm256_sub_pd(q2x, q1x);
+    sy = _mm256_sub_pd(q2y, q1y);
+    cross1 = _mm256_sub_pd(_mm256_mul_pd(sx, _mm256_sub_pd(p1y, q1y)), _mm256_mul_pd(sy, _mm256_sub_pd(p1x, q1x)));
+    cross2 = _mm256_sub_pd(_mm256_mul_pd(sx, _mm256_sub_pd(p2y, q1y)), _mm256_mul_pd(sy, _mm256_sub_pd(p2x, q1x)));
+    cross3 = _mm256_sub_pd(_mm256_mul_pd(rx, _mm256_sub_pd(q1y, p1y)), _mm256_mul_pd(ry, _mm256_sub_pd(q1x, p1x)));
+    cross4 = _mm256_sub_pd(_mm256_mul_pd(rx, _mm256_sub_pd(q2y, p1y)), _mm256_mul_pd(ry, _mm256_sub_pd(q2x, p1x)));
+
+    hit = _mm256_and_pd(_mm256_cmp_pd(_mm256_mul_pd(cross1, cross2), zero, _CMP_LE_OQ), _mm256_cmp_pd(_mm256_mul_pd(cross3, cross4), zero, _CMP_LE_OQ));
+    hit = _mm256_and_pd(hit, _mm256_cmp_pd(_mm256_max_pd(_mm256_min_pd(p1x, p2x), _mm256_min_pd(q1x, q2x)), _mm256_min_pd(_mm256_max_pd(p1x, p2x), _mm256_max_pd(q1x, q2x)), _CMP_LE_OQ));
+    hit = _mm256_and_pd(hit, _mm256_cmp_pd(_mm256_max_pd(_mm256_min_pd(p1y, p2y), _mm256_min_pd(q1y, q2y)), _mm256_min_pd(_mm256_max_pd(p1y, p2y), _mm256_max_pd(q1y, q2y)), _CMP_LE_OQ));
+    mask = _mm256_movemask_pd(hit);
+    pResults[i] = (mask & 1) != 0;
+    pResults[i + 1] = (mask & 2) != 0;
+    pResults[i + 2] = (mask & 4) != 0;
+    pResults[i + 3] = (mask & 8) != 0;
+  }
+
+  if(i < amount)
+    {mathLineIntersectionsSSE2(&pLinesA[i], &pLinesB[i], &pResults[i], amount - i);}
+}
+
+#endif
+
+static LEMathKernels mathSelectKernels()
+{
+  LEMathKernels kernels = {mathRotatePointsScalar, mathLineIntersectionsScalar};
+
+  #ifdef LE_MATH_X86
+    if(SDL_HasAVX2())
+    {
+      kernels.rotatePoints = mathRotatePointsAVX2;
+      kernels.lineIntersections = mathLineIntersectionsAVX2;
+    }
+    else if(SDL_HasSSE2())
+    {
+      kernels.rotatePoints = mathRotatePointsSSE2;
+      kernels.lineIntersections = mathLineIntersectionsSSE2;
+    }
+  #endif
+
+  return kernels;
+}
+
+static const LEMathKernels & mathGetKernels()
+{
+  static const LEMathKernels kernels = mathSelectKernels();
+
+  return kernels;
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// math
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
 double mathMod(double x, double range)
 {
-  while(x >= range)
-    {x -= range;}
+  if(x >= range)
+    {x = fmod(x, range);}
 
   return x;
 }
@@ -61,9 +326,12 @@ uint32_t mathMin(uint32_t * pArray, uint32_t amount)
 SDL_Point mathRotatePoint(SDL_Point point, SDL_Point center, double degree)
 {
   SDL_Point newPoint;
-  double radiant = degree * (PI / 180.0f);
-  newPoint.x = center.x + (point.x - center.x) * (int)cos(radiant) - (point.y - center.y) * (int)sin(radiant);
-  newPoint.y = center.y + (point.x - center.x) * (int)sin(radiant) + (point.y - center.y) * (int)cos(radiant);
+  Point_d pointD = {(double) point.x, (double) point.y};
+  Point_d centerD = {(double) center.x, (double) center.y};
+
+  mathRotatePoints(&pointD, &centerD, 1, degree);
+  newPoint.x = (int)round(pointD.x);
+  newPoint.y = (int)round(pointD.y);
 
   return newPoint;
 }
@@ -81,95 +349,457 @@ Point_d mathRotatePoint(Point_d point, Point_d center, double degree)
 bool mathLineIntersection(Line_d l1, Line_d l2)
 {
   bool collided = LE_FALSE;
-  double a = 0.0f;
-  double b = 0.0f;
+
+  mathLineIntersections(&l1, &l2, &collided, 1);
+
+  return collided;
+}
+
+void mathLineIntersections(const Line_d * pLinesA, const Line_d * pLinesB, bool * pResults, uint32_t amount)
+{
+  if(pLinesA != nullptr && pLinesB != nullptr && pResults != nullptr && amount > 0)
+    {mathGetKernels().lineIntersections(pLinesA, pLinesB, pResults, amount);}
+}
+
+bool mathRectIntersection(LECollBox_d frameBoxA, LECollBox_d frameBoxB)
+{
+  return mathRectsIntersection(&frameBoxA, &frameBoxB, 1);
+}
+
+bool mathRectsIntersection(const LECollBox_d * pBoxesA, const LECollBox_d * pBoxesB, uint32_t amount)
+{
+  bool collided = LE_FALSE;
+  bool results[LE_MATH_RECT_BATCH * 16];
+  Line_d linesA[LE_MATH_RECT_BATCH * 16];
+  Line_d linesB[LE_MATH_RECT_BATCH * 16];
+  uint32_t batch = 0;
+  const Line_d * pEdgesA = nullptr;
+  const Line_d * pEdgesB = nullptr;
+
+  // je Rechteckpaar 16 Kantenpaare, mehrere Rechteckpaare pro Durchlauf
+
+  for(uint32_t first = 0 ; first < amount && !collided ; first += LE_MATH_RECT_BATCH)
+  {
+    batch = (amount - first < LE_MATH_RECT_BATCH) ? amount - first : LE_MATH_RECT_BATCH;
+
+    for(uint32_t i = 0 ; i < batch ; i++)
+    {
+      pEdgesA = &pBoxesA[first + i].lineLeft;
+      pEdgesB = &pBoxesB[first + i].lineLeft;
+
+      for(uint32_t j = 0 ; j < 16 ; j++)
+      {
+        linesA[i * 16 + j] = pEdgesA[j / 4];
+        linesB[i * 16 + j] = pEdgesB[j % 4];
+      }
+    }
+
+    mathLineIntersections(linesA, linesB, results, batch * 16);
+
+    for(uint32_t i = 0 ; i < batch * 16 && !collided ; i++)
+      {collided = results[i];}
+
+    // ohne sich schneidende Kanten ueberschneiden sich zwei Rechtecke nur, wenn eines im anderen liegt
+
+    for(uint32_t i = 0 ; i < batch && !collided ; i++)
+      {collided = mathPointInCollBox(pBoxesA[first + i].lineLeft.p1, pBoxesB[first + i]) || mathPointInCollBox(pBoxesB[first + i].lineLeft.p1, pBoxesA[first + i]);}
+  }
+
+  return collided;
+}
+
+void mathRotatePoints(Point_d * pPoints, const Point_d * pCenters, uint32_t amount, double degree)
+{
+  double radiant = degree * (PI / 180.0f);
+
+  if(pPoints != nullptr && pCenters != nullptr && amount > 0)
+    {mathGetKernels().rotatePoints(pPoints, pCenters, 1, amount, cos(radiant), sin(radiant));}
+}
+
+void mathTransformBoxes(LECollBox_d * pBoxes, uint32_t amount, double degree)
+{
+  double radiant = degree * (PI / 180.0f);
+  double cosine = cos(radiant);
+  double sine = sin(radiant);
+  const LEMathKernels & kernels = mathGetKernels();
+
+  // ohne Rotation bleiben die Boxen unveraendert
+
+  if(pBoxes != nullptr && mathMod(fabs(degree), 360.0f) != 0.0f)
+  {
+    for(uint32_t i = 0 ; i < amount ; i++)
+      {kernels.rotatePoints(&pBoxes[i].lineLeft.p1, &pBoxes[i].center, 0, 8, cosine, sine);}
+  }
+}
+
+LECollBox_d mathTranslateCollBox(LECollBox_d collBox, Point_d offset)
+{
+  Point_d * pPoints = &collBox.lineLeft.p1;
+
+  // die acht Endpunkte der Linien und der Mittelpunkt liegen wie bei mathTransformBoxes() hintereinander
+
+  for(uint8_t i = 0 ; i < 9 ; i++)
+  {
+    pPoints[i].x += offset.x;
+    pPoints[i].y += offset.y;
+  }
+
+  return collBox;
+}
+
+AABB_d mathCollBoxBounds(LECollBox_d collBox)
+{
+  AABB_d bounds;
+  Point_d corners[4] = {collBox.lineLeft.p1, collBox.lineLeft.p2, collBox.lineRight.p1, collBox.lineRight.p2};
+
+  bounds.minX = bounds.maxX = corners[0].x;
+  bounds.minY = bounds.maxY = corners[0].y;
+
+  for(uint8_t i = 1 ; i < 4 ; i++)
+  {
+    if(corners[i].x < bounds.minX)
+      {bounds.minX = corners[i].x;}
+    if(corners[i].x > bounds.maxX)
+      {bounds.maxX = corners[i].x;}
+    if(corners[i].y < bounds.minY)
+      {bounds.minY = corners[i].y;}
+    if(corners[i].y > bounds.maxY)
+      {bounds.maxY = corners[i].y;}
+  }
+
+  return bounds;
+}
+
+bool mathBoundsIntersection(AABB_d boundsA, AABB_d boundsB)
+{
+  return boundsA.minX < boundsB.maxX && boundsA.maxX > boundsB.minX && boundsA.minY < boundsB.maxY && boundsA.maxY > boundsB.minY;
+}
+
+bool mathSweptBoundsIntersection(AABB_d moving, Point_d move, AABB_d target, double * pTimeOfImpact)
+{
+  bool collided = LE_FALSE;
+  double entryX = -HUGE_VAL;
+  double entryY = -HUGE_VAL;
+  double exitX = HUGE_VAL;
+  double exitY = HUGE_VAL;
+  double entry = 0.0f;
+  double exit = 0.0f;
+  bool separated = LE_FALSE;
+
+  // bereits ueberlappende Rechtecke blockieren nicht, sonst koennte sich ein Model nie wieder loesen
+
+  if(!mathBoundsIntersection(moving, target))
+  {
+    // slab x
+
+    if(move.x > 0.0f)
+    {
+      entryX = (target.minX - moving.maxX) / move.x;
+      exitX = (target.maxX - moving.minX) / move.x;
+    }
+    else if(move.x < 0.0f)
+    {
+      entryX = (target.maxX - moving.minX) / move.x;
+      exitX = (target.minX - moving.maxX) / move.x;
+    }
+    else
+      {separated = moving.maxX <= target.minX || moving.minX >= target.maxX;}
+
+    // slab y
+
+    if(move.y > 0.0f)
+    {
+      entryY = (target.minY - moving.maxY) / move.y;
+      exitY = (target.maxY - moving.minY) / move.y;
+    }
+    else if(move.y < 0.0f)
+    {
+      entryY = (target.maxY - moving.minY) / move.y;
+      exitY = (target.minY - moving.maxY) / move.y;
+    }
+    else
+      {separated = separated || moving.maxY <= target.minY || moving.minY >= target.maxY;}
+
+    entry = (entryX > entryY) ? entryX : entryY;
+    exit = (exitX < exitY) ? exitX : exitY;
+
+    if(!separated && entry < exit && entry >= 0.0f && entry <= 1.0f)
+    {
+      collided = LE_TRUE;
+
+      if(pTimeOfImpact != nullptr)
+        {*pTimeOfImpact = entry;}
+    }
+  }
+
+  return collided;
+}
+
+bool mathPointInPolygon(Point_d point, const Point_d * pVertices, uint32_t amount)
+{
+  bool inside = LE_FALSE;
+  double area = 0.0f;
+  double side = 0.0f;
+  uint32_t next = 0;
+
+  if(pVertices != nullptr && amount >= 3)
+  {
+    // Umlaufrichtung bestimmen, damit beide Richtungen erlaubt sind
+
+    for(uint32_t i = 0 ; i < amount ; i++)
+    {
+      next = (i + 1) % amount;
+      area += pVertices[i].x * pVertices[next].y - pVertices[next].x * pVertices[i].y;
+    }
+
+    inside = area != 0.0f;
+
+    for(uint32_t i = 0 ; i < amount && inside ; i++)
+    {
+      next = (i + 1) % amount;
+      side = (pVertices[next].x - pVertices[i].x) * (point.y - pVertices[i].y) - (pVertices[next].y - pVertices[i].y) * (point.x - pVertices[i].x);
+      inside = (area > 0.0f) ? side >= 0.0f : side <= 0.0f;
+    }
+  }
+
+  return inside;
+}
+
+bool mathPointInCollBox(Point_d point, LECollBox_d collBox)
+{
+  Point_d corners[4] = {collBox.lineTop.p1, collBox.lineTop.p2, collBox.lineBottom.p2, collBox.lineBottom.p1};
+
+  return mathPointInPolygon(point, corners, 4);
+}
+
+bool mathRayPolygonIntersection(Point_d origin, Point_d direction, double maxDistance, const Point_d * pVertices, uint32_t amount, double * pDistance)
+{
+  bool collided = LE_FALSE;
+  double length = sqrt(direction.x * direction.x + direction.y * direction.y);
+  double area = 0.0f;
+  double sign = 0.0f;
+  double numerator = 0.0f;
+  double denominator = 0.0f;
   double t = 0.0f;
-  double r = 0.0f;
-  Line_d buffer;
-  Point_d m1 = {0.0f, 0.0f};
-  Point_d m2 = {0.0f, 0.0f};
-  Point_d sLeft = {0.0f, 0.0f};
-  Point_d sRight = {0.0f, 0.0f};
+  double tEnter = 0.0f;
+  double tExit = maxDistance;
+  Point_d edge = {0.0f, 0.0f};
+  uint32_t next = 0;
 
-  if(m1.x == 0.0f)
+  if(pVertices != nullptr && amount >= 3 && length > 0.0f)
   {
-    buffer = l1;
-    l1 = l2;
-    l2 = buffer;
+    direction.x /= length;
+    direction.y /= length;
+
+    for(uint32_t i = 0 ; i < amount ; i++)
+    {
+      next = (i + 1) % amount;
+      area += pVertices[i].x * pVertices[next].y - pVertices[next].x * pVertices[i].y;
+    }
+
+    sign = (area > 0.0f) ? 1.0f : -1.0f;
+    collided = area != 0.0f;
+
+    // den Strahl an jeder Kante abschneiden (Cyrus-Beck)
+
+    for(uint32_t i = 0 ; i < amount && collided ; i++)
+    {
+      next = (i + 1) % amount;
+      edge.x = pVertices[next].x - pVertices[i].x;
+      edge.y = pVertices[next].y - pVertices[i].y;
+      numerator = sign * (edge.x * (origin.y - pVertices[i].y) - edge.y * (origin.x - pVertices[i].x));
+      denominator = sign * (edge.x * direction.y - edge.y * direction.x);
+
+      if(denominator == 0.0f)
+        {collided = numerator >= 0.0f;}
+      else
+      {
+        t = -numerator / denominator;
+
+        if(denominator > 0.0f && t > tEnter)
+          {tEnter = t;}
+        else if(denominator < 0.0f && t < tExit)
+          {tExit = t;}
+
+        collided = tEnter <= tExit;
+      }
+    }
+
+    if(collided && pDistance != nullptr)
+      {*pDistance = tEnter;}
   }
 
-  // m1 und m2
+  return collided;
+}
 
-  m1 = {(l1.p2.x - l1.p1.x), (l1.p2.y - l1.p1.y)};
-  m2 = {(l2.p2.x - l2.p1.x), (l2.p2.y - l2.p1.y)};
+bool mathRayCollBoxIntersection(Point_d origin, Point_d direction, double maxDistance, LECollBox_d collBox, double * pDistance)
+{
+  Point_d corners[4] = {collBox.lineTop.p1, collBox.lineTop.p2, collBox.lineBottom.p2, collBox.lineBottom.p1};
 
-  //printf("m1 (%1.2f , %1.2f)\nm2 (%1.2f , %1.2f)\n", m1.x, m1.y, m2.x, m2.y);
+  return mathRayPolygonIntersection(origin, direction, maxDistance, corners, 4, pDistance);
+}
+
+static void mathProjectPolygon(const Point_d * pVertices, uint32_t amount, Point_d axis, double * pMin, double * pMax)
+{
+  double projection = 0.0f;
+
+  *pMin = *pMax = pVertices[0].x * axis.x + pVertices[0].y * axis.y;
 
-  // a, b, t, r
+  for(uint32_t i = 1 ; i < amount ; i++)
+  {
+    projection = pVertices[i].x * axis.x + pVertices[i].y * axis.y;
+
+    if(projection < *pMin)
+      {*pMin = projection;}
+    else if(projection > *pMax)
+      {*pMax = projection;}
+  }
+}
 
-  a = (l2.p1.x - l1.p1.x) / m1.x; 
-  //printf("a = (%1.2f - %1.2f) / %1.2f = %1.2f;\n", l2.p1.x, l1.p1.x, m1.x, a);
+static bool mathPolygonSeparated(const Point_d * pVerticesA, uint32_t amountA, const Point_d * pVerticesB, uint32_t amountB)
+{
+  bool separated = LE_FALSE;
+  double minA, maxA, minB, maxB;
+  Point_d axis;
+  uint32_t next = 0;
 
-  b = m2.x / m1.x; 
-  //printf("b = (%1.2f / %1.2f) = %1.2f\n", m2.x, m1.x, b);
+  // die Normalen der Kanten von A sind die moeglichen Trennachsen
 
-  t = (l2.p1.y - (l1.p1.y + m1.y * a)) / (m1.y * b - m2.y); 
-  //printf("t = (%1.2f - (%1.2f + %1.2f * %1.2f)) / (%1.2f * %1.2f - %1.2f) = %1.4f\n", l2.p1.y, l1.p1.y, m1.y, a, m1.y, b, m2.y, t);
+  for(uint32_t i = 0 ; i < amountA && !separated ; i++)
+  {
+    next = (i + 1) % amountA;
+    axis.x = pVerticesA[i].y - pVerticesA[next].y;
+    axis.y = pVerticesA[next].x - pVerticesA[i].x;
+    mathProjectPolygon(pVerticesA, amountA, axis, &minA, &maxA);
+    mathProjectPolygon(pVerticesB, amountB, axis, &minB, &maxB);
+    separated = maxA < minB || maxB < minA;
+  }
 
-  r = (l2.p1.x - l1.p1.x + m2.x * t) / m1.x; 
-  //printf("r = (%1.2f - %1.2f - %1.2f * %1.2f) / %1.2f = %1.4f\n", l2.p1.x, l1.p1.x, m2.x, t, m1.x, r);
+  return separated;
+}
 
-  sLeft.x = round((l1.p1.x + m1.x * r) * 100.0f) / 100.0f;
-  sLeft.y = round((l1.p1.y + m1.y * r) * 100.0f) / 100.0f;
-  sRight.x = round((l2.p1.x + m2.x * t) * 100.0f) / 100.0f;
-  sRight.y = round((l2.p1.y + m2.y * t) * 100.0f) / 100.0f;
+bool mathCircleIntersection(Point_d centerA, double radiusA, Point_d centerB, double radiusB)
+{
+  double dx = centerB.x - centerA.x;
+  double dy = centerB.y - centerA.y;
+  double radii = radiusA + radiusB;
 
-  collided = (sLeft.x == sRight.x) && (sLeft.y == sRight.y) && r >= 0.0f && r <= 1.0f && t >= 0.0f && t <= 1.0f;
-  //printf("%1.2f = %1.2f\n%1.2f = %1.2f\n", sLeft.x, sRight.x, sLeft.y, sRight.y);
-  //printf("collided: %d\n------------------------------------\n", collided);
+  return dx * dx + dy * dy <= radii * radii;
+}
+
+bool mathCirclePolygonIntersection(Point_d center, double radius, const Point_d * pVertices, uint32_t amount)
+{
+  bool collided = LE_FALSE;
+  double t = 0.0f;
+  double lengthSquared = 0.0f;
+  Point_d edge, closest;
+  uint32_t next = 0;
+
+  if(pVertices != nullptr && amount >= 3)
+  {
+    collided = mathPointInPolygon(center, pVertices, amount);
+
+    // naechster Punkt jeder Kante zum Mittelpunkt
+
+    for(uint32_t i = 0 ; i < amount && !collided ; i++)
+    {
+      next = (i + 1) % amount;
+      edge.x = pVertices[next].x - pVertices[i].x;
+      edge.y = pVertices[next].y - pVertices[i].y;
+      lengthSquared = edge.x * edge.x + edge.y * edge.y;
+      t = (lengthSquared > 0.0f) ? ((center.x - pVertices[i].x) * edge.x + (center.y - pVertices[i].y) * edge.y) / lengthSquared : 0.0f;
+      t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+      closest.x = pVertices[i].x + edge.x * t;
+      closest.y = pVertices[i].y + edge.y * t;
+      collided = mathCircleIntersection(center, radius, closest, 0.0f);
+    }
+  }
 
   return collided;
 }
 
-bool mathRectIntersection(LECollBox_d frameBoxA, LECollBox_d frameBoxB)
+bool mathCircleCollBoxIntersection(Point_d center, double radius, LECollBox_d collBox)
+{
+  Point_d corners[4] = {collBox.lineTop.p1, collBox.lineTop.p2, collBox.lineBottom.p2, collBox.lineBottom.p1};
+
+  return mathCirclePolygonIntersection(center, radius, corners, 4);
+}
+
+bool mathPolygonIntersection(const Point_d * pVerticesA, uint32_t amountA, const Point_d * pVerticesB, uint32_t amountB)
+{
+  bool collided = LE_FALSE;
+
+  // Separating Axis Theorem, zwei konvexe Polygone beruehren sich, wenn keine Kantennormale sie trennt
+
+  if(pVerticesA != nullptr && pVerticesB != nullptr && amountA >= 3 && amountB >= 3)
+    {collided = !mathPolygonSeparated(pVerticesA, amountA, pVerticesB, amountB) && !mathPolygonSeparated(pVerticesB, amountB, pVerticesA, amountA);}
+
+  return collided;
+}
+
+bool mathPolygonCollBoxIntersection(const Point_d * pVertices, uint32_t amount, LECollBox_d collBox)
+{
+  Point_d corners[4] = {collBox.lineTop.p1, collBox.lineTop.p2, collBox.lineBottom.p2, collBox.lineBottom.p1};
+
+  return mathPolygonIntersection(pVertices, amount, corners, 4);
+}
+
+bool mathPolygonIsConvex(const Point_d * pVertices, uint32_t amount)
+{
+  bool convex = (pVertices != nullptr && amount >= 3);
+  double cross = 0.0f;
+  double sign = 0.0f;
+  uint32_t next = 0;
+  uint32_t nextNext = 0;
+
+  // alle Ecken muessen in die selbe Richtung abbiegen, Ecken auf einer Geraden sind nicht erlaubt
+
+  for(uint32_t i = 0 ; i < amount && convex ; i++)
+  {
+    next = (i + 1) % amount;
+    nextNext = (i + 2) % amount;
+    cross = (pVertices[next].x - pVertices[i].x) * (pVertices[nextNext].y - pVertices[next].y) - (pVertices[next].y - pVertices[i].y) * (pVertices[nextNext].x - pVertices[next].x);
+
+    if(cross == 0.0f || (sign != 0.0f && (cross > 0.0f) != (sign > 0.0f)))
+      {convex = LE_FALSE;}
+
+    sign = cross;
+  }
+
+  return convex;
+}
+
+bool mathRayCircleIntersection(Point_d origin, Point_d direction, double maxDistance, Point_d center, double radius, double * pDistance)
 {
   bool collided = LE_FALSE;
+  double length = sqrt(direction.x * direction.x + direction.y * direction.y);
+  double b = 0.0f;
+  double c = 0.0f;
+  double discriminant = 0.0f;
+  double t = 0.0f;
 
-  collided = collided || mathLineIntersection(frameBoxA.lineLeft, frameBoxB.lineLeft);
-
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineLeft, frameBoxB.lineTop);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineLeft, frameBoxB.lineRight);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineLeft, frameBoxB.lineBottom);}
-
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineTop, frameBoxB.lineLeft);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineTop, frameBoxB.lineTop);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineTop, frameBoxB.lineRight);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineTop, frameBoxB.lineBottom);}
-
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineRight, frameBoxB.lineLeft);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineRight, frameBoxB.lineTop);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineRight, frameBoxB.lineRight);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineRight, frameBoxB.lineBottom);}
-
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineBottom, frameBoxB.lineLeft);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineBottom, frameBoxB.lineTop);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineBottom, frameBoxB.lineRight);}
-  if(!collided)
-    {collided = collided || mathLineIntersection(frameBoxA.lineBottom, frameBoxB.lineBottom);}
+  if(length > 0.0f)
+  {
+    b = ((origin.x - center.x) * direction.x + (origin.y - center.y) * direction.y) / length;
+    c = (origin.x - center.x) * (origin.x - center.x) + (origin.y - center.y) * (origin.y - center.y) - radius * radius;
+    discriminant = b * b - c;
+
+    // liegt der Ursprung im Kreis, ist der Abstand 0
+
+    if(discriminant >= 0.0f && (c <= 0.0f || b < 0.0f))
+    {
+      t = -b - sqrt(discriminant);
+      t = (t < 0.0f) ? 0.0f : t;
+
+      if(t <= maxDistance)
+      {
+        collided = LE_TRUE;
+
+        if(pDistance != nullptr)
+          {*pDistance = t;}
+      }
+    }
+  }
 
   return collided;
 }
@@ -3,17 +3,35 @@
   e-mail:             pmattulat@outlook.de
   Dev-Tool:           Ubuntu 16.04, g++ Compiler
   date:               29.05.2017
-  updated:            11.04.2018
+  updated:            19.10.2026
 */
 
 #include "../include/le_mdl.h"
 
+#define LE_MDL_BOX_BATCH                16
+
 //////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////
 // private
 //////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////
 
+CollisionRect * LEMdl::collisionRectCreate(uint32_t idCollRect)
+{
+  CollisionRect * pCollRect = new CollisionRect;
+
+  pCollRect->pRight = this->pCollisionRectHead;
+  pCollRect->pLeft = this->pCollisionRectHead->pLeft;
+  this->pCollisionRectHead->pLeft->pRight = pCollRect;
+  this->pCollisionRectHead->pLeft = pCollRect;
+  pCollRect->id = idCollRect;
+  pCollRect->shape = LE_COLL_SHAPE_RECT;
+  pCollRect->radius = 0.0f;
+  pCollRect->amountVertices = 0;
+
+  return pCollRect;
+}
+
 CollisionRect * LEMdl::collisionRectGet(uint32_t idCollRect)
 {
   CollisionRect * pRet = nullptr;
@@ -294,7 +312,7 @@ void LEMdl::updateFrameBox()
   this->bufferFrameBox = this->rotateCollisionBox(this->frameBox);
 }
 
-void LEMdl::updateCollisionBox(CollisionRect * pCollRect)
+void LEMdl::fillCollisionBox(CollisionRect * pCollRect)
 {
   SDL_Point size = this->mdlGetSize();
   pCollRect->collRectBuffer.lineLeft.p1.x = this->position.x + pCollRect->collRect.x;
@@ -323,26 +341,77 @@ void LEMdl::updateCollisionBox(CollisionRect * pCollRect)
 
   pCollRect->collRectBuffer.center.x = this->position.x + (size.x * 0.5f);
   pCollRect->collRectBuffer.center.y = this->position.y + (size.y * 0.5f);
+}
 
-  // rotate
-
+void LEMdl::updateCollisionBox(CollisionRect * pCollRect)
+{
+  this->fillCollisionBox(pCollRect);
   pCollRect->collRectBuffer = this->rotateCollisionBox(pCollRect->collRectBuffer);
+  this->updateCollisionShape(pCollRect);
 }
 
-LECollBox_d LEMdl::rotateCollisionBox(LECollBox_d collBox)
+void LEMdl::updateCollisionBoxes()
+{
+  LECollBox_d boxes[LE_MDL_BOX_BATCH];
+  CollisionRect * pBatch[LE_MDL_BOX_BATCH];
+  CollisionRect * pCurrent = this->pCollisionRectHead->pRight;
+  uint32_t amount = 0;
+
+  // die Kollisionsbereiche werden blockweise in einem Durchlauf rotiert
+
+  while(pCurrent != this->pCollisionRectHead)
+  {
+    this->fillCollisionBox(pCurrent);
+    this->updateCollisionShape(pCurrent);
+    pBatch[amount] = pCurrent;
+    boxes[amount] = pCurrent->collRectBuffer;
+    amount++;
+    pCurrent = pCurrent->pRight;
+
+    if(amount == LE_MDL_BOX_BATCH || pCurrent == this->pCollisionRectHead)
+    {
+      mathTransformBoxes(boxes, amount, this->currentDegree);
+
+      for(uint32_t i = 0 ; i < amount ; i++)
+        {pBatch[i]->collRectBuffer = boxes[i];}
+
+      amount = 0;
+    }
+  }
+}
+
+void LEMdl::updateCollisionShape(CollisionRect * pCollRect)
 {
-  LECollBox_d retCollBox;
+  SDL_Point size = this->mdlGetSize();
+  Point_d center = {this->position.x + (size.x * 0.5f), this->position.y + (size.y * 0.5f)};
+  Point_d centers[LE_COLL_POLYGON_MAX];
 
-  retCollBox.lineLeft.p1 = mathRotatePoint(collBox.lineLeft.p1, collBox.center, this->currentDegree);
-  retCollBox.lineLeft.p2 = mathRotatePoint(collBox.lineLeft.p2, collBox.center, this->currentDegree);
-  retCollBox.lineRight.p1 = mathRotatePoint(collBox.lineRight.p1, collBox.center, this->currentDegree);
-  retCollBox.lineRight.p2 = mathRotatePoint(collBox.lineRight.p2, collBox.center, this->currentDegree);
-  retCollBox.lineTop.p1 = mathRotatePoint(collBox.lineTop.p1, collBox.center, this->currentDegree);
-  retCollBox.lineTop.p2 = mathRotatePoint(collBox.lineTop.p2, collBox.center, this->currentDegree);
-  retCollBox.lineBottom.p1 = mathRotatePoint(collBox.lineBottom.p1, collBox.center, this->currentDegree);
-  retCollBox.lineBottom.p2 = mathRotatePoint(collBox.lineBottom.p2, collBox.center, this->currentDegree);
+  // wie die Rechtecke werden Kreise und Polygone um den Mittelpunkt des Models rotiert
+
+  if(pCollRect->shape == LE_COLL_SHAPE_CIRCLE)
+  {
+    pCollRect->circleCenterBuffer.x = this->position.x + pCollRect->circleCenter.x;
+    pCollRect->circleCenterBuffer.y = this->position.y + pCollRect->circleCenter.y;
+    pCollRect->circleCenterBuffer = mathRotatePoint(pCollRect->circleCenterBuffer, center, this->currentDegree);
+  }
+  else if(pCollRect->shape == LE_COLL_SHAPE_POLYGON)
+  {
+    for(uint32_t i = 0 ; i < pCollRect->amountVertices ; i++)
+    {
+      pCollRect->verticesBuffer[i].x = this->position.x + pCollRect->vertices[i].x;
+      pCollRect->verticesBuffer[i].y = this->position.y + pCollRect->vertices[i].y;
+      centers[i] = center;
+    }
+
+    mathRotatePoints(pCollRect->verticesBuffer, centers, pCollRect->amountVertices, this->currentDegree);
+  }
+}
+
+LECollBox_d LEMdl::rotateCollisionBox(LECollBox_d collBox)
+{
+  mathTransformBoxes(&collBox, 1, this->currentDegree);
 
-  return retCollBox;
+  return collBox;
 }
 
 //////////////////////////////////////////////////////////
@@ -367,6 +436,7 @@ currentDegree(0.0f)
   this->pCollisionRectHead = new CollisionRect;
   this->pCollisionRectHead->pLeft = this->pCollisionRectHead;
   this->pCollisionRectHead->pRight = this->pCollisionRectHead;
+  this->updateFrameBox();
 }
 
 LEMdl::~LEMdl()
@@ -596,38 +666,23 @@ int LEMdl::mdlFocusTextureSourceRect(uint32_t idTexture, uint32_t idSrcRect)
 
 void LEMdl::mdlSetSize(int w, int h)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
-
   if(w >= 0 && h >= 0)
   {
     this->rectPosSize.w = w;
     this->rectPosSize.h = h;
     this->updateFrameBox();
-    pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-    while(pCurrentCollRect != this->pCollisionRectHead)
-    {
-      this->updateCollisionBox(pCurrentCollRect);
-      pCurrentCollRect = pCurrentCollRect->pRight;
-    }
+    this->updateCollisionBoxes();
   }
 }
 
 double LEMdl::mdlSetSize(double percent, int screenWidth)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
   double factor = percent / (((double) this->rectPosSize.w / (double) screenWidth) * 100.0f);
 
   this->rectPosSize.w *= (int)factor;
   this->rectPosSize.h *= (int)factor;
   this->updateFrameBox();
-  pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-  while(pCurrentCollRect != this->pCollisionRectHead)
-  {
-    this->updateCollisionBox(pCurrentCollRect);
-    pCurrentCollRect = pCurrentCollRect->pRight;
-  }
+  this->updateCollisionBoxes();
 
   return factor;
 }
@@ -896,19 +951,12 @@ int LEMdl::mdlSetTextureActive(uint32_t idTexture, bool active)
 
 void LEMdl::mdlSetPosition(double x, double y)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
   this->position.x = (float)x;
   this->position.y = (float)y;
   this->rectPosSize.x = (int)x;
   this->rectPosSize.y = (int)y;
   this->updateFrameBox();
-  pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-  while(pCurrentCollRect != this->pCollisionRectHead)
-  {
-    this->updateCollisionBox(pCurrentCollRect);
-    pCurrentCollRect = pCurrentCollRect->pRight;
-  }
+  this->updateCollisionBoxes();
 }
 
 int LEMdl::mdlAddDirection(uint32_t idDirection, glm::vec2 direction)
@@ -944,7 +992,6 @@ int LEMdl::mdlMoveDirection(uint32_t idDirection, double timestep)
 {
   int result = LE_NO_ERROR;
   LinkedVec2 * pDirection = this->directionGet(idDirection);
-  CollisionRect * pCurrentCollRect = nullptr;
 
   if(pDirection != nullptr)
   {
@@ -953,13 +1000,7 @@ int LEMdl::mdlMoveDirection(uint32_t idDirection, double timestep)
     this->rectPosSize.x = (int)this->position.x;
     this->rectPosSize.y = (int)this->position.y;
     this->updateFrameBox();
-    pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-    while(pCurrentCollRect != this->pCollisionRectHead)
-    {
-      this->updateCollisionBox(pCurrentCollRect);
-      pCurrentCollRect = pCurrentCollRect->pRight;
-    }
+    this->updateCollisionBoxes();
   }
   else
     {result = LE_DIRECTION_NOEXIST;}
@@ -969,30 +1010,16 @@ int LEMdl::mdlMoveDirection(uint32_t idDirection, double timestep)
 
 void LEMdl::mdlRotate(double ndegree, double timestep)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
   this->currentDegree = mathMod((this->currentDegree + ndegree * timestep), 360.0f);
   this->updateFrameBox();
-  pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-  while(pCurrentCollRect != this->pCollisionRectHead)
-  {
-    this->updateCollisionBox(pCurrentCollRect);
-    pCurrentCollRect = pCurrentCollRect->pRight;
-  }
+  this->updateCollisionBoxes();
 }
 
 void LEMdl::mdlRotateOnce(double ndegree)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
   this->currentDegree += ndegree;
   this->updateFrameBox();
-  pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-  while(pCurrentCollRect != this->pCollisionRectHead)
-  {
-    this->updateCollisionBox(pCurrentCollRect);
-    pCurrentCollRect = pCurrentCollRect->pRight;
-  }
+  this->updateCollisionBoxes();
 }
 
 int LEMdl::mdlSetTextureAlpha(uint32_t idTexture, uint8_t alpha)
@@ -1105,19 +1132,11 @@ double LEMdl::mdlGetSizeFactor()
 
 void LEMdl::mdlSetSizeFactor(double nsizeFactor)
 {
-  CollisionRect * pCurrentCollRect = nullptr;
-
   if(nsizeFactor > 0.0f)
   {
     this->sizeFactor = nsizeFactor;
     this->updateFrameBox();
-    pCurrentCollRect = this->pCollisionRectHead->pRight;
-
-    while(pCurrentCollRect != this->pCollisionRectHead)
-    {
-      this->updateCollisionBox(pCurrentCollRect);
-      pCurrentCollRect = pCurrentCollRect->pRight;
-    }
+    this->updateCollisionBoxes();
   }
 }
 
@@ -1280,6 +1299,11 @@ int LEMdl::mdlSetCloneVisible(uint32_t idClone, bool visible)
   return result;
 }
 
+Clone * LEMdl::mdlGetClone(uint32_t idClone)
+{
+  return this->cloneGet(idClone);
+}
+
 int LEMdl::mdlAddCollisionRect(uint32_t idCollRect, SDL_Rect collRect)
 {
   int result = LE_NO_ERROR;
@@ -1287,12 +1311,7 @@ int LEMdl::mdlAddCollisionRect(uint32_t idCollRect, SDL_Rect collRect)
 
   if(pCollRect == nullptr)
   {
-    pCollRect = new CollisionRect;
-    pCollRect->pRight = this->pCollisionRectHead;
-    pCollRect->pLeft = this->pCollisionRectHead->pLeft;
-    this->pCollisionRectHead->pLeft->pRight = pCollRect;
-    this->pCollisionRectHead->pLeft = pCollRect;
-    pCollRect->id = idCollRect;
+    pCollRect = this->collisionRectCreate(idCollRect);
     pCollRect->collRect = collRect;
     this->updateCollisionBox(pCollRect);
   }
@@ -1302,6 +1321,81 @@ int LEMdl::mdlAddCollisionRect(uint32_t idCollRect, SDL_Rect collRect)
   return result;
 }
 
+int LEMdl::mdlAddCollisionCircle(uint32_t idCollRect, int x, int y, int radius)
+{
+  int result = LE_NO_ERROR;
+  CollisionRect * pCollRect = this->collisionRectGet(idCollRect);
+
+  if(pCollRect != nullptr)
+    {result = LE_MDL_COLL_RECT_EXIST;}
+  else if(radius <= 0)
+    {result = LE_COLL_SHAPE;}
+  else
+  {
+    pCollRect = this->collisionRectCreate(idCollRect);
+    pCollRect->shape = LE_COLL_SHAPE_CIRCLE;
+    pCollRect->circleCenter.x = (double) x;
+    pCollRect->circleCenter.y = (double) y;
+    pCollRect->radius = (double) radius;
+    pCollRect->collRect.x = x - radius;
+    pCollRect->collRect.y = y - radius;
+    pCollRect->collRect.w = radius * 2;
+    pCollRect->collRect.h = radius * 2;
+    this->updateCollisionBox(pCollRect);
+  }
+
+  return result;
+}
+
+int LEMdl::mdlAddCollisionPolygon(uint32_t idCollRect, const SDL_Point * pVertices, uint32_t amount)
+{
+  int result = LE_NO_ERROR;
+  CollisionRect * pCollRect = this->collisionRectGet(idCollRect);
+  Point_d vertices[LE_COLL_POLYGON_MAX];
+  int minX, minY, maxX, maxY;
+
+  if(pCollRect != nullptr)
+    {result = LE_MDL_COLL_RECT_EXIST;}
+  else if(pVertices == nullptr || amount < 3 || amount > LE_COLL_POLYGON_MAX)
+    {result = LE_COLL_SHAPE;}
+  else
+  {
+    for(uint32_t i = 0 ; i < amount ; i++)
+    {
+      vertices[i].x = (double) pVertices[i].x;
+      vertices[i].y = (double) pVertices[i].y;
+    }
+
+    if(mathPolygonIsConvex(vertices, amount))
+    {
+      pCollRect = this->collisionRectCreate(idCollRect);
+      pCollRect->shape = LE_COLL_SHAPE_POLYGON;
+      pCollRect->amountVertices = amount;
+      minX = maxX = pVertices[0].x;
+      minY = maxY = pVertices[0].y;
+
+      for(uint32_t i = 0 ; i < amount ; i++)
+      {
+        pCollRect->vertices[i] = vertices[i];
+        minX = (pVertices[i].x < minX) ? pVertices[i].x : minX;
+        minY = (pVertices[i].y < minY) ? pVertices[i].y : minY;
+        maxX = (pVertices[i].x > maxX) ? pVertices[i].x : maxX;
+        maxY = (pVertices[i].y > maxY) ? pVertices[i].y : maxY;
+      }
+
+      pCollRect->collRect.x = minX;
+      pCollRect->collRect.y = minY;
+      pCollRect->collRect.w = maxX - minX;
+      pCollRect->collRect.h = maxY - minY;
+      this->updateCollisionBox(pCollRect);
+    }
+    else
+      {result = LE_COLL_SHAPE;}
+  }
+
+  return result;
+}
+
 double LEMdl::mdlGetCurrentDegree()
 {
   return this->currentDegree;
@@ -1,1295 +1,2023 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
-  date:               12.04.2018
-  updated:            12.04.2018
-
-  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
-*/
-
-#include "../include/le_moon.h"
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// private model
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::modelDraw(LEModel * pModel)
-{
-  int result = LE_NO_ERROR;
-
-  if(pModel->visible)
-    {result = pModel->pModel->mdlDrawActiveTexture(this->pRenderer);}
-
-  if(result)
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelDraw(%d)\n\n", pModel->id);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return result;
-}
-
-LEModel * LEMoon::modelGet(uint32_t id)
-{
-  LEModel * pRet = nullptr;
-  LEModel * pCurrent = nullptr;
-
-  if(this->pModelHead != nullptr)
-  {
-    if(this->memory.pLastModel != nullptr && this->memory.pLastModel->id == id)
-      {pRet = this->memory.pLastModel;}
-    else
-    {
-      pCurrent = this->pModelHead->pRight;
-
-      while(pCurrent != this->pModelHead)
-      {
-        if(pCurrent->id == id)
-        {
-          pRet = pCurrent;
-          this->memory.pLastModel = pCurrent;
-          break;
-        }
-
-        pCurrent = pCurrent->pRight;
-      }
-    }
-  }
-
-  return pRet;
-}
-
-uint32_t LEMoon::modelGetAmount()
-{
-  uint32_t amount = 0;
-  LEModel * pCurrent = nullptr;
-
-  if(this->pModelHead != nullptr)
-  {
-    pCurrent = this->pModelHead->pRight;
-
-    while(pCurrent != this->pModelHead)
-    {
-      amount++;
-      pCurrent = pCurrent->pRight;
-    }
-  }
-
-  return amount;
-}
-
-bool LEMoon::modelCheckFrameBoxCollision(LEModel * pModel, LEModel * pForeignModel)
-{
-  return mathRectIntersection(pModel->pModel->mdlGetFrameBox(), pForeignModel->pModel->mdlGetFrameBox());
-}
-
-bool LEMoon::modelCheckCollision(LEModel * pModel, LEModel * pForeignModel)
-{
-  bool collided = LE_FALSE;
-  CollisionRect * pModelCollisionRect = nullptr;
-  CollisionRect * pForeignModelCollisionRect = nullptr;
-
-  if(mathRectIntersection(pModel->pModel->mdlGetFrameBox(), pForeignModel->pModel->mdlGetFrameBox()))
-  {
-    pModelCollisionRect = pModel->pModel->pCollisionRectHead->pRight;
-    pForeignModelCollisionRect = pForeignModel->pModel->pCollisionRectHead->pRight;
-
-    while(pModelCollisionRect != pModel->pModel->pCollisionRectHead && pForeignModelCollisionRect != pForeignModel->pModel->pCollisionRectHead)
-    {
-      if(mathRectIntersection(pModelCollisionRect->collRectBuffer, pForeignModelCollisionRect->collRectBuffer))
-      {
-        collided = LE_TRUE;
-        break;
-      }
-
-      pModelCollisionRect = pModelCollisionRect->pRight;
-      pForeignModelCollisionRect = pForeignModelCollisionRect->pRight;
-    }
-  }
-
-  return collided;
-}
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// public model
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::modelCreate(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pNew = this->modelGet(id);
-
-  // element already exist?
-
-  if(pNew == nullptr)
-  {
-    if(this->pModelHead == nullptr)
-    {
-      this->pModelHead = new LEModel;
-      this->pModelHead->pLeft = this->pModelHead;
-      this->pModelHead->pRight = this->pModelHead;
-      this->pModelHead->pModel = nullptr;
-      this->pModelHead->id = 1989;
-      this->pModelHead->zindex = 0;
-    }
-
-    pNew = new LEModel;
-    pNew->pLeft = this->pModelHead;
-    pNew->pRight = this->pModelHead->pRight;
-    this->pModelHead->pRight->pLeft = pNew;
-    this->pModelHead->pRight = pNew;
-    pNew->id = id;
-    pNew->zindex = 1;
-    pNew->visible = LE_TRUE;
-    pNew->pModel = new LEMdl();
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreate(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_EXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_EXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelDelete(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    pElem->pLeft->pRight = pElem->pRight;
-    pElem->pRight->pLeft = pElem->pLeft;
-    delete pElem->pModel;
-    pElem->pModel = nullptr;
-    delete pElem;
-    pElem = nullptr;
-
-    if(this->pModelHead->pLeft == this->pModelHead && this->pModelHead->pRight == this->pModelHead)
-    {
-      delete this->pModelHead;
-      this->pModelHead = nullptr;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelDelete(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelCreateTexture(uint32_t id, uint32_t idTexture, const char * pFile)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  #ifdef LE_DEBUG
-    char * pErrorString = nullptr;
-  #endif
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlCreateTexture(idTexture, pFile, this->pRenderer);
-
-    #ifdef LE_DEBUG
-      pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateTexture(%u, %u, %s)\n\n", id, idTexture, pFile);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateTexture(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelAddTextureSourceRect(uint32_t id, uint32_t idTexture, uint32_t idSrcRect, int x, int y, int w, int h)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  #ifdef LE_DEBUG
-    char * pErrorString = nullptr;
-  #endif
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlAddTextureSourceRect(idTexture, idSrcRect, x, y, w, h);
-
-    #ifdef LE_DEBUG
-      pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddTextureSourceRect(%u, %u, %u, %d, %d, %d, %d)\n\n", id, idTexture, idSrcRect, x, y, w, h);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddTextureSourceRect(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelFocusTextureSourceRect(uint32_t id, uint32_t idTexture, uint32_t idSrcRect)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  #ifdef LE_DEBUG
-    char * pErrorString = new char[256 + 1];
-  #endif
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlFocusTextureSourceRect(idTexture, idSrcRect);
-
-    #ifdef LE_DEBUG
-      sprintf(pErrorString, "LEMoon::modelFocusTextureSourceRect(%u, %u, %u)\n\n", id, idTexture, idSrcRect);
-      this->printErrorDialog(result, pErrorString);
-    #endif
-  }
-  else
-  {
-    result = LE_MDL_NOEXIST;
-
-    #ifdef LE_DEBUG
-      sprintf(pErrorString, "LEMoon::modelFocusTextureSourceRect(%u)\n\n", id);
-      this->printErrorDialog(result, pErrorString);
-    #endif
-  }
-
-  #ifdef LE_DEBUG
-    delete [] pErrorString;
-  #endif
-
-  return result;
-}
-
-int LEMoon::modelSetSize(uint32_t id, int w, int h)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlSetSize(w, h);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetSize(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-double LEMoon::modelSetSize(uint32_t id, double percent)
-{
-  double factor = 0.0f;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {factor = pElem->pModel->mdlSetSize(percent, this->displayMode.w);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetSize(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return factor;
-}
-
-int LEMoon::modelSetZindex(uint32_t id, uint32_t zindex)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-  LEModel * pCurrent = nullptr;
-  bool moreThanOneElement = this->pModelHead->pLeft->id != this->pModelHead->pRight->id;
-
-  if(zindex == 0)
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetZindex(%u, %u)\n\n", id, zindex);
-      this->printErrorDialog(LE_INVALID_ZINDEX, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_INVALID_ZINDEX;
-  }
-
-  if(moreThanOneElement)
-  {
-    if(!result && pElem != nullptr)
-    {
-      pElem->zindex = zindex;
-    
-      // exclude from list
-    
-      pElem->pLeft->pRight = pElem->pRight;
-      pElem->pRight->pLeft = pElem->pLeft;
-    
-      // search right place for zindex
-    
-      pCurrent = this->pModelHead->pRight;
-    
-      while(pElem->zindex > pCurrent->zindex && pCurrent != this->pModelHead)
-        {pCurrent = pCurrent->pRight;}
-    
-      // include at right postion
-    
-      pElem->pLeft = pCurrent->pLeft;
-      pElem->pRight = pCurrent;
-      pCurrent->pLeft->pRight = pElem;
-      pCurrent->pLeft = pElem;
-    }
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::modelSetZindex(%u)\n\n", id);
-        this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-        delete [] pErrorString;
-      #endif
-    
-      result = LE_MDL_NOEXIST;
-    }
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetTextureZindex(uint32_t id, uint32_t idTexture, uint32_t zindex)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlSetTextureZindex(idTexture, zindex);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureZindex(%u, %u, %u)\n\n", id, idTexture, zindex);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureZindex(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetTextureActive(uint32_t id, uint32_t idTexture, bool active)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlSetTextureActive(idTexture, active);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureActive(%u, %u, %d)\n\n", id, idTexture, active);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureActive(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetPosition(uint32_t id, double x, double y)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlSetPosition(x, y);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetPosition(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelAddDirection(uint32_t id, uint32_t idDirection, glm::vec2 direction)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlAddDirection(idDirection, direction);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, direction.x, direction.y);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelMoveDirection(uint32_t id, uint32_t idDirection)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlMoveDirection(idDirection, this->timestep);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelMoveDirection(%u, %u)\n\n", id, idDirection);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelMoveDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelRotate(uint32_t id, double ndegree)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlRotate(ndegree, this->timestep);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelRotate(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelRotateOnce(uint32_t id, double ndegree)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlRotateOnce(ndegree);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelRotateOnce(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetTextureAlpha(uint32_t id, uint32_t idTexture, uint8_t alpha)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlSetTextureAlpha(idTexture, alpha);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureAlpha(%u, %u, %u)\n\n", id, idTexture, alpha);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetTextureAlpha(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelFadeTexture(uint32_t id, uint32_t idTexture, double alphaPerSecond)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlFadeTexture(idTexture, alphaPerSecond, this->timestep);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelFadeTexture(%u, %u, %1.2f)\n\n", id, idTexture, alphaPerSecond);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelFadeTexture(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelRotateDir(uint32_t id, uint32_t idDirection, double degree)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlRotateDir(idDirection, degree, this->timestep);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelRotateDir(%u, %u, %1.2f)\n\n", id, idDirection, degree);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelRotateDir(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-SDL_Point LEMoon::modelGetSize(uint32_t id)
-{
-  SDL_Point size;
-  size.x = 0;
-  size.y = 0;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {size = pElem->pModel->mdlGetSize();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetSize(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return size;
-}
-
-SDL_Point LEMoon::modelGetPosition(uint32_t id)
-{
-  SDL_Point position;
-  position.x = 0;
-  position.y = 0;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {position = pElem->pModel->mdlGetPosition();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetPosition(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return position;
-}
-
-glm::vec2 LEMoon::modelGetPositionD(uint32_t id)
-{
-  glm::vec2 position;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {position = pElem->pModel->mdlGetPositionD();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetPositionD(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return position;
-}
-
-double LEMoon::modelGetTextureAlpha(uint32_t id, uint32_t idTexture)
-{
-  double alpha = 0;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {alpha = pElem->pModel->mdlGetTextureAlpha(idTexture);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetTextureAlpha(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return alpha;
-}
-
-int LEMoon::modelSetSizeFactor(uint32_t id, double nsizeFactor)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlSetSizeFactor(nsizeFactor);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetSizeFactor(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-double LEMoon::modelGetSizeFactor(uint32_t id)
-{
-  double sizeFactor = 0.0f;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {sizeFactor = pElem->pModel->mdlGetSizeFactor();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetSizeFactor(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return sizeFactor;
-}
-
-int LEMoon::modelCreateSurface(uint32_t id, uint32_t idTexture, const char * pFile)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlCreateSurface(idTexture, pFile);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateSurface(%u, %u, %s)\n\n", id, idTexture, pFile);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateSurface(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelDeleteSurface(uint32_t id, uint32_t idTexture)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlDeleteSurface(idTexture);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelDeleteSurface(%u, %u)\n\n", id, idTexture);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelDeleteSurface(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-SDL_Surface * LEMoon::modelGetSurface(uint32_t id, uint32_t idTexture)
-{
-  SDL_Surface * pSurface = nullptr;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pSurface = pElem->pModel->mdlGetSurface(idTexture);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetSurface(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return pSurface;
-}
-
-Color LEMoon::modelGetPixelRGBA(uint32_t id, uint32_t idTexture, uint32_t x, uint32_t y)
-{
-  LEModel * pElem = this->modelGet(id);
-  Color pixel;
-
-  if(pElem != nullptr)
-    {pixel = pElem->pModel->mdlGetPixelRGBA(idTexture, x, y);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetPixelRGBA(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return pixel;
-}
-
-glm::vec2 LEMoon::modelGetDirection(uint32_t id, uint32_t idDirection)
-{
-  glm::vec2 direction = {0.0f, 0.0f};
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {direction = pElem->pModel->mdlGetDirection(idDirection);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return direction;
-}
-
-LECollBox_d LEMoon::modelGetFrameBox(uint32_t id)
-{
-  LECollBox_d frameBox;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {frameBox = pElem->pModel->mdlGetFrameBox();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetFrameBox(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return frameBox;
-}
-
-LECollBox_d LEMoon::modelGetCollisionBox(uint32_t id, uint32_t idCollRect)
-{
-  LECollBox_d collisionBox;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {collisionBox = pElem->pModel->mdlGetCollisionBox(idCollRect);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetCollisionBox(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return collisionBox;
-}
-
-int LEMoon::modelChangeDirection(uint32_t id, uint32_t idDirection, glm::vec2 dir)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlChangeDirection(idDirection, dir);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelChangeDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, dir.x, dir.y);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelChangeDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetVisible(uint32_t id, bool visible)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->visible = visible;}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetVisible(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelCreateClone(uint32_t id, uint32_t idClone)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlCreateClone(idClone);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateClone(%u, %u)\n\n", id, idClone);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCreateClone(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetClonePosition(uint32_t id, uint32_t idClone, glm::vec2 position)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlSetClonePosition(idClone, position);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetClonePosition(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idClone, position.x, position.y);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetClonePosition(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelClearClones(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-    {pElem->pModel->mdlClearClones();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelClearClones(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelSetCloneVisible(uint32_t id, uint32_t idClone, bool visible)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlSetCloneVisible(idClone, visible);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetCloneVisible(%u, %u, %d)\n\n", id, idClone, visible);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelSetCloneVisible(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::modelAddCollisionRect(uint32_t id, uint32_t idCollRect, SDL_Rect collRect)
-{
-  int result = LE_NO_ERROR;
-  LEModel * pElem = this->modelGet(id);
-
-  if(pElem != nullptr)
-  {
-    result = pElem->pModel->mdlAddCollisionRect(idCollRect, collRect);
-
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddCollisionRect(%u, %u, {%d, %d, %d, %d})\n\n", id, idCollRect, collRect.x, collRect.y, collRect.w, collRect.h);
-      this->printErrorDialog(result, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelAddCollisionRect(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_MDL_NOEXIST;
-  }
-
-  return result;
-}
-
-bool LEMoon::modelCheckFrameBoxCollision(uint32_t idModel, uint32_t idForeignModel)
-{
-  bool collided = LE_FALSE;
-  LEModel * pModel = this->modelGet(idModel);
-  LEModel * pForeignModel = this->modelGet(idForeignModel);
-
-  if(pModel != nullptr && pForeignModel != nullptr)
-    {collided = this->modelCheckFrameBoxCollision(pModel, pForeignModel);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCheckFrameBoxCollision(%u, %u)\n\n", idModel, idForeignModel);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return collided;
-}
-
-bool LEMoon::modelCheckCollision(uint32_t idModel, uint32_t idForeignModel)
-{
-  bool collided = LE_FALSE;
-  LEModel * pModel = this->modelGet(idModel);
-  LEModel * pForeignModel = this->modelGet(idForeignModel);
-
-  if(pModel != nullptr && pForeignModel != nullptr)
-    {collided = this->modelCheckCollision(pModel, pForeignModel);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelCheckCollision(%u, %u)\n\n", idModel, idForeignModel);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return collided;
-}
-
-uint32_t LEMoon::modelGetAmountOfCollisionBoxes(uint32_t id)
-{
-  uint32_t amount = 0;
-  LEModel * pModel = this->modelGet(id);
-
-  if(pModel != nullptr)
-    {amount = pModel->pModel->mdlGetAmountOfCollisionBoxes();}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetAmountOfCollisionBoxes(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return amount;
-}
-
-uint32_t LEMoon::modelGetAmountOfTextureSourceRectangles(uint32_t id, uint32_t idTexture)
-{
-  uint32_t amount = 0;
-  LEModel * pModel = this->modelGet(id);
-
-  if(pModel != nullptr)
-    {amount = pModel->pModel->mdlGetAmountOfTextureSourceRectangles(idTexture);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::modelGetAmountOfTextureSourceRectangles(%u)\n\n", id);
-      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return amount;
-}
-
-uint32_t LEMoon::modelGetZindex(uint32_t id)
-{
-  uint32_t zindex = 0;
-  LEModel * pModel = this->modelGet(id);
-
-  if(pModel != nullptr)
-    {zindex = pModel->zindex;}
-
-  return zindex;
-}
-
-bool LEMoon::modelTextureExists(uint32_t id, uint32_t idTexture)
-{
-  bool textureExist = LE_FALSE;
-  LEModel * pModel = this->modelGet(id);
-
-  if(pModel != nullptr)
-    {textureExist = pModel->pModel->mdlTextureExist(idTexture);}
-
-  return textureExist;
-}
-
-bool LEMoon::modelGetVisible(uint32_t id)
-{
-  bool visible = LE_FALSE;
-  LEModel * pModel = this->modelGet(id);
-
-  if(pModel != nullptr)
-    {visible = pModel->visible;}
-
-  return visible;
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               12.04.2018
+  updated:            19.10.2026
+
+  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
+*/
+
+#include "../include/le_moon.h"
+#include <algorithm>
+
+#define LE_COLL_PAIR_BATCH      8                         // Anzahl an Paaren von Kollisionsbereichen, die gemeinsam geprueft werden
+#define LE_COLL_SKIN            0.01f                     // Abstand in Pixel, der beim Anhalten vor einem Kontakt eingehalten wird
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private model
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::modelDraw(LEModel * pModel)
+{
+  int result = LE_NO_ERROR;
+
+  if(pModel->visible)
+    {result = pModel->pModel->mdlDrawActiveTexture(this->pRenderer);}
+
+  if(result)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelDraw(%d)\n\n", pModel->id);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return result;
+}
+
+LEModel * LEMoon::modelGet(uint32_t id)
+{
+  LEModel * pRet = nullptr;
+  LEModel * pCurrent = nullptr;
+
+  if(this->pModelHead != nullptr)
+  {
+    if(this->memory.pLastModel != nullptr && this->memory.pLastModel->id == id)
+      {pRet = this->memory.pLastModel;}
+    else
+    {
+      pCurrent = this->pModelHead->pRight;
+
+      while(pCurrent != this->pModelHead)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastModel = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  return pRet;
+}
+
+uint32_t LEMoon::modelGetAmount()
+{
+  uint32_t amount = 0;
+  LEModel * pCurrent = nullptr;
+
+  if(this->pModelHead != nullptr)
+  {
+    pCurrent = this->pModelHead->pRight;
+
+    while(pCurrent != this->pModelHead)
+    {
+      amount++;
+      pCurrent = pCurrent->pRight;
+    }
+  }
+
+  return amount;
+}
+
+bool LEMoon::modelCheckFrameBoxCollision(LEModel * pModel, LEModel * pForeignModel)
+{
+  LECollBox_d frameBox = pModel->pModel->mdlGetFrameBox();
+  LECollBox_d foreignFrameBox = pForeignModel->pModel->mdlGetFrameBox();
+
+  // die Huellen sortieren guenstig aus, mathRectIntersection() prueft die gedrehten Boxen inklusive eines Models, das komplett im anderen liegt
+
+  return this->collisionLayersMatch(pModel, pForeignModel) && mathBoundsIntersection(mathCollBoxBounds(frameBox), mathCollBoxBounds(foreignFrameBox)) && mathRectIntersection(frameBox, foreignFrameBox);
+}
+
+static bool modelShapeIntersection(const CollisionRect * pShape, const CollisionRect * pForeignShape)
+{
+  bool collided = LE_FALSE;
+  const CollisionRect * pSwap = nullptr;
+
+  // sortiert nach Form, damit jede Kombination nur einmal vorkommt (Rechteck < Kreis < Polygon)
+
+  if(pShape->shape > pForeignShape->shape)
+  {
+    pSwap = pShape;
+    pShape = pForeignShape;
+    pForeignShape = pSwap;
+  }
+
+  switch(pShape->shape)
+  {
+    case LE_COLL_SHAPE_RECT:
+    {
+      if(pForeignShape->shape == LE_COLL_SHAPE_RECT)
+        {collided = mathRectIntersection(pShape->collRectBuffer, pForeignShape->collRectBuffer);}
+      else if(pForeignShape->shape == LE_COLL_SHAPE_CIRCLE)
+        {collided = mathCircleCollBoxIntersection(pForeignShape->circleCenterBuffer, pForeignShape->radius, pShape->collRectBuffer);}
+      else
+        {collided = mathPolygonCollBoxIntersection(pForeignShape->verticesBuffer, pForeignShape->amountVertices, pShape->collRectBuffer);}
+    } break;
+    case LE_COLL_SHAPE_CIRCLE:
+    {
+      if(pForeignShape->shape == LE_COLL_SHAPE_CIRCLE)
+        {collided = mathCircleIntersection(pShape->circleCenterBuffer, pShape->radius, pForeignShape->circleCenterBuffer, pForeignShape->radius);}
+      else
+        {collided = mathCirclePolygonIntersection(pShape->circleCenterBuffer, pShape->radius, pForeignShape->verticesBuffer, pForeignShape->amountVertices);}
+    } break;
+    case LE_COLL_SHAPE_POLYGON:
+    {
+      collided = mathPolygonIntersection(pShape->verticesBuffer, pShape->amountVertices, pForeignShape->verticesBuffer, pForeignShape->amountVertices);
+    } break;
+  };
+
+  return collided;
+}
+
+static const CollisionRect * modelShapeOffset(const CollisionRect * pShape, Point_d offset, CollisionRect * pBuffer)
+{
+  // Clones verschieben nur eine Kopie auf dem Stack, die Kollisionsbereiche des Models bleiben unberuehrt
+
+  if(offset.x == 0.0f && offset.y == 0.0f)
+    {return pShape;}
+
+  pBuffer->shape = pShape->shape;
+  pBuffer->radius = pShape->radius;
+  pBuffer->amountVertices = pShape->amountVertices;
+  pBuffer->collRectBuffer = mathTranslateCollBox(pShape->collRectBuffer, offset);
+  pBuffer->circleCenterBuffer.x = pShape->circleCenterBuffer.x + offset.x;
+  pBuffer->circleCenterBuffer.y = pShape->circleCenterBuffer.y + offset.y;
+
+  for(uint32_t i = 0 ; i < pShape->amountVertices ; i++)
+  {
+    pBuffer->verticesBuffer[i].x = pShape->verticesBuffer[i].x + offset.x;
+    pBuffer->verticesBuffer[i].y = pShape->verticesBuffer[i].y + offset.y;
+  }
+
+  return pBuffer;
+}
+
+static bool modelForeignLess(const LECollisionPair &pairA, const LECollisionPair &pairB)
+{
+  return (pairA.idForeignModel != pairB.idForeignModel) ? pairA.idForeignModel < pairB.idForeignModel : pairA.idForeignClone < pairB.idForeignClone;
+}
+
+static bool modelShapeHitPoint(const CollisionRect * pShape, Point_d point)
+{
+  bool hit = LE_FALSE;
+
+  if(pShape->shape == LE_COLL_SHAPE_CIRCLE)
+    {hit = mathCircleIntersection(point, 0.0f, pShape->circleCenterBuffer, pShape->radius);}
+  else if(pShape->shape == LE_COLL_SHAPE_POLYGON)
+    {hit = mathPointInPolygon(point, pShape->verticesBuffer, pShape->amountVertices);}
+  else
+    {hit = mathPointInCollBox(point, pShape->collRectBuffer);}
+
+  return hit;
+}
+
+static bool modelShapeHitRay(const CollisionRect * pShape, Point_d origin, Point_d direction, double maxDistance, double * pDistance)
+{
+  bool hit = LE_FALSE;
+
+  if(pShape->shape == LE_COLL_SHAPE_CIRCLE)
+    {hit = mathRayCircleIntersection(origin, direction, maxDistance, pShape->circleCenterBuffer, pShape->radius, pDistance);}
+  else if(pShape->shape == LE_COLL_SHAPE_POLYGON)
+    {hit = mathRayPolygonIntersection(origin, direction, maxDistance, pShape->verticesBuffer, pShape->amountVertices, pDistance);}
+  else
+    {hit = mathRayCollBoxIntersection(origin, direction, maxDistance, pShape->collRectBuffer, pDistance);}
+
+  return hit;
+}
+
+bool LEMoon::modelCheckCollision(LEModel * pModel, LEModel * pForeignModel)
+{
+  Point_d offset = {0.0f, 0.0f};
+
+  return this->modelCheckCollision(pModel, offset, pForeignModel, offset);
+}
+
+bool LEMoon::modelCheckCollision(LEModel * pModel, Point_d offset, LEModel * pForeignModel, Point_d foreignOffset)
+{
+  bool collided = LE_FALSE;
+  uint32_t amount = 0;
+  LECollBox_d boxesA[LE_COLL_PAIR_BATCH];
+  LECollBox_d boxesB[LE_COLL_PAIR_BATCH];
+  LECollBox_d frameBox;
+  LECollBox_d foreignFrameBox;
+  CollisionRect shapeBuffer;
+  CollisionRect * pModelCollisionRect = nullptr;
+  CollisionRect * pForeignModelCollisionRect = nullptr;
+
+  // nur der Abstand zueinander zaehlt, deshalb wird nur das erste Model verschoben
+
+  offset.x -= foreignOffset.x;
+  offset.y -= foreignOffset.y;
+
+  frameBox = mathTranslateCollBox(pModel->pModel->mdlGetFrameBox(), offset);
+  foreignFrameBox = pForeignModel->pModel->mdlGetFrameBox();
+
+  // die Huellen sortieren guenstig aus, mathRectIntersection() erkennt auch ein Model, das komplett im anderen liegt
+
+  if(this->collisionLayersMatch(pModel, pForeignModel) && mathBoundsIntersection(mathCollBoxBounds(frameBox), mathCollBoxBounds(foreignFrameBox)) && mathRectIntersection(frameBox, foreignFrameBox))
+  {
+    pModelCollisionRect = pModel->pModel->pCollisionRectHead->pRight;
+
+    // jeder Kollisionsbereich gegen jeden, die Paare werden gesammelt und blockweise geprueft
+
+    while(pModelCollisionRect != pModel->pModel->pCollisionRectHead && !collided)
+    {
+      pForeignModelCollisionRect = pForeignModel->pModel->pCollisionRectHead->pRight;
+
+      while(pForeignModelCollisionRect != pForeignModel->pModel->pCollisionRectHead && !collided)
+      {
+        // Kreise und Polygone werden sofort geprueft, nur Rechteckpaare gesammelt
+
+        if(pModelCollisionRect->shape != LE_COLL_SHAPE_RECT || pForeignModelCollisionRect->shape != LE_COLL_SHAPE_RECT)
+          {collided = modelShapeIntersection(modelShapeOffset(pModelCollisionRect, offset, &shapeBuffer), pForeignModelCollisionRect);}
+        else
+        {
+          boxesA[amount] = mathTranslateCollBox(pModelCollisionRect->collRectBuffer, offset);
+          boxesB[amount] = pForeignModelCollisionRect->collRectBuffer;
+          amount++;
+
+          if(amount == LE_COLL_PAIR_BATCH)
+          {
+            collided = mathRectsIntersection(boxesA, boxesB, amount);
+            amount = 0;
+          }
+        }
+
+        pForeignModelCollisionRect = pForeignModelCollisionRect->pRight;
+      }
+
+      pModelCollisionRect = pModelCollisionRect->pRight;
+    }
+
+    if(!collided && amount > 0)
+      {collided = mathRectsIntersection(boxesA, boxesB, amount);}
+  }
+
+  return collided;
+}
+
+double LEMoon::modelSweep(LEModel * pModel, glm::vec2 move, LEModel ** ppHit)
+{
+  double timeOfImpact = 1.0f;
+  double currentTime = 0.0f;
+  bool hasRects = pModel->pModel->pCollisionRectHead->pRight != pModel->pModel->pCollisionRectHead;
+  Point_d moveD = {move.x, move.y};
+  AABB_d bounds = mathCollBoxBounds(pModel->pModel->mdlGetFrameBox());
+  AABB_d sweptBounds = bounds;
+  LEModel * pCandidate = nullptr;
+  CollisionRect * pModelCollisionRect = nullptr;
+  CollisionRect * pForeignModelCollisionRect = nullptr;
+  vector<LECollisionProxy*> candidates;
+
+  // Huelle ueber die komplette Bewegung
+
+  if(move.x < 0.0f)
+    {sweptBounds.minX += move.x;}
+  else
+    {sweptBounds.maxX += move.x;}
+
+  if(move.y < 0.0f)
+    {sweptBounds.minY += move.y;}
+  else
+    {sweptBounds.maxY += move.y;}
+
+  this->collisionQuery(sweptBounds, pModel->collisionMask, candidates);
+
+  for(size_t i = 0 ; i < candidates.size() ; i++)
+  {
+    pCandidate = candidates[i]->pModel;
+
+    if(pCandidate == pModel || candidates[i]->pClone != nullptr || !this->collisionLayersMatch(pModel, pCandidate) || !mathBoundsIntersection(sweptBounds, candidates[i]->bounds))
+      {continue;}
+
+    // ohne Kollisionsbereiche wird der grobe Kollisionsbereich benutzt
+
+    if(hasRects && pCandidate->pModel->pCollisionRectHead->pRight != pCandidate->pModel->pCollisionRectHead)
+    {
+      pModelCollisionRect = pModel->pModel->pCollisionRectHead->pRight;
+
+      while(pModelCollisionRect != pModel->pModel->pCollisionRectHead)
+      {
+        pForeignModelCollisionRect = pCandidate->pModel->pCollisionRectHead->pRight;
+
+        while(pForeignModelCollisionRect != pCandidate->pModel->pCollisionRectHead)
+        {
+          if(mathSweptBoundsIntersection(mathCollBoxBounds(pModelCollisionRect->collRectBuffer), moveD, mathCollBoxBounds(pForeignModelCollisionRect->collRectBuffer), &currentTime) && currentTime < timeOfImpact)
+          {
+            timeOfImpact = currentTime;
+
+            if(ppHit != nullptr)
+              {*ppHit = pCandidate;}
+          }
+
+          pForeignModelCollisionRect = pForeignModelCollisionRect->pRight;
+        }
+
+        pModelCollisionRect = pModelCollisionRect->pRight;
+      }
+    }
+    else if(mathSweptBoundsIntersection(bounds, moveD, candidates[i]->bounds, &currentTime) && currentTime < timeOfImpact)
+    {
+      timeOfImpact = currentTime;
+
+      if(ppHit != nullptr)
+        {*ppHit = pCandidate;}
+    }
+  }
+
+  return timeOfImpact;
+}
+
+bool LEMoon::modelHitPoint(LEModel * pModel, Point_d point)
+{
+  bool hit = LE_FALSE;
+  CollisionRect * pCurrentCollRect = pModel->pModel->pCollisionRectHead->pRight;
+
+  if(pCurrentCollRect == pModel->pModel->pCollisionRectHead)
+    {hit = mathPointInCollBox(point, pModel->pModel->mdlGetFrameBox());}
+
+  while(pCurrentCollRect != pModel->pModel->pCollisionRectHead && !hit)
+  {
+    hit = modelShapeHitPoint(pCurrentCollRect, point);
+    pCurrentCollRect = pCurrentCollRect->pRight;
+  }
+
+  return hit;
+}
+
+bool LEMoon::modelHitRay(LEModel * pModel, Point_d origin, Point_d direction, double maxDistance, double * pDistance)
+{
+  bool hit = LE_FALSE;
+  double distance = 0.0f;
+  CollisionRect * pCurrentCollRect = pModel->pModel->pCollisionRectHead->pRight;
+
+  if(pCurrentCollRect == pModel->pModel->pCollisionRectHead)
+    {hit = mathRayCollBoxIntersection(origin, direction, maxDistance, pModel->pModel->mdlGetFrameBox(), pDistance);}
+
+  while(pCurrentCollRect != pModel->pModel->pCollisionRectHead)
+  {
+    if(modelShapeHitRay(pCurrentCollRect, origin, direction, maxDistance, &distance) && (!hit || distance < *pDistance))
+    {
+      hit = LE_TRUE;
+      *pDistance = distance;
+    }
+
+    pCurrentCollRect = pCurrentCollRect->pRight;
+  }
+
+  return hit;
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public model
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::modelCreate(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pNew = this->modelGet(id);
+
+  // element already exist?
+
+  if(pNew == nullptr)
+  {
+    if(this->pModelHead == nullptr)
+    {
+      this->pModelHead = new LEModel;
+      this->pModelHead->pLeft = this->pModelHead;
+      this->pModelHead->pRight = this->pModelHead;
+      this->pModelHead->pModel = nullptr;
+      this->pModelHead->id = 1989;
+      this->pModelHead->zindex = 0;
+    }
+
+    pNew = new LEModel;
+    pNew->pLeft = this->pModelHead;
+    pNew->pRight = this->pModelHead->pRight;
+    this->pModelHead->pRight->pLeft = pNew;
+    this->pModelHead->pRight = pNew;
+    pNew->id = id;
+    pNew->zindex = 1;
+    pNew->visible = LE_TRUE;
+    pNew->pModel = new LEMdl();
+    pNew->collisionLayer = LE_COLL_LAYER_DEFAULT;
+    pNew->collisionMask = LE_COLL_MASK_ALL;
+    pNew->contactFrame = 0;
+    pNew->proxy.pModel = pNew;
+    pNew->proxy.pClone = nullptr;
+    pNew->proxy.idClone = LE_CLONE_NONE;
+    pNew->proxy.inGrid = LE_FALSE;
+    pNew->proxy.dirty = LE_FALSE;
+    pNew->proxy.queryStamp = 0;
+    pNew->proxy.pairSource = LE_FALSE;
+    this->collisionMarkDirty(&pNew->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreate(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_EXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelDelete(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    this->collisionGridRemove(&pElem->proxy);
+    this->collisionClearClones(pElem);
+    this->contactRemoveModel(pElem);
+
+    if(this->memory.pLastModel == pElem)
+      {this->memory.pLastModel = nullptr;}
+
+    pElem->pLeft->pRight = pElem->pRight;
+    pElem->pRight->pLeft = pElem->pLeft;
+    delete pElem->pModel;
+    pElem->pModel = nullptr;
+    delete pElem;
+    pElem = nullptr;
+
+    if(this->pModelHead->pLeft == this->pModelHead && this->pModelHead->pRight == this->pModelHead)
+    {
+      delete this->pModelHead;
+      this->pModelHead = nullptr;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelDelete(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelCreateTexture(uint32_t id, uint32_t idTexture, const char * pFile)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  #ifdef LE_DEBUG
+    char * pErrorString = nullptr;
+  #endif
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlCreateTexture(idTexture, pFile, this->pRenderer);
+    this->collisionMarkDirty(&pElem->proxy);
+
+    #ifdef LE_DEBUG
+      pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateTexture(%u, %u, %s)\n\n", id, idTexture, pFile);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateTexture(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelAddTextureSourceRect(uint32_t id, uint32_t idTexture, uint32_t idSrcRect, int x, int y, int w, int h)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  #ifdef LE_DEBUG
+    char * pErrorString = nullptr;
+  #endif
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlAddTextureSourceRect(idTexture, idSrcRect, x, y, w, h);
+
+    #ifdef LE_DEBUG
+      pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddTextureSourceRect(%u, %u, %u, %d, %d, %d, %d)\n\n", id, idTexture, idSrcRect, x, y, w, h);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddTextureSourceRect(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelFocusTextureSourceRect(uint32_t id, uint32_t idTexture, uint32_t idSrcRect)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  #ifdef LE_DEBUG
+    char * pErrorString = new char[256 + 1];
+  #endif
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlFocusTextureSourceRect(idTexture, idSrcRect);
+
+    #ifdef LE_DEBUG
+      sprintf(pErrorString, "LEMoon::modelFocusTextureSourceRect(%u, %u, %u)\n\n", id, idTexture, idSrcRect);
+      this->printErrorDialog(result, pErrorString);
+    #endif
+  }
+  else
+  {
+    result = LE_MDL_NOEXIST;
+
+    #ifdef LE_DEBUG
+      sprintf(pErrorString, "LEMoon::modelFocusTextureSourceRect(%u)\n\n", id);
+      this->printErrorDialog(result, pErrorString);
+    #endif
+  }
+
+  #ifdef LE_DEBUG
+    delete [] pErrorString;
+  #endif
+
+  return result;
+}
+
+int LEMoon::modelSetSize(uint32_t id, int w, int h)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->pModel->mdlSetSize(w, h);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetSize(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+double LEMoon::modelSetSize(uint32_t id, double percent)
+{
+  double factor = 0.0f;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    factor = pElem->pModel->mdlSetSize(percent, this->displayMode.w);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetSize(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return factor;
+}
+
+int LEMoon::modelSetZindex(uint32_t id, uint32_t zindex)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+  LEModel * pCurrent = nullptr;
+  bool moreThanOneElement = this->pModelHead->pLeft->id != this->pModelHead->pRight->id;
+
+  if(zindex == 0)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetZindex(%u, %u)\n\n", id, zindex);
+      this->printErrorDialog(LE_INVALID_ZINDEX, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_INVALID_ZINDEX;
+  }
+
+  if(moreThanOneElement)
+  {
+    if(!result && pElem != nullptr)
+    {
+      pElem->zindex = zindex;
+    
+      // exclude from list
+    
+      pElem->pLeft->pRight = pElem->pRight;
+      pElem->pRight->pLeft = pElem->pLeft;
+    
+      // search right place for zindex
+    
+      pCurrent = this->pModelHead->pRight;
+    
+      while(pElem->zindex > pCurrent->zindex && pCurrent != this->pModelHead)
+        {pCurrent = pCurrent->pRight;}
+    
+      // include at right postion
+    
+      pElem->pLeft = pCurrent->pLeft;
+      pElem->pRight = pCurrent;
+      pCurrent->pLeft->pRight = pElem;
+      pCurrent->pLeft = pElem;
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::modelSetZindex(%u)\n\n", id);
+        this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+    
+      result = LE_MDL_NOEXIST;
+    }
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetTextureZindex(uint32_t id, uint32_t idTexture, uint32_t zindex)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlSetTextureZindex(idTexture, zindex);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureZindex(%u, %u, %u)\n\n", id, idTexture, zindex);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureZindex(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetTextureActive(uint32_t id, uint32_t idTexture, bool active)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlSetTextureActive(idTexture, active);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureActive(%u, %u, %d)\n\n", id, idTexture, active);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureActive(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetPosition(uint32_t id, double x, double y)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->pModel->mdlSetPosition(x, y);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetPosition(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelAddDirection(uint32_t id, uint32_t idDirection, glm::vec2 direction)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlAddDirection(idDirection, direction);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, direction.x, direction.y);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelMoveDirection(uint32_t id, uint32_t idDirection)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlMoveDirection(idDirection, this->timestep);
+    this->collisionMarkDirty(&pElem->proxy);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelMoveDirection(%u, %u)\n\n", id, idDirection);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelMoveDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelRotate(uint32_t id, double ndegree)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->pModel->mdlRotate(ndegree, this->timestep);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelRotate(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelRotateOnce(uint32_t id, double ndegree)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->pModel->mdlRotateOnce(ndegree);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelRotateOnce(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetTextureAlpha(uint32_t id, uint32_t idTexture, uint8_t alpha)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlSetTextureAlpha(idTexture, alpha);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureAlpha(%u, %u, %u)\n\n", id, idTexture, alpha);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetTextureAlpha(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelFadeTexture(uint32_t id, uint32_t idTexture, double alphaPerSecond)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlFadeTexture(idTexture, alphaPerSecond, this->timestep);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelFadeTexture(%u, %u, %1.2f)\n\n", id, idTexture, alphaPerSecond);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelFadeTexture(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelRotateDir(uint32_t id, uint32_t idDirection, double degree)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlRotateDir(idDirection, degree, this->timestep);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelRotateDir(%u, %u, %1.2f)\n\n", id, idDirection, degree);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelRotateDir(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+SDL_Point LEMoon::modelGetSize(uint32_t id)
+{
+  SDL_Point size;
+  size.x = 0;
+  size.y = 0;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {size = pElem->pModel->mdlGetSize();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetSize(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return size;
+}
+
+SDL_Point LEMoon::modelGetPosition(uint32_t id)
+{
+  SDL_Point position;
+  position.x = 0;
+  position.y = 0;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {position = pElem->pModel->mdlGetPosition();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetPosition(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return position;
+}
+
+glm::vec2 LEMoon::modelGetPositionD(uint32_t id)
+{
+  glm::vec2 position;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {position = pElem->pModel->mdlGetPositionD();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetPositionD(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return position;
+}
+
+double LEMoon::modelGetTextureAlpha(uint32_t id, uint32_t idTexture)
+{
+  double alpha = 0;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {alpha = pElem->pModel->mdlGetTextureAlpha(idTexture);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetTextureAlpha(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return alpha;
+}
+
+int LEMoon::modelSetSizeFactor(uint32_t id, double nsizeFactor)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->pModel->mdlSetSizeFactor(nsizeFactor);
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetSizeFactor(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+double LEMoon::modelGetSizeFactor(uint32_t id)
+{
+  double sizeFactor = 0.0f;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {sizeFactor = pElem->pModel->mdlGetSizeFactor();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetSizeFactor(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return sizeFactor;
+}
+
+int LEMoon::modelCreateSurface(uint32_t id, uint32_t idTexture, const char * pFile)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlCreateSurface(idTexture, pFile);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateSurface(%u, %u, %s)\n\n", id, idTexture, pFile);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateSurface(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelDeleteSurface(uint32_t id, uint32_t idTexture)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlDeleteSurface(idTexture);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelDeleteSurface(%u, %u)\n\n", id, idTexture);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelDeleteSurface(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+SDL_Surface * LEMoon::modelGetSurface(uint32_t id, uint32_t idTexture)
+{
+  SDL_Surface * pSurface = nullptr;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {pSurface = pElem->pModel->mdlGetSurface(idTexture);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetSurface(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return pSurface;
+}
+
+Color LEMoon::modelGetPixelRGBA(uint32_t id, uint32_t idTexture, uint32_t x, uint32_t y)
+{
+  LEModel * pElem = this->modelGet(id);
+  Color pixel;
+
+  if(pElem != nullptr)
+    {pixel = pElem->pModel->mdlGetPixelRGBA(idTexture, x, y);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetPixelRGBA(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return pixel;
+}
+
+glm::vec2 LEMoon::modelGetDirection(uint32_t id, uint32_t idDirection)
+{
+  glm::vec2 direction = {0.0f, 0.0f};
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {direction = pElem->pModel->mdlGetDirection(idDirection);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return direction;
+}
+
+LECollBox_d LEMoon::modelGetFrameBox(uint32_t id)
+{
+  LECollBox_d frameBox;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {frameBox = pElem->pModel->mdlGetFrameBox();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetFrameBox(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return frameBox;
+}
+
+LECollBox_d LEMoon::modelGetCollisionBox(uint32_t id, uint32_t idCollRect)
+{
+  LECollBox_d collisionBox;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {collisionBox = pElem->pModel->mdlGetCollisionBox(idCollRect);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetCollisionBox(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return collisionBox;
+}
+
+int LEMoon::modelChangeDirection(uint32_t id, uint32_t idDirection, glm::vec2 dir)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlChangeDirection(idDirection, dir);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelChangeDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, dir.x, dir.y);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelChangeDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetVisible(uint32_t id, bool visible)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+    {pElem->visible = visible;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetVisible(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelCreateClone(uint32_t id, uint32_t idClone)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+  LECollisionProxy * pProxy = nullptr;
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlCreateClone(idClone);
+
+    // der Clone bekommt nur einen eigenen Eintrag im Kollisionsgitter, die Kollisionsbereiche liest er vom Model
+
+    if(result == LE_NO_ERROR)
+    {
+      pProxy = &pElem->cloneProxies[idClone];
+      pProxy->pModel = pElem;
+      pProxy->pClone = pElem->pModel->mdlGetClone(idClone);
+      pProxy->idClone = idClone;
+      pProxy->inGrid = LE_FALSE;
+      pProxy->dirty = LE_FALSE;
+      pProxy->queryStamp = 0;
+      pProxy->pairSource = LE_FALSE;
+      this->collisionMarkDirty(pProxy);
+    }
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateClone(%u, %u)\n\n", id, idClone);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCreateClone(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetClonePosition(uint32_t id, uint32_t idClone, glm::vec2 position)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlSetClonePosition(idClone, position);
+
+    if(result == LE_NO_ERROR)
+      {this->collisionMarkDirty(&pElem->cloneProxies[idClone]);}
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetClonePosition(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idClone, position.x, position.y);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetClonePosition(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelClearClones(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    this->collisionClearClones(pElem);
+    pElem->pModel->mdlClearClones();
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelClearClones(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetCloneVisible(uint32_t id, uint32_t idClone, bool visible)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlSetCloneVisible(idClone, visible);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetCloneVisible(%u, %u, %d)\n\n", id, idClone, visible);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetCloneVisible(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelAddCollisionCircle(uint32_t id, uint32_t idCollRect, int x, int y, int radius)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlAddCollisionCircle(idCollRect, x, y, radius);
+    this->contactMarkChanged(pElem);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionCircle(%u, %u, %d, %d, %d)\n\n", id, idCollRect, x, y, radius);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionCircle(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelAddCollisionPolygon(uint32_t id, uint32_t idCollRect, const SDL_Point * pVertices, uint32_t amount)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlAddCollisionPolygon(idCollRect, pVertices, amount);
+    this->contactMarkChanged(pElem);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionPolygon(%u, %u, %u)\n\n", id, idCollRect, amount);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionPolygon(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelAddCollisionRect(uint32_t id, uint32_t idCollRect, SDL_Rect collRect)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    result = pElem->pModel->mdlAddCollisionRect(idCollRect, collRect);
+    this->contactMarkChanged(pElem);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionRect(%u, %u, {%d, %d, %d, %d})\n\n", id, idCollRect, collRect.x, collRect.y, collRect.w, collRect.h);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelAddCollisionRect(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+bool LEMoon::modelCheckFrameBoxCollision(uint32_t idModel, uint32_t idForeignModel)
+{
+  bool collided = LE_FALSE;
+  LEModel * pModel = this->modelGet(idModel);
+  LEModel * pForeignModel = this->modelGet(idForeignModel);
+
+  if(pModel != nullptr && pForeignModel != nullptr)
+    {collided = this->modelCheckFrameBoxCollision(pModel, pForeignModel);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCheckFrameBoxCollision(%u, %u)\n\n", idModel, idForeignModel);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return collided;
+}
+
+bool LEMoon::modelCheckCollision(uint32_t idModel, uint32_t idForeignModel)
+{
+  bool collided = LE_FALSE;
+  LEModel * pModel = this->modelGet(idModel);
+  LEModel * pForeignModel = this->modelGet(idForeignModel);
+
+  if(pModel != nullptr && pForeignModel != nullptr)
+    {collided = this->modelCheckCollision(pModel, pForeignModel);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelCheckCollision(%u, %u)\n\n", idModel, idForeignModel);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return collided;
+}
+
+uint32_t LEMoon::modelGetAmountOfCollisionBoxes(uint32_t id)
+{
+  uint32_t amount = 0;
+  LEModel * pModel = this->modelGet(id);
+
+  if(pModel != nullptr)
+    {amount = pModel->pModel->mdlGetAmountOfCollisionBoxes();}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetAmountOfCollisionBoxes(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return amount;
+}
+
+uint32_t LEMoon::modelGetAmountOfTextureSourceRectangles(uint32_t id, uint32_t idTexture)
+{
+  uint32_t amount = 0;
+  LEModel * pModel = this->modelGet(id);
+
+  if(pModel != nullptr)
+    {amount = pModel->pModel->mdlGetAmountOfTextureSourceRectangles(idTexture);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetAmountOfTextureSourceRectangles(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return amount;
+}
+
+uint32_t LEMoon::modelGetZindex(uint32_t id)
+{
+  uint32_t zindex = 0;
+  LEModel * pModel = this->modelGet(id);
+
+  if(pModel != nullptr)
+    {zindex = pModel->zindex;}
+
+  return zindex;
+}
+
+bool LEMoon::modelTextureExists(uint32_t id, uint32_t idTexture)
+{
+  bool textureExist = LE_FALSE;
+  LEModel * pModel = this->modelGet(id);
+
+  if(pModel != nullptr)
+    {textureExist = pModel->pModel->mdlTextureExist(idTexture);}
+
+  return textureExist;
+}
+
+bool LEMoon::modelGetVisible(uint32_t id)
+{
+  bool visible = LE_FALSE;
+  LEModel * pModel = this->modelGet(id);
+
+  if(pModel != nullptr)
+    {visible = pModel->visible;}
+
+  return visible;
+}
+
+double LEMoon::modelGetTimeOfImpact(uint32_t id, uint32_t idDirection, uint32_t * pIdHit)
+{
+  double timeOfImpact = 1.0f;
+  LEModel * pModel = this->modelGet(id);
+  LEModel * pHit = nullptr;
+
+  if(pModel != nullptr)
+  {
+    timeOfImpact = this->modelSweep(pModel, pModel->pModel->mdlGetDirection(idDirection) * (float)this->timestep, &pHit);
+
+    if(pHit != nullptr && pIdHit != nullptr)
+      {*pIdHit = pHit->id;}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetTimeOfImpact(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return timeOfImpact;
+}
+
+int LEMoon::modelMoveDirectionSwept(uint32_t id, uint32_t idDirection, uint32_t * pIdHit)
+{
+  int result = LE_NO_ERROR;
+  double timeOfImpact = 1.0f;
+  double length = 0.0f;
+  LEModel * pElem = this->modelGet(id);
+  LEModel * pHit = nullptr;
+  glm::vec2 move = {0.0f, 0.0f};
+
+  if(pElem != nullptr)
+  {
+    move = pElem->pModel->mdlGetDirection(idDirection) * (float)this->timestep;
+    timeOfImpact = this->modelSweep(pElem, move, &pHit);
+
+    // kurz vor dem Kontakt anhalten, sodass sich die Models im naechsten Frame nicht ueberlappen
+
+    if(pHit != nullptr)
+    {
+      length = glm::length(move);
+      timeOfImpact = (length > 0.0f) ? timeOfImpact - LE_COLL_SKIN / length : 0.0f;
+
+      if(timeOfImpact < 0.0f)
+        {timeOfImpact = 0.0f;}
+
+      if(pIdHit != nullptr)
+        {*pIdHit = pHit->id;}
+    }
+
+    result = pElem->pModel->mdlMoveDirection(idDirection, this->timestep * timeOfImpact);
+    this->collisionMarkDirty(&pElem->proxy);
+
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelMoveDirectionSwept(%u, %u)\n\n", id, idDirection);
+      this->printErrorDialog(result, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelMoveDirectionSwept(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetCollisionLayer(uint32_t id, uint32_t layer)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->collisionLayer = layer;
+    this->collisionMarkDirty(&pElem->proxy);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetCollisionLayer(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::modelSetCollisionMask(uint32_t id, uint32_t mask)
+{
+  int result = LE_NO_ERROR;
+  LEModel * pElem = this->modelGet(id);
+
+  if(pElem != nullptr)
+  {
+    pElem->collisionMask = mask;
+    this->contactMarkChanged(pElem);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelSetCollisionMask(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+uint32_t LEMoon::modelGetCollisions(uint32_t id, uint32_t * pIds, uint32_t maxIds)
+{
+  uint32_t amount = 0;
+  LEModel * pModel = this->modelGet(id);
+  LEModel * pCandidate = nullptr;
+  AABB_d bounds;
+  vector<LECollisionProxy*> candidates;
+
+  if(pModel != nullptr)
+  {
+    // nur Zellen der Ebenen aus der eigenen Maske werden durchsucht, die Geometrie wird erst nach dem Ebenentest geprueft
+
+    bounds = mathCollBoxBounds(pModel->pModel->mdlGetFrameBox());
+    this->collisionQuery(bounds, pModel->collisionMask, candidates);
+
+    for(size_t i = 0 ; i < candidates.size() && amount < maxIds ; i++)
+    {
+      pCandidate = candidates[i]->pModel;
+
+      if(pCandidate != pModel && candidates[i]->pClone == nullptr && mathBoundsIntersection(bounds, candidates[i]->bounds) && this->modelCheckCollision(pModel, pCandidate))
+      {
+        if(pIds != nullptr)
+          {pIds[amount] = pCandidate->id;}
+
+        amount++;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetCollisions(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return amount;
+}
+
+uint32_t LEMoon::modelGetCloneCollisions(uint32_t id, uint32_t idClone, LECollisionPair * pPairs, uint32_t maxPairs)
+{
+  uint32_t amount = 0;
+  LEModel * pModel = this->modelGet(id);
+  LECollisionProxy * pProxy = nullptr;
+  unordered_map<uint32_t, LECollisionProxy>::iterator clone;
+  vector<LECollisionProxy*> proxies;
+  vector<LECollisionProxyPair> proxyPairs;
+  vector<LECollisionPair> pairs;
+  LECollisionPair pair;
+
+  if(pModel != nullptr)
+  {
+    if(idClone == LE_CLONE_NONE)
+      {pProxy = &pModel->proxy;}
+    else
+    {
+      clone = pModel->cloneProxies.find(idClone);
+
+      if(clone != pModel->cloneProxies.end())
+        {pProxy = &clone->second;}
+    }
+
+    if(pProxy != nullptr)
+    {
+      proxies.push_back(pProxy);
+      this->collisionFindPairs(proxies, LE_TRUE, proxyPairs);
+
+      for(size_t i = 0 ; i < proxyPairs.size() ; i++)
+      {
+        pair.idModel = id;
+        pair.idClone = idClone;
+        pair.idForeignModel = proxyPairs[i].pForeignProxy->pModel->id;
+        pair.idForeignClone = proxyPairs[i].pForeignProxy->idClone;
+        pairs.push_back(pair);
+      }
+
+      // die Kandidaten aus dem Gitter haben keine feste Reihenfolge
+
+      sort(pairs.begin(), pairs.end(), modelForeignLess);
+
+      for(size_t i = 0 ; i < pairs.size() && amount < maxPairs ; i++)
+      {
+        if(pPairs != nullptr)
+          {pPairs[amount] = pairs[i];}
+
+        amount++;
+      }
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::modelGetCloneCollisions(%u, %u)\n\n", id, idClone);
+        this->printErrorDialog(LE_MDL_CLONE_NOEXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetCloneCollisions(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return amount;
+}
+
+bool LEMoon::modelQueryPoint(int x, int y, uint32_t * pId)
+{
+  bool found = LE_FALSE;
+  Point_d point = {(double) x, (double) y};
+  AABB_d bounds = {point.x, point.y, point.x, point.y};
+  LEModel * pTopmost = nullptr;
+  LEModel * pCandidate = nullptr;
+  vector<LECollisionProxy*> candidates;
+
+  this->collisionQuery(bounds, LE_COLL_MASK_ALL, candidates);
+
+  for(size_t i = 0 ; i < candidates.size() ; i++)
+  {
+    pCandidate = candidates[i]->pModel;
+
+    // hoeherer zindex wird spaeter gemalt und liegt damit oben
+
+    if(candidates[i]->pClone == nullptr && pCandidate->visible && (pTopmost == nullptr || pCandidate->zindex > pTopmost->zindex) && this->modelHitPoint(pCandidate, point))
+      {pTopmost = pCandidate;}
+  }
+
+  if(pTopmost != nullptr)
+  {
+    found = LE_TRUE;
+
+    if(pId != nullptr)
+      {*pId = pTopmost->id;}
+  }
+
+  return found;
+}
+
+uint32_t LEMoon::modelQueryRay(glm::vec2 origin, glm::vec2 direction, double maxDistance, uint32_t * pIds, double * pDistances, uint32_t maxIds)
+{
+  uint32_t amount = 0;
+  Point_d originD = {origin.x, origin.y};
+  Point_d directionD = {direction.x, direction.y};
+  vector<LECollisionHit> hits;
+
+  if(maxIds > 0)
+  {
+    this->collisionQueryRay(originD, directionD, maxDistance, maxIds, hits);
+
+    for(size_t i = 0 ; i < hits.size() ; i++)
+    {
+      if(pIds != nullptr)
+        {pIds[amount] = hits[i].pModel->id;}
+      if(pDistances != nullptr)
+        {pDistances[amount] = hits[i].distance;}
+
+      amount++;
+    }
+  }
+
+  return amount;
+}
+
+uint32_t LEMoon::modelGetContacts(uint32_t id, LEContact * pContacts, uint32_t maxContacts)
+{
+  uint32_t amount = 0;
+  LEModel * pModel = this->modelGet(id);
+  LEContact contact;
+
+  if(pModel != nullptr)
+  {
+    // das abgefragte Model steht immer in idModel
+
+    for(size_t i = 0 ; i < this->contactCache.contacts.size() && amount < maxContacts ; i++)
+    {
+      contact = this->contactCache.contacts[i];
+
+      if(contact.idForeignModel == id)
+      {
+        contact.idForeignModel = contact.idModel;
+        contact.idModel = id;
+      }
+
+      if(contact.idModel == id)
+      {
+        if(pContacts != nullptr)
+          {pContacts[amount] = contact;}
+
+        amount++;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::modelGetContacts(%u)\n\n", id);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return amount;
 }
\ No newline at end of file
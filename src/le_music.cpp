@@ -0,0 +1,696 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+
+  NOTES:              Musik wird nie komplett dekodiert, der Hauptthread liest stueckweise in einen Ringpuffer, den der Audiothread leert
+*/
+
+#include "../include/le_moon.h"
+
+#define LE_MUSIC_BUFFER_SIZE            (1 << 18)                 // Groesse des Ringpuffers in Bytes, etwa 1,5 Sekunden bei 44100 Hz Stereo, muss eine Zweierpotenz sein
+#define LE_MUSIC_READ_SIZE              16384                     // so viele Bytes werden hoechstens auf einmal aus der Quelle gelesen
+
+#define LE_WAV_RIFF                     0x46464952                // "RIFF"
+#define LE_WAV_WAVE                     0x45564157                // "WAVE"
+#define LE_WAV_FMT                      0x20746D66                // "fmt "
+#define LE_WAV_DATA                     0x61746164                // "data"
+#define LE_WAV_PCM                      1
+#define LE_WAV_FLOAT                    3
+#define LE_WAV_EXTENSIBLE               0xFFFE
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private music
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static int musicGetFade(LEMusic * pMusic)
+{
+  int fade = pMusic->fadeTo;
+
+  if(pMusic->fadeLength > 0)
+    {fade = pMusic->fadeFrom + (int) ((int64_t) (pMusic->fadeTo - pMusic->fadeFrom) * pMusic->fadePosition / pMusic->fadeLength);}
+
+  return fade;
+}
+
+void LEMoon::musicFade(LEMusic * pMusic, int fadeTo, int ms, bool stop)
+{
+  this->mtxMusic.playing.lock();
+
+  // die Blende beginnt bei der aktuellen Lautstaerke, auch mitten in einer anderen Blende
+
+  pMusic->fadeFrom = musicGetFade(pMusic);
+  pMusic->fadeTo = fadeTo;
+  pMusic->fadeLength = (ms > 0) ? (uint32_t) ((uint64_t) pMusic->bytesPerSecond * ms / 1000) : 0;
+  pMusic->fadePosition = 0;
+  pMusic->stopAfterFade = stop;
+
+  if(stop && pMusic->fadeLength == 0)
+    {pMusic->finished = LE_TRUE;}
+
+  this->mtxMusic.playing.unlock();
+}
+
+void LEMoon::musicFill(LEMusic * pMusic)
+{
+  uint8_t data[LE_MUSIC_READ_SIZE];
+  uint32_t write = pMusic->writePosition;
+  uint32_t space = LE_MUSIC_BUFFER_SIZE - (write - pMusic->readPosition);
+  uint32_t amount = 0;
+  int available = 0;
+  size_t bytesRead = 0;
+
+  while(space > 0)
+  {
+    available = SDL_AudioStreamAvailable(pMusic->pStream);
+
+    if(available > 0)
+    {
+      // nur bis zum Ende des Ringpuffers, der Rest folgt im naechsten Durchlauf am Anfang
+
+      amount = LE_MUSIC_BUFFER_SIZE - (write & (LE_MUSIC_BUFFER_SIZE - 1));
+      amount = ((uint32_t) available < amount) ? (uint32_t) available : amount;
+      amount = (space < amount) ? space : amount;
+      available = SDL_AudioStreamGet(pMusic->pStream, pMusic->pBuffer + (write & (LE_MUSIC_BUFFER_SIZE - 1)), amount);
+
+      if(available <= 0)
+        {break;}
+
+      write += (uint32_t) available;
+      space -= (uint32_t) available;
+      pMusic->writePosition = write;
+    }
+    else if(!pMusic->sourceDone)
+    {
+      amount = pMusic->dataSize - pMusic->dataRead;
+      amount = (amount < LE_MUSIC_READ_SIZE) ? amount : LE_MUSIC_READ_SIZE;
+      amount -= amount % pMusic->blockAlign;
+      bytesRead = (amount > 0) ? SDL_RWread(pMusic->pSource, data, 1, amount) : 0;
+
+      if(bytesRead > 0)
+      {
+        SDL_AudioStreamPut(pMusic->pStream, data, (int) bytesRead);
+        pMusic->dataRead += (uint32_t) bytesRead;
+      }
+      else if(pMusic->loops != 0 && pMusic->dataRead > 0)
+      {
+        // Wiederholungen laufen ohne Luecke weiter, der Wandler behaelt seinen Zustand
+
+        if(pMusic->loops > 0)
+          {pMusic->loops--;}
+
+        SDL_RWseek(pMusic->pSource, pMusic->dataStart, RW_SEEK_SET);
+        pMusic->dataRead = 0;
+      }
+      else
+      {
+        SDL_AudioStreamFlush(pMusic->pStream);
+        pMusic->sourceDone = LE_TRUE;
+      }
+    }
+    else
+      {break;}
+  }
+
+  // erst wenn der Wandler leer ist, liegen alle Samples im Ringpuffer
+
+  if(pMusic->sourceDone && SDL_AudioStreamAvailable(pMusic->pStream) == 0)
+    {pMusic->ended = LE_TRUE;}
+}
+
+LEMusic * LEMoon::musicGet(uint32_t id)
+{
+  LEMusic * pRet = nullptr;
+  LEMusic * pCurrent = nullptr;
+
+  if(this->pMusicHead != nullptr)
+  {
+    if(this->memory.pLastMusic != nullptr && this->memory.pLastMusic->id == id)
+      {pRet = this->memory.pLastMusic;}
+    else
+    {
+      pCurrent = this->pMusicHead->pRight;
+
+      while(pCurrent != this->pMusicHead)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastMusic = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  return pRet;
+}
+
+void SDLCALL LEMoon::musicMix(void * pUserData, uint8_t * pStream, int length)
+{
+  LEMoon * pMoon = (LEMoon*) pUserData;
+  LEMusic * pMusic = nullptr;
+  uint32_t read = 0;
+  uint32_t amount = 0;
+  uint32_t mixed = 0;
+  int volume = 0;
+  bool audible = LE_FALSE;
+
+  // die Soundbefehle laufen vor den Kanaelen, gestartete Sounds sind daher schon in diesem Puffer zu hoeren
+
+  pMoon->soundDrainCommands();
+
+  if(pMoon->soundMixer.supported)
+    {pMoon->soundMixUpdateBuses(length);}
+
+  // SDL_mixer hat den Puffer bereits mit Stille gefuellt, die Kanaele werden danach dazugemischt
+
+  pMoon->mtxMusic.playing.lock();
+
+  for(size_t i = 0 ; i < pMoon->musicPlaying.size() ; i++)
+  {
+    pMusic = pMoon->musicPlaying[i];
+
+    if(pMusic->finished)
+      {continue;}
+
+    volume = pMusic->volume * musicGetFade(pMusic) / MIX_MAX_VOLUME;
+    read = pMusic->readPosition;
+    mixed = 0;
+
+    while(mixed < (uint32_t) length)
+    {
+      amount = pMusic->writePosition - read;
+
+      if(amount == 0)
+      {
+        // ein leerer Ringpuffer ohne Ende ist ein Aussetzer, die Musik laeuft beim naechsten Mal weiter
+
+        if(pMusic->ended && pMusic->writePosition == read)
+          {pMusic->finished = LE_TRUE;}
+
+        break;
+      }
+
+      amount = (amount < (uint32_t) length - mixed) ? amount : (uint32_t) length - mixed;
+      amount = (amount < LE_MUSIC_BUFFER_SIZE - (read & (LE_MUSIC_BUFFER_SIZE - 1))) ? amount : LE_MUSIC_BUFFER_SIZE - (read & (LE_MUSIC_BUFFER_SIZE - 1));
+
+      if(volume > 0)
+      {
+        SDL_MixAudioFormat(pStream + mixed, pMusic->pBuffer + (read & (LE_MUSIC_BUFFER_SIZE - 1)), pMusic->format, amount, volume);
+        audible = LE_TRUE;
+      }
+
+      read += amount;
+      mixed += amount;
+    }
+
+    pMusic->readPosition = read;
+
+    if(pMusic->fadeLength > 0)
+    {
+      pMusic->fadePosition += (uint32_t) length;
+
+      if(pMusic->fadePosition >= pMusic->fadeLength)
+      {
+        pMusic->fadeLength = 0;
+
+        if(pMusic->stopAfterFade)
+          {pMusic->finished = LE_TRUE;}
+      }
+    }
+  }
+
+  pMoon->mtxMusic.playing.unlock();
+
+  // bis hier liegt nur Musik im Puffer, die Kanaele werden erst danach dazugemischt
+
+  if(audible && pMoon->soundMixer.supported)
+  {
+    pMoon->soundMixer.buses[LE_SOUND_BUS_MUSIC].activeNow = LE_TRUE;
+    soundMixBus(&(pMoon->soundMixer.buses[LE_SOUND_BUS_MUSIC]), (int16_t*) pStream, length / 2, pMoon->soundMixer.buses[LE_SOUND_BUS_MUSIC].state);
+  }
+}
+
+int LEMoon::musicOpen(LEMusic * pMusic, const char * pFile, int64_t offset)
+{
+  int result = LE_NO_ERROR;
+  SDL_RWops * pSource = SDL_RWFromFile(pFile, "rb");
+  uint32_t chunk = 0;
+  uint32_t chunkSize = 0;
+  uint16_t tag = 0;
+  uint16_t channels = 0;
+  uint32_t frequency = 0;
+  uint16_t blockAlign = 0;
+  uint16_t bits = 0;
+  SDL_AudioFormat format = 0;
+  int deviceFrequency = 0;
+  Uint16 deviceFormat = 0;
+  int deviceChannels = 0;
+  int64_t dataStart = -1;
+  uint32_t dataSize = 0;
+
+  // nur der Kopf wird gelesen: RIFF, fmt und der Beginn von data, andere Bloecke werden uebersprungen
+
+  if(pSource == nullptr || SDL_RWseek(pSource, offset, RW_SEEK_SET) < 0 || SDL_ReadLE32(pSource) != LE_WAV_RIFF)
+    {result = LE_LOAD_MUSIC;}
+  else
+  {
+    SDL_ReadLE32(pSource);
+
+    if(SDL_ReadLE32(pSource) != LE_WAV_WAVE)
+      {result = LE_LOAD_MUSIC;}
+  }
+
+  while(!result && dataStart < 0)
+  {
+    chunk = SDL_ReadLE32(pSource);
+    chunkSize = SDL_ReadLE32(pSource);
+
+    if(chunk == LE_WAV_FMT && chunkSize >= 16)
+    {
+      tag = SDL_ReadLE16(pSource);
+      channels = SDL_ReadLE16(pSource);
+      frequency = SDL_ReadLE32(pSource);
+      SDL_ReadLE32(pSource);
+      blockAlign = SDL_ReadLE16(pSource);
+      bits = SDL_ReadLE16(pSource);
+
+      // bei WAVE_FORMAT_EXTENSIBLE stehen die ersten zwei Bytes des Subformats 8 Bytes weiter
+
+      if(tag == LE_WAV_EXTENSIBLE && chunkSize >= 26)
+      {
+        SDL_RWseek(pSource, 8, RW_SEEK_CUR);
+        tag = SDL_ReadLE16(pSource);
+        chunkSize -= 10;
+      }
+
+      SDL_RWseek(pSource, chunkSize - 16 + (chunkSize & 1), RW_SEEK_CUR);
+    }
+    else if(chunk == LE_WAV_DATA)
+    {
+      dataStart = SDL_RWtell(pSource);
+      dataSize = chunkSize;
+    }
+    else if(chunk == 0 || SDL_RWseek(pSource, chunkSize + (chunkSize & 1), RW_SEEK_CUR) < 0)
+      {result = LE_LOAD_MUSIC;}
+  }
+
+  if(!result)
+  {
+    if(tag == LE_WAV_PCM && bits == 8)
+      {format = AUDIO_U8;}
+    else if(tag == LE_WAV_PCM && bits == 16)
+      {format = AUDIO_S16LSB;}
+    else if(tag == LE_WAV_PCM && bits == 32)
+      {format = AUDIO_S32LSB;}
+    else if(tag == LE_WAV_FLOAT && bits == 32)
+      {format = AUDIO_F32LSB;}
+
+    if(format == 0 || channels == 0 || blockAlign == 0 || frequency == 0 || !Mix_QuerySpec(&deviceFrequency, &deviceFormat, &deviceChannels))
+      {result = LE_LOAD_MUSIC;}
+  }
+
+  if(!result)
+  {
+    pMusic->pStream = SDL_NewAudioStream(format, (Uint8) channels, (int) frequency, deviceFormat, (Uint8) deviceChannels, deviceFrequency);
+
+    if(pMusic->pStream == nullptr)
+      {result = LE_LOAD_MUSIC;}
+  }
+
+  if(!result)
+  {
+    pMusic->pSource = pSource;
+    pMusic->dataStart = dataStart;
+    pMusic->dataSize = dataSize;
+    pMusic->dataRead = 0;
+    pMusic->blockAlign = blockAlign;
+    pMusic->format = deviceFormat;
+    pMusic->bytesPerSecond = (uint32_t) deviceFrequency * (uint32_t) deviceChannels * (SDL_AUDIO_BITSIZE(deviceFormat) / 8);
+    pMusic->pBuffer = new uint8_t[LE_MUSIC_BUFFER_SIZE];
+    pMusic->sourceDone = LE_TRUE;
+    pMusic->ended = LE_TRUE;
+  }
+  else if(pSource != nullptr)
+    {SDL_RWclose(pSource);}
+
+  return result;
+}
+
+void LEMoon::musicRemove(LEMusic * pMusic)
+{
+  this->mtxMusic.playing.lock();
+
+  for(size_t i = 0 ; i < this->musicPlaying.size() ; i++)
+  {
+    if(this->musicPlaying[i] == pMusic)
+    {
+      this->musicPlaying.erase(this->musicPlaying.begin() + i);
+      break;
+    }
+  }
+
+  pMusic->playing = LE_FALSE;
+  this->mtxMusic.playing.unlock();
+}
+
+int LEMoon::musicStart(uint32_t id, int loops, int fadeFrom, int ms)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    if(pMusic->pSource != nullptr)
+    {
+      // eine laufende Musik beginnt von vorne, vorher muss der Audiothread sie loslassen
+
+      if(pMusic->playing)
+        {this->musicRemove(pMusic);}
+
+      SDL_AudioStreamClear(pMusic->pStream);
+      SDL_RWseek(pMusic->pSource, pMusic->dataStart, RW_SEEK_SET);
+      pMusic->dataRead = 0;
+      pMusic->readPosition = 0;
+      pMusic->writePosition = 0;
+      pMusic->loops = loops;
+      pMusic->sourceDone = LE_FALSE;
+      pMusic->ended = LE_FALSE;
+      pMusic->finished = LE_FALSE;
+      pMusic->fadeFrom = fadeFrom;
+      pMusic->fadeTo = MIX_MAX_VOLUME;
+      pMusic->fadeLength = (ms > 0) ? (uint32_t) ((uint64_t) pMusic->bytesPerSecond * ms / 1000) : 0;
+      pMusic->fadePosition = 0;
+      pMusic->stopAfterFade = LE_FALSE;
+
+      // nur der Ringpuffer wird vorab gefuellt, die Musik startet ohne die ganze Datei zu dekodieren
+
+      this->musicFill(pMusic);
+
+      this->mtxMusic.playing.lock();
+      this->musicPlaying.push_back(pMusic);
+      pMusic->playing = LE_TRUE;
+      this->mtxMusic.playing.unlock();
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::musicStart(%u, %d)\n\n", id, loops);
+        this->printErrorDialog(LE_LOAD_MUSIC, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_LOAD_MUSIC;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicStart(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::musicUpdate()
+{
+  LEMusic * pMusic = nullptr;
+  size_t i = 0;
+
+  // nur der Hauptthread veraendert die Liste, lesen darf er sie daher ohne Sperre
+
+  while(i < this->musicPlaying.size())
+  {
+    pMusic = this->musicPlaying[i];
+
+    if(pMusic->finished)
+      {this->musicRemove(pMusic);}
+    else
+    {
+      this->musicFill(pMusic);
+      i++;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public music
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::musicCreate(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pNew = this->musicGet(id);
+
+  if(pNew == nullptr)
+  {
+    if(this->pMusicHead == nullptr)
+    {
+      this->pMusicHead = new LEMusic;
+      this->pMusicHead->pLeft = this->pMusicHead;
+      this->pMusicHead->pRight = this->pMusicHead;
+    }
+
+    pNew = new LEMusic;
+    pNew->pLeft = this->pMusicHead->pLeft;
+    pNew->pRight = this->pMusicHead;
+    this->pMusicHead->pLeft->pRight = pNew;
+    this->pMusicHead->pLeft = pNew;
+    pNew->id = id;
+    pNew->pSource = nullptr;
+    pNew->dataStart = 0;
+    pNew->dataSize = 0;
+    pNew->dataRead = 0;
+    pNew->blockAlign = 1;
+    pNew->pStream = nullptr;
+    pNew->format = AUDIO_S16SYS;
+    pNew->bytesPerSecond = 0;
+    pNew->pBuffer = nullptr;
+    pNew->readPosition = 0;
+    pNew->writePosition = 0;
+    pNew->loops = 0;
+    pNew->sourceDone = LE_TRUE;
+    pNew->ended = LE_TRUE;
+    pNew->finished = LE_TRUE;
+    pNew->playing = LE_FALSE;
+    pNew->volume = MIX_MAX_VOLUME;
+    pNew->fadeFrom = MIX_MAX_VOLUME;
+    pNew->fadeTo = MIX_MAX_VOLUME;
+    pNew->fadeLength = 0;
+    pNew->fadePosition = 0;
+    pNew->stopAfterFade = LE_FALSE;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicCreate(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_EXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::musicDelete(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    // erst wenn der Audiothread sie nicht mehr mischt, darf die Musik verschwinden
+
+    if(pMusic->playing)
+      {this->musicRemove(pMusic);}
+
+    pMusic->pLeft->pRight = pMusic->pRight;
+    pMusic->pRight->pLeft = pMusic->pLeft;
+
+    if(this->memory.pLastMusic == pMusic)
+      {this->memory.pLastMusic = nullptr;}
+
+    if(pMusic->pSource != nullptr)
+      {SDL_RWclose(pMusic->pSource);}
+
+    if(pMusic->pStream != nullptr)
+      {SDL_FreeAudioStream(pMusic->pStream);}
+
+    if(pMusic->pBuffer != nullptr)
+      {delete [] pMusic->pBuffer;}
+
+    delete pMusic;
+
+    if(this->pMusicHead->pLeft == this->pMusicHead && this->pMusicHead->pRight == this->pMusicHead)
+    {
+      delete this->pMusicHead;
+      this->pMusicHead = nullptr;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicDelete(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::musicLoad(uint32_t id, const char * pFile)
+{
+  return this->musicLoadFromPack(id, pFile, 0);
+}
+
+int LEMoon::musicLoadFromPack(uint32_t id, const char * pFile, int64_t offset)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    if(pMusic->pSource == nullptr)
+    {
+      result = this->musicOpen(pMusic, pFile, offset);
+
+      if(result)
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::musicLoadFromPack(%u, %s)\n\n", id, pFile);
+          this->printErrorDialog(result, pErrorString);
+          delete [] pErrorString;
+        #endif
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicLoadFromPack(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::musicPlay(uint32_t id, int loops)
+{
+  return this->musicStart(id, loops, MIX_MAX_VOLUME, 0);
+}
+
+int LEMoon::musicCrossfade(uint32_t id, int loops, int ms)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    // die alten Stuecke laufen weiter, bis sie ausgeblendet sind, beide Ringpuffer werden gleichzeitig gemischt
+
+    for(size_t i = 0 ; i < this->musicPlaying.size() ; i++)
+    {
+      if(this->musicPlaying[i] != pMusic)
+        {this->musicFade(this->musicPlaying[i], 0, ms, LE_TRUE);}
+    }
+
+    // die Einblende steht fest, bevor der Audiothread das neue Stueck sieht
+
+    result = this->musicStart(id, loops, 0, ms);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicCrossfade(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::musicStop(uint32_t id, int ms)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    if(pMusic->playing && ms > 0)
+      {this->musicFade(pMusic, 0, ms, LE_TRUE);}
+    else if(pMusic->playing)
+      {this->musicRemove(pMusic);}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicStop(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::musicSetVolume(uint32_t id, uint8_t volume)
+{
+  int result = LE_NO_ERROR;
+  LEMusic * pMusic = this->musicGet(id);
+
+  if(pMusic != nullptr)
+  {
+    this->mtxMusic.playing.lock();
+    pMusic->volume = (volume > MIX_MAX_VOLUME) ? MIX_MAX_VOLUME : volume;
+    this->mtxMusic.playing.unlock();
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::musicSetVolume(%u)\n\n", id);
+      this->printErrorDialog(LE_MUSIC_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MUSIC_NOEXIST;
+  }
+
+  return result;
+}
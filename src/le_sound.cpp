@@ -1,262 +1,1608 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
-  date:               12.04.2018
-  updated:            12.04.2018
-
-  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
-*/
-
-#include "../include/le_moon.h"
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// private sound
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-LESound * LEMoon::soundGet(uint32_t id)
-{
-  LESound * pRet = nullptr;
-  LESound * pCurrent = nullptr;
-
-  if(this->pSoundHead != nullptr)
-  {
-    if(this->memory.pLastSound != nullptr && this->memory.pLastSound->id == id)
-      {pRet = this->memory.pLastSound;}
-    else
-    {
-      pCurrent = this->pSoundHead->pRight;
-
-      while(pCurrent != this->pSoundHead)
-      {
-        if(pCurrent->id == id)
-        {
-          pRet = pCurrent;
-          this->memory.pLastSound = pCurrent;
-          break;
-        }
-
-        pCurrent = pCurrent->pRight;
-      }
-    }
-  }
-
-  return pRet;
-}
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// public sound
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::soundCreate(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LESound * pNew = this->soundGet(id);
-
-  if(pNew == nullptr)
-  {
-    if(this->pSoundHead == nullptr)
-    {
-      this->pSoundHead = new LESound;
-      this->pSoundHead->pLeft = this->pSoundHead;
-      this->pSoundHead->pRight = this->pSoundHead;
-    }
-
-    pNew = new LESound;
-    pNew->pLeft = this->pSoundHead->pLeft;
-    pNew->pRight = this->pSoundHead;
-    this->pSoundHead->pLeft->pRight = pNew;
-    this->pSoundHead->pLeft = pNew;
-    pNew->id = id;
-    pNew->lock = LE_FALSE;
-    pNew->pSample = nullptr;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundCreate(%u)\n\n", id);
-      this->printErrorDialog(LE_SOUND_EXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_EXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::soundDelete(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LESound * pSound = this->soundGet(id);
-
-  if(pSound != nullptr)
-  {
-    pSound->pLeft->pRight = pSound->pRight;
-    pSound->pRight->pLeft = pSound->pLeft;
-
-    if(pSound->pSample != nullptr)
-      {Mix_FreeChunk(pSound->pSample);}
-
-    delete pSound;
-
-    if(this->pSoundHead->pLeft == this->pSoundHead && this->pSoundHead->pRight == this->pSoundHead)
-    {
-      delete this->pSoundHead;
-      this->pSoundHead = nullptr;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundDelete(%u)\n\n", id);
-      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::soundLoadWAV(uint32_t id, const char * pFile)
-{
-  int result = LE_NO_ERROR;
-  LESound * pSound = this->soundGet(id);
-
-  if(pSound != nullptr)
-  {
-    if(pSound->pSample == nullptr)
-    {
-      pSound->pSample = Mix_LoadWAV(pFile);
-
-      if(pSound->pSample == nullptr)
-      {
-        #ifdef LE_DEBUG
-          char * pErrorString = new char[256 + 1];
-          sprintf(pErrorString, "LEMoon::soundLoadWAV(%u, %s)\n\n", id, pFile);
-          this->printErrorDialog(LE_LOAD_WAV, pErrorString);
-          delete [] pErrorString;
-        #endif
-
-        result = LE_LOAD_WAV; 
-      }
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundLoadWAV(%u)\n\n", id);
-      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_NOEXIST;
-  }
-
-  return result;
-}
-
-void LEMoon::soundSetVolume(uint8_t volume)
-{
-  Mix_Volume(-1, volume);
-}
-
-int LEMoon::soundPlay(uint32_t id, int loops)
-{
-  int result = LE_NO_ERROR;
-  LESound * pSound = this->soundGet(id);
-
-  if(pSound != nullptr)
-  {
-    if(!(pSound->lock))
-    {
-      if(Mix_PlayChannel(-1, pSound->pSample, loops) == -1)
-      {
-        #ifdef LE_DEBUG
-          char * pErrorString = new char[256 + 1];
-          sprintf(pErrorString, "LEMoon::soundPlay(%u, %d)\n\n", id, loops);
-          this->printErrorDialog(LE_PLAY_CHANNEL, pErrorString);
-          delete [] pErrorString;
-        #endif
-
-        result = LE_PLAY_CHANNEL;
-      }
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundPlay(%u)\n\n", id);
-      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::soundLock(uint32_t id, bool lock)
-{
-  int result = LE_NO_ERROR;
-  LESound * pSound = this->soundGet(id);
-
-  if(pSound != nullptr)
-    {pSound->lock = lock;}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundLock(%d)\n\n", id);
-      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::soundFadeIn(uint32_t id, int ms)
-{
-  int result = LE_NO_ERROR;
-  LESound * pSound = this->soundGet(id);
-
-  if(pSound != nullptr)
-    {Mix_FadeInChannel(-1, pSound->pSample, -1, ms);}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::soundFadeIn(%u)\n\n", id);
-      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_SOUND_NOEXIST;
-  }
-
-  return result;
-}
-
-void LEMoon::soundFadeOut(int ms)
-{
-  Mix_FadeOutChannel(-1, ms);
-}
-
-void LEMoon::soundPause()
-{
-  Mix_HaltChannel(-1);
-}
\ No newline at end of file
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               12.04.2018
+  updated:            19.10.2026
+
+  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
+*/
+
+#include "../include/le_moon.h"
+
+#define LE_SOUND_DUCK_ATTACK      0.05f                                                       // Zeitkonstanten in Sekunden
+#define LE_SOUND_DUCK_RELEASE     0.4f
+#define LE_SOUND_LIMITER_ATTACK   0.002f
+#define LE_SOUND_LIMITER_RELEASE  0.2f
+#define LE_SOUND_LIMITER_HEADROOM 0.5f                                                        // -6 dB vor der Summe, die Summe von zwei vollen Kanaelen kappt so nicht
+#define LE_SOUND_PUSH_WAIT        50                                                          // Millisekunden, die der Spielthread bei vollem Ringpuffer auf den Audiothread wartet, etwa zwei Puffer
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+  #define LE_SOUND_X86
+  #include <emmintrin.h>
+  #include <immintrin.h>
+
+  #if defined(__GNUC__)
+    #define LE_SOUND_TARGET_SSE2 __attribute__((target("sse2")))
+    #define LE_SOUND_TARGET_AVX2 __attribute__((target("avx2")))
+  #else
+    #define LE_SOUND_TARGET_SSE2
+    #define LE_SOUND_TARGET_AVX2
+  #endif
+#endif
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// mix kernels
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+typedef int (*LEKernelSoundPeak)(const int16_t*, int);
+typedef void (*LEKernelSoundScale)(int16_t*, int, float, float, float, float, float, float, float);
+
+typedef struct sLESoundKernels
+{
+  LEKernelSoundPeak peak;                                       // groesster Betrag aller Samples
+  LEKernelSoundScale scale;                                     // Samples * Rampe * begrenzte Rampe, auf +- Schwelle gekappt (Samples, Anzahl, Verstaerkung, Schritt, Huellkurve, Schritt, Minimum, Maximum, Schwelle)
+} LESoundKernels;
+
+static inline float soundScaleSample(float sample, float frame, float gain, float gainStep, float envelope, float envelopeStep, float envelopeMin, float envelopeMax, float limit)
+{
+  // die Rampen laufen je Stereoframe, beide Kanaele eines Frames bekommen denselben Wert
+
+  envelope = envelope + envelopeStep * frame;
+  envelope = (envelope < envelopeMin) ? envelopeMin : ((envelope > envelopeMax) ? envelopeMax : envelope);
+  sample = sample * (gain + gainStep * frame) * envelope;
+
+  return (sample < -limit) ? -limit : ((sample > limit) ? limit : sample);
+}
+
+static int soundPeakScalar(const int16_t * pSamples, int amount)
+{
+  int peak = 0;
+  int value = 0;
+
+  for(int i = 0 ; i < amount ; i++)
+  {
+    value = (pSamples[i] < 0) ? -((int) pSamples[i]) : (int) pSamples[i];
+    peak = (value > peak) ? value : peak;
+  }
+
+  return peak;
+}
+
+static void soundScaleScalar(int16_t * pSamples, int amount, float gain, float gainStep, float envelope, float envelopeStep, float envelopeMin, float envelopeMax, float limit)
+{
+  for(int i = 0 ; i < amount ; i++)
+    {pSamples[i] = (int16_t) soundScaleSample((float) pSamples[i], (float) (i >> 1), gain, gainStep, envelope, envelopeStep, envelopeMin, envelopeMax, limit);}
+}
+
+#ifdef LE_SOUND_X86
+
+LE_SOUND_TARGET_SSE2 static int soundPeakSSE2(const int16_t * pSamples, int amount)
+{
+  __m128i vMax = _mm_setzero_si128();
+  __m128i vMin = _mm_setzero_si128();
+  int16_t maxima[8];
+  int16_t minima[8];
+  int peak = 0;
+  int i = 0;
+
+  // Maximum und Minimum getrennt, der Betrag von -32768 passt nicht in int16_t
+
+  for( ; i + 8 <= amount ; i += 8)
+  {
+    vMax = _mm_max_epi16(vMax, _mm_loadu_si128((const __m128i*) &pSamples[i]));
+    vMin = _mm_min_epi16(vMin, _mm_loadu_si128((const __m128i*) &pSamples[i]));
+  }
+
+  _mm_storeu_si128((__m128i*) maxima, vMax);
+  _mm_storeu_si128((__m128i*) minima, vMin);
+
+  for(int j = 0 ; j < 8 ; j++)
+  {
+    peak = ((int) maxima[j] > peak) ? (int) maxima[j] : peak;
+    peak = (-((int) minima[j]) > peak) ? -((int) minima[j]) : peak;
+  }
+
+  if(i < amount)
+  {
+    amount = soundPeakScalar(&pSamples[i], amount - i);
+    peak = (amount > peak) ? amount : peak;
+  }
+
+  return peak;
+}
+
+LE_SOUND_TARGET_SSE2 static void soundScaleSSE2(int16_t * pSamples, int amount, float gain, float gainStep, float envelope, float envelopeStep, float envelopeMin, float envelopeMax, float limit)
+{
+  __m128 vGain = _mm_set1_ps(gain);
+  __m128 vGainStep = _mm_set1_ps(gainStep);
+  __m128 vEnvelope = _mm_set1_ps(envelope);
+  __m128 vEnvelopeStep = _mm_set1_ps(envelopeStep);
+  __m128 vEnvelopeMin = _mm_set1_ps(envelopeMin);
+  __m128 vEnvelopeMax = _mm_set1_ps(envelopeMax);
+  __m128 vLimit = _mm_set1_ps(limit);
+  __m128 vNegativeLimit = _mm_set1_ps(-limit);
+  __m128 frameLow = _mm_set_ps(1.0f, 1.0f, 0.0f, 0.0f);
+  __m128 frameHigh = _mm_set_ps(3.0f, 3.0f, 2.0f, 2.0f);
+  __m128 frame, low, high;
+  __m128i samples;
+  int i = 0;
+
+  // vier Stereoframes pro Durchlauf, dieselben Rechenschritte wie soundScaleSample()
+
+  for( ; i + 8 <= amount ; i += 8)
+  {
+    samples = _mm_loadu_si128((const __m128i*) &pSamples[i]);
+    frame = _mm_add_ps(_mm_set1_ps((float) (i >> 1)), frameLow);
+    low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16));
+    low = _mm_mul_ps(_mm_mul_ps(low, _mm_add_ps(vGain, _mm_mul_ps(vGainStep, frame))), _mm_min_ps(_mm_max_ps(_mm_add_ps(vEnvelope, _mm_mul_ps(vEnvelopeStep, frame)), vEnvelopeMin), vEnvelopeMax));
+    low = _mm_min_ps(_mm_max_ps(low, vNegativeLimit), vLimit);
+    frame = _mm_add_ps(_mm_set1_ps((float) (i >> 1)), frameHigh);
+    high = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16));
+    high = _mm_mul_ps(_mm_mul_ps(high, _mm_add_ps(vGain, _mm_mul_ps(vGainStep, frame))), _mm_min_ps(_mm_max_ps(_mm_add_ps(vEnvelope, _mm_mul_ps(vEnvelopeStep, frame)), vEnvelopeMin), vEnvelopeMax));
+    high = _mm_min_ps(_mm_max_ps(high, vNegativeLimit), vLimit);
+    _mm_storeu_si128((__m128i*) &pSamples[i], _mm_packs_epi32(_mm_cvttps_epi32(low), _mm_cvttps_epi32(high)));
+  }
+
+  for( ; i < amount ; i++)
+    {pSamples[i] = (int16_t) soundScaleSample((float) pSamples[i], (float) (i >> 1), gain, gainStep, envelope, envelopeStep, envelopeMin, envelopeMax, limit);}
+}
+
+LE_SOUND_TARGET_AVX2 static int soundPeakAVX2(const int16_t * pSamples, int amount)
+{
+  __m256i vMax = _mm256_setzero_si256();
+  __m256i vMin = _mm256_setzero_si256();
+  int16_t maxima[16];
+  int16_t minima[16];
+  int peak = 0;
+  int i = 0;
+
+  for( ; i + 16 <= amount ; i += 16)
+  {
+    vMax = _mm256_max_epi16(vMax, _mm256_loadu_si256((const __m256i*) &pSamples[i]));
+    vMin = _mm256_min_epi16(vMin, _mm256_loadu_si256((const __m256i*) &pSamples[i]));
+  }
+
+  _mm256_storeu_si256((__m256i*) maxima, vMax);
+  _mm256_storeu_si256((__m256i*) minima, vMin);
+
+  for(int j = 0 ; j < 16 ; j++)
+  {
+    peak = ((int) maxima[j] > peak) ? (int) maxima[j] : peak;
+    peak = (-((int) minima[j]) > peak) ? -((int) minima[j]) : peak;
+  }
+
+  if(i < amount)
+  {
+    amount = soundPeakSSE2(&pSamples[i], amount - i);
+    peak = (amount > peak) ? amount : peak;
+  }
+
+  return peak;
+}
+
+LE_SOUND_TARGET_AVX2 static void soundScaleAVX2(int16_t * pSamples, int amount, float gain, float gainStep, float envelope, float envelopeStep, float envelopeMin, float envelopeMax, float limit)
+{
+  __m256 vGain = _mm256_set1_ps(gain);
+  __m256 vGainStep = _mm256_set1_ps(gainStep);
+  __m256 vEnvelope = _mm256_set1_ps(envelope);
+  __m256 vEnvelopeStep = _mm256_set1_ps(envelopeStep);
+  __m256 vEnvelopeMin = _mm256_set1_ps(envelopeMin);
+  __m256 vEnvelopeMax = _mm256_set1_ps(envelopeMax);
+  __m256 vLimit = _mm256_set1_ps(limit);
+  __m256 vNegativeLimit = _mm256_set1_ps(-limit);
+  __m256 frameLow = _mm256_set_ps(3.0f, 3.0f, 2.0f, 2.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+  __m256 frameHigh = _mm256_set_ps(7.0f, 7.0f, 6.0f, 6.0f, 5.0f, 5.0f, 4.0f, 4.0f);
+  __m256 frame, low, high;
+  int i = 0;
+
+  // acht Stereoframes pro Durchlauf, packs arbeitet je 128 Bit Haelfte, die Permutation stellt die Reihenfolge wieder her
+
+  for( ; i + 16 <= amount ; i += 16)
+  {
+    frame = _mm256_add_ps(_mm256_set1_ps((float) (i >> 1)), frameLow);
+    low = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*) &pSamples[i])));
+    low = _mm256_mul_ps(_mm256_mul_ps(low, _mm256_add_ps(vGain, _mm256_mul_ps(vGainStep, frame))), _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(vEnvelope, _mm256_mul_ps(vEnvelopeStep, frame)), vEnvelopeMin), vEnvelopeMax));
+    low = _mm256_min_ps(_mm256_max_ps(low, vNegativeLimit), vLimit);
+    frame = _mm256_add_ps(_mm256_set1_ps((float) (i >> 1)), frameHigh);
+    high = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*) &pSamples[i + 8])));
+    high = _mm256_mul_ps(_mm256_mul_ps(high, _mm256_add_ps(vGain, _mm256_mul_ps(vGainStep, frame))), _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(vEnvelope, _mm256_mul_ps(vEnvelopeStep, frame)), vEnvelopeMin), vEnvelopeMax));
+    high = _mm256_min_ps(_mm256_max_ps(high, vNegativeLimit), vLimit);
+    _mm256_storeu_si256((__m256i*) &pSamples[i], _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_cvttps_epi32(low), _mm256_cvttps_epi32(high)), _MM_SHUFFLE(3, 1, 2, 0)));
+  }
+
+  for( ; i < amount ; i++)
+    {pSamples[i] = (int16_t) soundScaleSample((float) pSamples[i], (float) (i >> 1), gain, gainStep, envelope, envelopeStep, envelopeMin, envelopeMax, limit);}
+}
+
+#endif
+
+static LESoundKernels soundSelectKernels()
+{
+  LESoundKernels kernels = {soundPeakScalar, soundScaleScalar};
+
+  #ifdef LE_SOUND_X86
+    if(SDL_HasAVX2())
+    {
+      kernels.peak = soundPeakAVX2;
+      kernels.scale = soundScaleAVX2;
+    }
+    else if(SDL_HasSSE2())
+    {
+      kernels.peak = soundPeakSSE2;
+      kernels.scale = soundScaleSSE2;
+    }
+  #endif
+
+  return kernels;
+}
+
+static const LESoundKernels & soundGetKernels()
+{
+  static const LESoundKernels kernels = soundSelectKernels();
+
+  return kernels;
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private sound
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static inline float soundClamp(float value)
+{
+  return (value > 32767.0f) ? 32767.0f : ((value < -32768.0f) ? -32768.0f : value);
+}
+
+void LEMoon::soundClearJobs()
+{
+  this->mtxSound.finishedJobs.lock();
+
+  for(size_t i = 0 ; i < this->finishedSoundJobs.size() ; i++)
+  {
+    if(this->finishedSoundJobs[i]->pSample != nullptr)
+      {Mix_FreeChunk(this->finishedSoundJobs[i]->pSample);}
+
+    delete this->finishedSoundJobs[i];
+  }
+
+  this->soundBank.pending -= (uint32_t) this->finishedSoundJobs.size();
+  this->finishedSoundJobs.clear();
+  this->mtxSound.finishedJobs.unlock();
+}
+
+void LEMoon::soundDecode(LESound * pSound, const char * pFile)
+{
+  LESoundJob * pJob = nullptr;
+
+  if(pSound->decodeRequest == 0)
+  {
+    // 0 steht fuer keinen laufenden Auftrag
+
+    if(++this->soundBank.requests == 0)
+      {this->soundBank.requests++;}
+
+    pJob = new LESoundJob;
+    pJob->idSound = pSound->id;
+    pJob->request = this->soundBank.requests;
+    pJob->pData = pSound->pCompressed;
+    pJob->file = (pFile != nullptr) ? pFile : "";
+    pJob->pSample = nullptr;
+    pSound->decodeRequest = pJob->request;
+    this->soundBank.pending++;
+
+    // der Auftrag teilt sich die komprimierten Bytes, falls der Sound waehrenddessen geloescht wird
+
+    this->worker.workerPost([this, pJob]
+    {
+      if(pJob->pData != nullptr)
+        {pJob->pSample = Mix_LoadWAV_RW(SDL_RWFromConstMem(pJob->pData->data(), (int) pJob->pData->size()), 1);}
+      else
+        {pJob->pSample = Mix_LoadWAV(pJob->file.c_str());}
+
+      this->mtxSound.finishedJobs.lock();
+      this->finishedSoundJobs.push_back(pJob);
+      this->mtxSound.finishedJobs.unlock();
+    });
+  }
+}
+
+void LEMoon::soundDrainCommands()
+{
+  uint32_t read = this->soundQueue.read.load(memory_order_relaxed);
+  uint32_t write = this->soundQueue.write.load(memory_order_acquire);
+
+  // alle Befehle seit dem letzten Durchlauf auf einmal, es gibt immer nur einen Leser: den Audiothread oder nach Mix_HookMusic(nullptr, nullptr) den Spielthread
+
+  while(read != write)
+  {
+    soundRunCommand(&(this->soundMixer), this->soundQueue.commands[read & (LE_SOUND_COMMANDS - 1)]);
+    read++;
+  }
+
+  this->soundQueue.read.store(read, memory_order_release);
+}
+
+void LEMoon::soundEvict()
+{
+  uint32_t now = SDL_GetTicks();
+  LESound * pCurrent = nullptr;
+  LESound * pOldest = nullptr;
+  bool playing = LE_FALSE;
+
+  while(this->soundBank.used > this->soundBank.budget && this->pSoundHead != nullptr)
+  {
+    pOldest = nullptr;
+    pCurrent = this->pSoundHead->pRight;
+
+    while(pCurrent != this->pSoundHead)
+    {
+      if(pCurrent->pCompressed != nullptr && pCurrent->pSample != nullptr && !(pCurrent->pinned) && (pOldest == nullptr || pCurrent->lastUse < pOldest->lastUse))
+      {
+        playing = LE_FALSE;
+
+        for(size_t i = 0 ; i < this->soundVoices.size() && !playing ; i++)
+          {playing = (this->soundVoices[i].pSound == pCurrent && now < this->soundVoices[i].end);}
+
+        if(!playing)
+          {pOldest = pCurrent;}
+      }
+
+      pCurrent = pCurrent->pRight;
+    }
+
+    // alles Uebrige ist angeheftet oder laeuft gerade, das Budget wird dann voruebergehend ueberschritten
+
+    if(pOldest == nullptr)
+      {break;}
+
+    this->soundBank.used -= (size_t) pOldest->pSample->alen;
+    this->soundPushCommand(LE_SOUND_CMD_FREE, pOldest->pSample, -1, 0, 0);
+    pOldest->pSample = nullptr;
+  }
+}
+
+LESound * LEMoon::soundGet(uint32_t id)
+{
+  LESound * pRet = nullptr;
+  LESound * pCurrent = nullptr;
+
+  if(this->pSoundHead != nullptr)
+  {
+    if(this->memory.pLastSound != nullptr && this->memory.pLastSound->id == id)
+      {pRet = this->memory.pLastSound;}
+    else
+    {
+      pCurrent = this->pSoundHead->pRight;
+
+      while(pCurrent != this->pSoundHead)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastSound = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  return pRet;
+}
+
+int LEMoon::soundGetVoice(LESound * pSound, uint32_t now)
+{
+  int channel = -1;
+  int channels = Mix_AllocateChannels(-1);
+  int instances = 0;
+  int oldest = -1;
+  int weakest = -1;
+  LEVoice * pVoice = nullptr;
+  LEVoice freeVoice = {nullptr, 0, 0, 0, LE_FALSE, 0, LE_FALSE, -1, -1};
+
+  // initSound() oder der Nutzer koennen die Anzahl der Kanaele veraendert haben
+
+  if(channels >= 0 && this->soundVoices.size() != (size_t) channels)
+    {this->soundVoices.resize((size_t) channels, freeVoice);}
+
+  for(size_t i = 0 ; i < this->soundVoices.size() ; i++)
+  {
+    pVoice = &(this->soundVoices[i]);
+
+    if(pVoice->pSound != nullptr && now >= pVoice->end)
+      {pVoice->pSound = nullptr;}
+
+    if(pVoice->pSound == nullptr)
+    {
+      if(channel < 0)
+        {channel = (int) i;}
+    }
+    else
+    {
+      if(pVoice->pSound == pSound)
+      {
+        instances++;
+
+        if(oldest < 0 || pVoice->start < this->soundVoices[oldest].start)
+          {oldest = (int) i;}
+      }
+
+      if(weakest < 0 || pVoice->priority < this->soundVoices[weakest].priority || (pVoice->priority == this->soundVoices[weakest].priority && pVoice->start < this->soundVoices[weakest].start))
+        {weakest = (int) i;}
+    }
+  }
+
+  // zu viele Instanzen starten die aelteste neu, volle Kanaele geben die unwichtigste Stimme ab, wenn sie nicht wichtiger ist
+
+  if(pSound->maxInstances > 0 && instances >= pSound->maxInstances)
+    {channel = oldest;}
+  else if(channel < 0 && weakest >= 0 && this->soundVoices[weakest].priority <= pSound->priority)
+    {channel = weakest;}
+
+  return channel;
+}
+
+void LEMoon::soundMixBus(LESoundBus * pBus, int16_t * pSamples, int amount, float * pState)
+{
+  int frames = amount / 2;
+  float gain = pBus->gainFrom;
+  float gainStep = 0.0f;
+  float coefficient = pBus->coefficientFrom;
+  float coefficientStep = 0.0f;
+
+  if(frames > 0)
+  {
+    gainStep = (pBus->gainTo - pBus->gainFrom) / (float) frames;
+
+    if(pBus->coefficientFrom < 1.0f || pBus->coefficientTo < 1.0f)
+    {
+      // der Tiefpass haengt vom vorherigen Sample ab und laeuft daher seriell, die Verstaerkung im selben Durchlauf
+
+      coefficientStep = (pBus->coefficientTo - pBus->coefficientFrom) / (float) frames;
+
+      for(int i = 0 ; i < frames ; i++)
+      {
+        pState[0] += coefficient * ((float) pSamples[2 * i] - pState[0]);
+        pState[1] += coefficient * ((float) pSamples[2 * i + 1] - pState[1]);
+        pSamples[2 * i] = (int16_t) soundClamp(pState[0] * gain);
+        pSamples[2 * i + 1] = (int16_t) soundClamp(pState[1] * gain);
+        gain += gainStep;
+        coefficient += coefficientStep;
+      }
+    }
+    else if(pBus->gainFrom != 1.0f || pBus->gainTo != 1.0f)
+      {soundGetKernels().scale(pSamples, amount, gain, gainStep, 1.0f, 0.0f, 1.0f, 1.0f, 32767.0f);}
+  }
+}
+
+void SDLCALL LEMoon::soundMixChannel(int channel, void * pStream, int length, void * pUserData)
+{
+  LESoundMixer * pMixer = (LESoundMixer*) pUserData;
+  LESoundChannelMix * pChannel = nullptr;
+
+  if(pMixer->supported && channel >= 0 && (size_t) channel < pMixer->channels.size())
+  {
+    pChannel = &(pMixer->channels[channel]);
+    pMixer->buses[pChannel->bus].activeNow = LE_TRUE;
+    soundMixBus(&(pMixer->buses[pChannel->bus]), (int16_t*) pStream, length / 2, pChannel->state);
+  }
+}
+
+void SDLCALL LEMoon::soundMixMaster(void * pUserData, uint8_t * pStream, int length)
+{
+  LESoundMixer * pMixer = (LESoundMixer*) pUserData;
+  const LESoundKernels & kernels = soundGetKernels();
+  int16_t * pSamples = (int16_t*) pStream;
+  int amount = length / 2;
+  int frames = amount / 2;
+  float limit = pMixer->limit.load(memory_order_relaxed) * 32767.0f;
+  float makeupFrom = 1.0f / pMixer->headroomFrom;
+  float makeupTo = 1.0f / pMixer->headroomTo;
+  float makeupStep = 0.0f;
+  float attackFrames = pMixer->frequency * LE_SOUND_LIMITER_ATTACK;
+  int peak = 0;
+  float target = 1.0f;
+  float from = pMixer->limiterGain;
+  float to = 1.0f;
+
+  if(pMixer->supported && frames > 0 && (limit < 32767.0f || from < 1.0f || makeupFrom > 1.0f || makeupTo > 1.0f))
+  {
+    peak = kernels.peak(pSamples, amount);
+
+    // die Spitze nach dem Ausgleich der Reserve bestimmt die Verstaerkung
+
+    if((float) peak * ((makeupFrom > makeupTo) ? makeupFrom : makeupTo) > limit)
+      {target = limit / ((float) peak * ((makeupFrom > makeupTo) ? makeupFrom : makeupTo));}
+
+    makeupStep = (makeupTo - makeupFrom) / (float) frames;
+
+    if(target < from)
+    {
+      // kurzer Anstieg statt eines Sprungs an der Puffergrenze, Spitzen darin werden an der Schwelle abgeschnitten
+
+      to = target;
+      kernels.scale(pSamples, amount, makeupFrom, makeupStep, from, (to - from) / attackFrames, to, from, limit);
+    }
+    else
+    {
+      // langsam wieder loslassen
+
+      to = from + (target - from) * (1.0f - expf(-(float) frames / (pMixer->frequency * LE_SOUND_LIMITER_RELEASE)));
+      kernels.scale(pSamples, amount, makeupFrom, makeupStep, from, (to - from) / (float) frames, from, to, limit);
+    }
+
+    pMixer->limiterGain = to;
+  }
+}
+
+void LEMoon::soundMixUpdateBuses(int length)
+{
+  LESoundBus * pBus = nullptr;
+  float seconds = (float) length / (4.0f * (float) this->soundMixer.frequency);
+  float attack = 1.0f - expf(-seconds / LE_SOUND_DUCK_ATTACK);
+  float release = 1.0f - expf(-seconds / LE_SOUND_DUCK_RELEASE);
+  float target = 1.0f;
+  float cutoff = 0.0f;
+  int duckBy = -1;
+
+  // die Reserve gilt fuer alle Busse im selben Puffer, soundMixMaster() gleicht sie mit demselben Verlauf wieder aus
+
+  this->soundMixer.headroomFrom = this->soundMixer.headroomTo;
+  this->soundMixer.headroomTo = (this->soundMixer.limit.load(memory_order_relaxed) < 1.0f) ? LE_SOUND_LIMITER_HEADROOM : 1.0f;
+
+  // die Kanaele des letzten Puffers bestimmen die Absenkung, AUDIO_S16SYS in Stereo = 4 Bytes je Frame
+
+  for(int i = 0 ; i < LE_SOUND_BUSES ; i++)
+  {
+    pBus = &(this->soundMixer.buses[i]);
+    duckBy = pBus->duckBy.load(memory_order_relaxed);
+    target = (duckBy >= 0 && duckBy < LE_SOUND_BUSES && this->soundMixer.buses[duckBy].active) ? pBus->duckGain.load(memory_order_relaxed) : 1.0f;
+    pBus->duck += (target - pBus->duck) * ((target < pBus->duck) ? attack : release);
+    pBus->gainFrom = pBus->gainTo;
+    pBus->gainTo = pBus->gain.load(memory_order_relaxed) * pBus->duck * this->soundMixer.headroomTo;
+
+    cutoff = pBus->cutoff.load(memory_order_relaxed);
+    pBus->coefficientFrom = pBus->coefficientTo;
+    pBus->coefficientTo = (cutoff > 0.0f && cutoff < this->soundMixer.frequency * 0.5f) ? 1.0f - expf(-2.0f * (float) M_PI * cutoff / (float) this->soundMixer.frequency) : 1.0f;
+  }
+
+  for(int i = 0 ; i < LE_SOUND_BUSES ; i++)
+  {
+    this->soundMixer.buses[i].active = this->soundMixer.buses[i].activeNow;
+    this->soundMixer.buses[i].activeNow = LE_FALSE;
+  }
+}
+
+void LEMoon::soundPositionVoice(int channel, float x, float y, float distance)
+{
+  LEVoice * pVoice = &(this->soundVoices[channel]);
+  int angle = 0;
+
+  // Stimmen ausserhalb des Hoerradius werden nicht gemischt
+
+  if(distance > 255.0f)
+  {
+    if(pVoice->end == UINT32_MAX)
+    {
+      if(!(pVoice->culled))
+      {
+        this->soundPushCommand(LE_SOUND_CMD_PAUSE, nullptr, channel, 0, 0);
+        pVoice->culled = LE_TRUE;
+      }
+    }
+    else
+    {
+      // ein einmaliger Sound waere beim Zurueckkehren ohnehin nicht mehr an der richtigen Stelle
+
+      this->soundPushCommand(LE_SOUND_CMD_HALT, nullptr, channel, 0, 0);
+      pVoice->pSound = nullptr;
+    }
+  }
+  else
+  {
+    if(pVoice->culled)
+    {
+      this->soundPushCommand(LE_SOUND_CMD_RESUME, nullptr, channel, 0, 0);
+      pVoice->culled = LE_FALSE;
+    }
+
+    // Mix_SetPosition(): 0 Grad = vorne bzw. oben, 90 Grad = rechts
+
+    angle = (int) lroundf(atan2f(x, -y) * 57.29578f);
+    angle = (angle + 360) % 360;
+
+    if(angle != pVoice->angle || (int) distance != pVoice->distance)
+    {
+      this->soundPushCommand(LE_SOUND_CMD_POSITION, nullptr, channel, angle, (int) distance);
+      pVoice->angle = angle;
+      pVoice->distance = (int) distance;
+    }
+  }
+}
+
+void LEMoon::soundPushCommand(uint8_t type, Mix_Chunk * pSample, int channel, int loops, int value)
+{
+  LESoundCommand command = {type, pSample, channel, loops, value};
+  uint32_t write = this->soundQueue.write.load(memory_order_relaxed);
+  uint32_t start = 0;
+  bool full = LE_FALSE;
+
+  if(this->soundQueue.drained)
+  {
+    // solange Mix_HookMusic() registriert ist, liest nur der Audiothread, SDL_LockAudio() sperrt das Geraet von SDL_mixer nicht,
+    // daher wird bei vollem Ringpuffer kurz gewartet, ob der Audiothread weiterliest
+
+    full = write - this->soundQueue.read.load(memory_order_acquire) >= LE_SOUND_COMMANDS;
+
+    if(full && !(this->soundQueue.stalled))
+    {
+      start = SDL_GetTicks();
+
+      while(full && SDL_GetTicks() - start < LE_SOUND_PUSH_WAIT)
+      {
+        SDL_Delay(1);
+        full = write - this->soundQueue.read.load(memory_order_acquire) >= LE_SOUND_COMMANDS;
+      }
+    }
+
+    this->soundQueue.stalled = full;
+
+    if(!full)
+    {
+      this->soundQueue.commands[write & (LE_SOUND_COMMANDS - 1)] = command;
+      this->soundQueue.write.store(write + 1, memory_order_release);
+    }
+    else
+    {
+      // steht der Audiothread (Geraet pausiert oder verloren), geht der Befehl verloren, ein verworfenes LE_SOUND_CMD_FREE laesst den Chunk liegen
+
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::soundPushCommand(%u, %d)\n\n", type, channel);
+        this->printErrorDialog(LE_SOUND_QUEUE_FULL, pErrorString);
+        delete [] pErrorString;
+      #endif
+    }
+  }
+  else
+    {soundRunCommand(&(this->soundMixer), command);}
+}
+
+void LEMoon::soundRunCommand(LESoundMixer * pMixer, const LESoundCommand &command)
+{
+  switch(command.type)
+  {
+    case LE_SOUND_CMD_PLAY:
+    {
+      // SDL_mixer entfernt die Effekte eines Kanals, sobald er endet oder neu startet
+
+      if(Mix_PlayChannel(command.channel, command.pSample, command.loops) >= 0)
+        {Mix_RegisterEffect(command.channel, LEMoon::soundMixChannel, nullptr, pMixer);}
+    } break;
+    case LE_SOUND_CMD_FADE_IN:
+    {
+      if(Mix_FadeInChannel(command.channel, command.pSample, command.loops, command.value) >= 0)
+        {Mix_RegisterEffect(command.channel, LEMoon::soundMixChannel, nullptr, pMixer);}
+    } break;
+    case LE_SOUND_CMD_FADE_OUT:
+    {
+      Mix_FadeOutChannel(command.channel, command.value);
+    } break;
+    case LE_SOUND_CMD_HALT:
+    {
+      Mix_HaltChannel(command.channel);
+    } break;
+    case LE_SOUND_CMD_VOLUME:
+    {
+      Mix_Volume(command.channel, command.value);
+    } break;
+    case LE_SOUND_CMD_FREE:
+    {
+      Mix_FreeChunk(command.pSample);
+    } break;
+    case LE_SOUND_CMD_POSITION:
+    {
+      Mix_SetPosition(command.channel, (Sint16) command.loops, (Uint8) command.value);
+    } break;
+    case LE_SOUND_CMD_PAUSE:
+    {
+      Mix_Pause(command.channel);
+    } break;
+    case LE_SOUND_CMD_RESUME:
+    {
+      Mix_Resume(command.channel);
+    } break;
+    case LE_SOUND_CMD_BUS:
+    {
+      // kommt vor LE_SOUND_CMD_PLAY, der neue Sound beginnt mit leerem Tiefpass
+
+      if((size_t) command.channel >= pMixer->channels.size())
+        {pMixer->channels.resize((size_t) command.channel + 1);}
+
+      pMixer->channels[command.channel].bus = (uint8_t) command.value;
+      pMixer->channels[command.channel].state[0] = 0.0f;
+      pMixer->channels[command.channel].state[1] = 0.0f;
+    } break;
+  };
+}
+
+int LEMoon::soundStartVoice(LESound * pSound, int loops, int ms, int * pChannel)
+{
+  int result = LE_NO_ERROR;
+  uint32_t now = SDL_GetTicks();
+  int channel = -1;
+  int frequency = 0;
+  Uint16 format = 0;
+  int channels = 0;
+  uint32_t length = 0;
+
+  if(pSound->pSample == nullptr)
+  {
+    // Sounds aus der Soundbank oder von soundLoadAsync() starten erst danach, der Spielthread wartet nicht darauf
+
+    if(pSound->pCompressed != nullptr || pSound->decodeRequest != 0)
+    {
+      if(pSound->pCompressed != nullptr)
+        {this->soundDecode(pSound, nullptr);}
+
+      pSound->pending.active = LE_TRUE;
+      pSound->pending.loops = loops;
+      pSound->pending.ms = ms;
+      pSound->pending.positional = LE_FALSE;
+    }
+    else
+      {result = LE_PLAY_CHANNEL;}
+  }
+  else if(pSound->lastFrame != this->soundFrame && (pSound->lastStart == 0 || now - pSound->lastStart >= pSound->retriggerInterval))
+  {
+    // weitere Anforderungen im selben Frame oder innerhalb des Mindestabstands belegen keinen weiteren Kanal
+
+    channel = this->soundGetVoice(pSound, now);
+
+    if(channel >= 0)
+    {
+      // der Kanal steht fest, daher braucht der Spielthread keine Antwort vom Audiothread
+
+      this->soundPushCommand(LE_SOUND_CMD_BUS, nullptr, channel, 0, pSound->bus);
+      this->soundPushCommand((ms > 0) ? LE_SOUND_CMD_FADE_IN : LE_SOUND_CMD_PLAY, pSound->pSample, channel, loops, ms);
+
+      if(Mix_QuerySpec(&frequency, &format, &channels) && frequency > 0)
+        {length = (uint32_t) ((uint64_t) pSound->pSample->alen * 1000 / ((uint64_t) frequency * channels * (SDL_AUDIO_BITSIZE(format) / 8)));}
+
+      this->soundVoices[channel].pSound = pSound;
+      this->soundVoices[channel].priority = pSound->priority;
+      this->soundVoices[channel].start = now;
+      this->soundVoices[channel].end = (loops < 0) ? UINT32_MAX : now + length * (uint32_t) (loops + 1);
+      this->soundVoices[channel].positional = LE_FALSE;
+      this->soundVoices[channel].culled = LE_FALSE;
+      this->soundVoices[channel].angle = -1;
+      this->soundVoices[channel].distance = -1;
+      pSound->lastStart = now;
+      pSound->lastFrame = this->soundFrame;
+      pSound->lastUse = ++this->soundBank.clock;
+    }
+  }
+
+  if(pChannel != nullptr)
+    {*pChannel = channel;}
+
+  return result;
+}
+
+void LEMoon::soundUpdateEmitters()
+{
+  uint32_t now = SDL_GetTicks();
+  LEVoice * pVoice = nullptr;
+  LEModel * pModel = nullptr;
+  glm::vec2 position;
+  SDL_Point size;
+  float scale = 255.0f / ((this->soundListener.radius > 0.0f) ? this->soundListener.radius : 1.0f);
+  size_t count = 0;
+
+  this->soundEmitters.channels.clear();
+  this->soundEmitters.x.clear();
+  this->soundEmitters.y.clear();
+
+  // 1. Durchlauf: Positionen der Models relativ zum Zuhoerer sammeln, Stimmen ohne Model enden mit ihm
+
+  for(size_t i = 0 ; i < this->soundVoices.size() ; i++)
+  {
+    pVoice = &(this->soundVoices[i]);
+
+    if(pVoice->pSound != nullptr && pVoice->positional)
+    {
+      if(now >= pVoice->end)
+        {pVoice->pSound = nullptr;}
+      else if((pModel = this->modelGet(pVoice->idModel)) == nullptr)
+      {
+        this->soundPushCommand(LE_SOUND_CMD_HALT, nullptr, (int) i, 0, 0);
+        pVoice->pSound = nullptr;
+      }
+      else
+      {
+        position = pModel->pModel->mdlGetPositionD();
+        size = pModel->pModel->mdlGetSize();
+        this->soundEmitters.channels.push_back((int) i);
+        this->soundEmitters.x.push_back(position.x + size.x * 0.5f - this->soundListener.position.x);
+        this->soundEmitters.y.push_back(position.y + size.y * 0.5f - this->soundListener.position.y);
+      }
+    }
+  }
+
+  // 2. Durchlauf: Entfernungen aller Stimmen ohne Verzweigungen, damit der Compiler die Schleife vektorisieren kann
+
+  count = this->soundEmitters.channels.size();
+  this->soundEmitters.distance.resize(count);
+
+  {
+    const float * pX = this->soundEmitters.x.data();
+    const float * pY = this->soundEmitters.y.data();
+    float * pDistance = this->soundEmitters.distance.data();
+
+    for(size_t i = 0 ; i < count ; i++)
+      {pDistance[i] = sqrtf(pX[i] * pX[i] + pY[i] * pY[i]) * scale;}
+  }
+
+  // 3. Durchlauf: nur geaenderte Werte gehen an den Audiothread
+
+  for(size_t i = 0 ; i < count ; i++)
+    {this->soundPositionVoice(this->soundEmitters.channels[i], this->soundEmitters.x[i], this->soundEmitters.y[i], this->soundEmitters.distance[i]);}
+}
+
+void LEMoon::soundUploadJobs()
+{
+  vector<LESoundJob*> jobs;
+  LESound * pSound = nullptr;
+  int channel = -1;
+  bool positional = LE_FALSE;
+
+  this->mtxSound.finishedJobs.lock();
+  jobs.swap(this->finishedSoundJobs);
+  this->mtxSound.finishedJobs.unlock();
+
+  for(size_t i = 0 ; i < jobs.size() ; i++)
+  {
+    pSound = this->soundGet(jobs[i]->idSound);
+    this->soundBank.pending--;
+
+    // geloeschte Sounds verwerfen das Ergebnis, erst hier wird der Chunk im Spielthread sichtbar
+
+    if(pSound != nullptr && pSound->decodeRequest == jobs[i]->request)
+    {
+      pSound->decodeRequest = 0;
+
+      if(jobs[i]->pSample != nullptr)
+      {
+        pSound->pSample = jobs[i]->pSample;
+        pSound->lastUse = ++this->soundBank.clock;
+        jobs[i]->pSample = nullptr;
+
+        if(pSound->pCompressed != nullptr)
+          {this->soundBank.used += (size_t) pSound->pSample->alen;}
+
+        if(pSound->pending.active)
+        {
+          channel = -1;
+          this->soundStartVoice(pSound, pSound->pending.loops, pSound->pending.ms, &channel);
+
+          if(channel >= 0 && pSound->pending.positional)
+          {
+            this->soundVoices[channel].positional = LE_TRUE;
+            this->soundVoices[channel].idModel = pSound->pending.idModel;
+            positional = LE_TRUE;
+          }
+        }
+      }
+      else
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+
+          if(jobs[i]->pData != nullptr)
+          {
+            sprintf(pErrorString, "LEMoon::soundUploadJobs(%u)\n\n", pSound->id);
+            this->printErrorDialog(LE_DECODE_SOUND, pErrorString);
+          }
+          else
+          {
+            sprintf(pErrorString, "LEMoon::soundLoadAsync(%u, %s)\n\n", pSound->id, jobs[i]->file.c_str());
+            this->printErrorDialog(LE_LOAD_WAV, pErrorString);
+          }
+
+          delete [] pErrorString;
+        #endif
+      }
+
+      pSound->pending.active = LE_FALSE;
+    }
+
+    if(jobs[i]->pSample != nullptr)
+      {Mix_FreeChunk(jobs[i]->pSample);}
+
+    delete jobs[i];
+  }
+
+  if(positional)
+    {this->soundUpdateEmitters();}
+
+  if(!jobs.empty())
+    {this->soundEvict();}
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public sound
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::soundCreate(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LESound * pNew = this->soundGet(id);
+
+  if(pNew == nullptr)
+  {
+    if(this->pSoundHead == nullptr)
+    {
+      this->pSoundHead = new LESound;
+      this->pSoundHead->pLeft = this->pSoundHead;
+      this->pSoundHead->pRight = this->pSoundHead;
+    }
+
+    pNew = new LESound;
+    pNew->pLeft = this->pSoundHead->pLeft;
+    pNew->pRight = this->pSoundHead;
+    this->pSoundHead->pLeft->pRight = pNew;
+    this->pSoundHead->pLeft = pNew;
+    pNew->id = id;
+    pNew->lock = LE_FALSE;
+    pNew->pSample = nullptr;
+    pNew->priority = 128;
+    pNew->maxInstances = 0;
+    pNew->retriggerInterval = 0;
+    pNew->lastStart = 0;
+    pNew->lastFrame = this->soundFrame - 1;
+    pNew->decodeRequest = 0;
+    pNew->pinned = LE_FALSE;
+    pNew->lastUse = 0;
+    pNew->pending.active = LE_FALSE;
+    pNew->bus = LE_SOUND_BUS_SFX;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundCreate(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_EXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundDelete(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    pSound->pLeft->pRight = pSound->pRight;
+    pSound->pRight->pLeft = pSound->pLeft;
+
+    if(pSound->pSample != nullptr)
+    {
+      if(pSound->pCompressed != nullptr)
+        {this->soundBank.used -= (size_t) pSound->pSample->alen;}
+
+      this->soundPushCommand(LE_SOUND_CMD_FREE, pSound->pSample, -1, 0, 0);
+    }
+
+    // Mix_FreeChunk() haelt alle Kanaele des Sounds an
+
+    for(size_t i = 0 ; i < this->soundVoices.size() ; i++)
+    {
+      if(this->soundVoices[i].pSound == pSound)
+        {this->soundVoices[i].pSound = nullptr;}
+    }
+
+    if(this->memory.pLastSound == pSound)
+      {this->memory.pLastSound = nullptr;}
+
+    delete pSound;
+
+    if(this->pSoundHead->pLeft == this->pSoundHead && this->pSoundHead->pRight == this->pSoundHead)
+    {
+      delete this->pSoundHead;
+      this->pSoundHead = nullptr;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundDelete(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundLoadWAV(uint32_t id, const char * pFile)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    if(pSound->pSample == nullptr && pSound->pCompressed == nullptr && pSound->decodeRequest == 0)
+    {
+      pSound->pSample = Mix_LoadWAV(pFile);
+
+      if(pSound->pSample == nullptr)
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::soundLoadWAV(%u, %s)\n\n", id, pFile);
+          this->printErrorDialog(LE_LOAD_WAV, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_LOAD_WAV; 
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundLoadWAV(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::soundSetVolume(uint8_t volume)
+{
+  this->soundPushCommand(LE_SOUND_CMD_VOLUME, nullptr, -1, 0, volume);
+}
+
+int LEMoon::soundPlay(uint32_t id, int loops)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    if(!(pSound->lock))
+    {
+      if(this->soundStartVoice(pSound, loops, 0, nullptr))
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::soundPlay(%u, %d)\n\n", id, loops);
+          this->printErrorDialog(LE_PLAY_CHANNEL, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_PLAY_CHANNEL;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundPlay(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundLock(uint32_t id, bool lock)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+    {pSound->lock = lock;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundLock(%d)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundFadeIn(uint32_t id, int ms)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    if(this->soundStartVoice(pSound, -1, ms, nullptr))
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::soundFadeIn(%u, %d)\n\n", id, ms);
+        this->printErrorDialog(LE_PLAY_CHANNEL, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_PLAY_CHANNEL;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundFadeIn(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::soundFadeOut(int ms)
+{
+  uint32_t end = SDL_GetTicks() + (uint32_t) ((ms > 0) ? ms : 0);
+
+  this->soundPushCommand(LE_SOUND_CMD_FADE_OUT, nullptr, -1, 0, ms);
+
+  for(size_t i = 0 ; i < this->soundVoices.size() ; i++)
+  {
+    if(this->soundVoices[i].end > end)
+      {this->soundVoices[i].end = end;}
+  }
+}
+
+void LEMoon::soundPause()
+{
+  this->soundPushCommand(LE_SOUND_CMD_HALT, nullptr, -1, 0, 0);
+
+  for(size_t i = 0 ; i < this->soundVoices.size() ; i++)
+    {this->soundVoices[i].pSound = nullptr;}
+}
+
+int LEMoon::soundSetMaxInstances(uint32_t id, uint8_t maxInstances)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+    {pSound->maxInstances = maxInstances;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetMaxInstances(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundSetPriority(uint32_t id, uint8_t priority)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+    {pSound->priority = priority;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetPriority(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundSetRetriggerInterval(uint32_t id, uint32_t ms)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+    {pSound->retriggerInterval = ms;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetRetriggerInterval(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundPlayAt(uint32_t idSound, uint32_t idModel, int loops)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(idSound);
+  LEModel * pModel = this->modelGet(idModel);
+  glm::vec2 position;
+  SDL_Point size;
+  float x = 0.0f;
+  float y = 0.0f;
+  float distance = 0.0f;
+  int channel = -1;
+
+  if(pSound != nullptr && pModel != nullptr)
+  {
+    if(!(pSound->lock))
+    {
+      position = pModel->pModel->mdlGetPositionD();
+      size = pModel->pModel->mdlGetSize();
+      x = position.x + size.x * 0.5f - this->soundListener.position.x;
+      y = position.y + size.y * 0.5f - this->soundListener.position.y;
+
+      // ein einmaliger Sound ausserhalb des Hoerradius belegt gar keinen Kanal
+
+      if(loops < 0 || x * x + y * y <= this->soundListener.radius * this->soundListener.radius)
+      {
+        if(this->soundStartVoice(pSound, loops, 0, &channel))
+        {
+          #ifdef LE_DEBUG
+            char * pErrorString = new char[256 + 1];
+            sprintf(pErrorString, "LEMoon::soundPlayAt(%u, %u, %d)\n\n", idSound, idModel, loops);
+            this->printErrorDialog(LE_PLAY_CHANNEL, pErrorString);
+            delete [] pErrorString;
+          #endif
+
+          result = LE_PLAY_CHANNEL;
+        }
+        else if(channel >= 0)
+        {
+          // nur die neue Stimme sofort positionieren, sonst waere der Sound bis endFrame() in der Mitte zu hoeren
+
+          distance = sqrtf(x * x + y * y) * 255.0f / ((this->soundListener.radius > 0.0f) ? this->soundListener.radius : 1.0f);
+          this->soundVoices[channel].positional = LE_TRUE;
+          this->soundVoices[channel].idModel = idModel;
+          this->soundPositionVoice(channel, x, y, distance);
+        }
+        else if(pSound->pending.active)
+        {
+          pSound->pending.positional = LE_TRUE;
+          pSound->pending.idModel = idModel;
+        }
+      }
+    }
+  }
+  else if(pSound == nullptr)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundPlayAt(%u)\n\n", idSound);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundPlayAt(%u)\n\n", idModel);
+      this->printErrorDialog(LE_MDL_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_MDL_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::soundSetListener(double x, double y)
+{
+  this->soundListener.position.x = (float) x;
+  this->soundListener.position.y = (float) y;
+}
+
+void LEMoon::soundSetAudibleRadius(double radius)
+{
+  this->soundListener.radius = (float) radius;
+}
+
+int LEMoon::soundLoadCompressed(uint32_t id, const char * pFile)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+  SDL_RWops * pSource = nullptr;
+  Sint64 size = 0;
+
+  if(pSound != nullptr)
+  {
+    if(pSound->pSample == nullptr && pSound->pCompressed == nullptr)
+    {
+      // nur die komprimierten Bytes werden gelesen, dekodiert wird beim ersten Abspielen
+
+      pSource = SDL_RWFromFile(pFile, "rb");
+
+      if(pSource != nullptr && (size = SDL_RWsize(pSource)) > 0)
+      {
+        pSound->pCompressed = make_shared<vector<uint8_t>>((size_t) size);
+
+        if(SDL_RWread(pSource, pSound->pCompressed->data(), 1, (size_t) size) != (size_t) size)
+          {pSound->pCompressed = nullptr;}
+      }
+
+      if(pSource != nullptr)
+        {SDL_RWclose(pSource);}
+
+      if(pSound->pCompressed == nullptr)
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::soundLoadCompressed(%u, %s)\n\n", id, pFile);
+          this->printErrorDialog(LE_LOAD_SOUND_BANK, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_LOAD_SOUND_BANK;
+      }
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundLoadCompressed(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundPin(uint32_t id, bool pin)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    pSound->pinned = pin;
+
+    if(pin)
+    {
+      if(pSound->pSample == nullptr && pSound->pCompressed != nullptr)
+        {this->soundDecode(pSound, nullptr);}
+    }
+    else
+      {this->soundEvict();}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundPin(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::soundSetBankBudget(size_t bytes)
+{
+  this->soundBank.budget = bytes;
+  this->soundEvict();
+}
+
+int LEMoon::soundSetBus(uint32_t id, uint8_t bus)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound == nullptr)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetBus(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+  else if(bus >= LE_SOUND_BUSES)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetBus(%u, %u)\n\n", id, bus);
+      this->printErrorDialog(LE_SOUND_BUS_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_BUS_NOEXIST;
+  }
+  else
+    {pSound->bus = bus;}
+
+  return result;
+}
+
+int LEMoon::soundSetBusGain(uint8_t bus, double gain)
+{
+  int result = LE_NO_ERROR;
+
+  if(bus < LE_SOUND_BUSES)
+    {this->soundMixer.buses[bus].gain = (float) ((gain > 0.0) ? gain : 0.0);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetBusGain(%u)\n\n", bus);
+      this->printErrorDialog(LE_SOUND_BUS_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_BUS_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundSetBusLowPass(uint8_t bus, double cutoff)
+{
+  int result = LE_NO_ERROR;
+
+  if(bus < LE_SOUND_BUSES)
+    {this->soundMixer.buses[bus].cutoff = (float) ((cutoff > 0.0) ? cutoff : 0.0);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetBusLowPass(%u)\n\n", bus);
+      this->printErrorDialog(LE_SOUND_BUS_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_BUS_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundSetBusDucking(uint8_t bus, int byBus, double gain)
+{
+  int result = LE_NO_ERROR;
+
+  if(bus < LE_SOUND_BUSES && byBus < LE_SOUND_BUSES && byBus != (int) bus)
+  {
+    this->soundMixer.buses[bus].duckGain = (float) ((gain > 0.0) ? gain : 0.0);
+    this->soundMixer.buses[bus].duckBy = (byBus >= 0) ? byBus : -1;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundSetBusDucking(%u, %d)\n\n", bus, byBus);
+      this->printErrorDialog(LE_SOUND_BUS_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_BUS_NOEXIST;
+  }
+
+  return result;
+}
+
+void LEMoon::soundSetLimiter(double threshold)
+{
+  this->soundMixer.limit = (float) ((threshold < 1.0) ? ((threshold > 0.0) ? threshold : 0.0) : 1.0);
+}
+
+int LEMoon::soundLoadAsync(uint32_t id, const char * pFile)
+{
+  int result = LE_NO_ERROR;
+  LESound * pSound = this->soundGet(id);
+
+  if(pSound != nullptr)
+  {
+    // wie soundLoadWAV(): ein bereits geladener oder ladender Sound bleibt unveraendert
+
+    if(pSound->pSample == nullptr && pSound->pCompressed == nullptr)
+      {this->soundDecode(pSound, pFile);}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::soundLoadAsync(%u)\n\n", id);
+      this->printErrorDialog(LE_SOUND_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SOUND_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::soundLoadBatchAsync(uint32_t amount, const uint32_t * pIds, const char ** pFiles)
+{
+  int result = LE_NO_ERROR;
+  int error = LE_NO_ERROR;
+
+  // jede Datei ist ein eigener Auftrag, die Arbeitsthreads laden sie parallel
+
+  for(uint32_t i = 0 ; i < amount ; i++)
+  {
+    error = this->soundLoadAsync(pIds[i], pFiles[i]);
+
+    if(!result)
+      {result = error;}
+  }
+
+  return result;
+}
+
+uint32_t LEMoon::soundGetPendingLoads()
+{
+  return this->soundBank.pending;
+}
+
+bool LEMoon::soundIsLoaded(uint32_t id)
+{
+  LESound * pSound = this->soundGet(id);
+
+  return (pSound != nullptr && pSound->pSample != nullptr);
+}
@@ -1,977 +1,2481 @@
-/*
-  Author:             Patrick-Christopher Mattulat
-  e-mail:             pmattulat@outlook.de
-  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
-  date:               12.04.2018
-  updated:            21.04.2018
-
-  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
-*/
-
-#include "../include/le_moon.h"
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// private text
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::textDraw(LEText * pText)
-{
-  int result = LE_NO_ERROR;
-
-  if(pText->visible && pText->alpha > 0.0f && pText->pTexture != nullptr)
-  {
-    if(SDL_RenderCopyEx(this->pRenderer, pText->pTexture, nullptr, &(pText->posSize), 0.0f, nullptr, SDL_FLIP_NONE))
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textDraw(%d)\n\n", pText->id);
-        this->printErrorDialog(LE_SDL_RENDER_COPY_EX, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_SDL_RENDER_COPY_EX;
-    }
-  }
-
-  return result;
-}
-
-LEText * LEMoon::textGet(uint32_t id)
-{
-  LEText * pRet = nullptr;
-  LEText * pCurrent = nullptr;
-
-  if(this->pTextHead != nullptr)
-  {
-    if(this->memory.pLastText != nullptr && this->memory.pLastText->id == id)
-      {pRet = this->memory.pLastText;}
-    else
-    {
-      pCurrent = this->pTextHead->pRight;
-
-      while(pCurrent != this->pTextHead)
-      {
-        if(pCurrent->id == id)
-        {
-          pRet = pCurrent;
-          this->memory.pLastText = pCurrent;
-          break;
-        }
-
-        pCurrent = pCurrent->pRight;
-      }
-    }
-  }
-
-  return pRet;
-}
-
-uint32_t LEMoon::textGetAmount()
-{
-  uint32_t amount = 0;
-  LEText * pCurrent = nullptr;
-
-  if(this->pTextHead != nullptr)
-  {
-    pCurrent = this->pTextHead->pRight;
-
-    while(pCurrent != this->pTextHead)
-    {
-      amount++;
-      pCurrent = pCurrent->pRight;
-    }
-  }
-
-  return amount;
-}
-
-LinkedVec2 * LEMoon::textGetDirection(LEText * pText, uint32_t idDirection)
-{
-  LinkedVec2 * pRet = nullptr;
-  LinkedVec2 * pCurrent = nullptr;
-
-  if(pText->pDirectionHead != nullptr)
-  {
-    pCurrent = pText->pDirectionHead->pRight;
-
-    while(pCurrent != pText->pDirectionHead)
-    {
-      if(pCurrent->id == idDirection)
-      {
-        pRet = pCurrent;
-        break;
-      }
-
-      pCurrent = pCurrent->pRight;
-    }
-  }
-
-  return pRet;
-}
-
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-// public text
-//////////////////////////////////////////////////////////
-//////////////////////////////////////////////////////////
-
-int LEMoon::textCreate(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEText * pNew = this->textGet(id);
-
-  if(pNew == nullptr)
-  {
-    if(this->pTextHead == nullptr)
-    {
-      this->pTextHead = new LEText;
-      this->pTextHead->pLeft = this->pTextHead;
-      this->pTextHead->pRight = this->pTextHead;
-      this->pTextHead->zindex = 0;
-      this->pTextHead->id = 1989;
-    }
-
-    pNew = new LEText;
-    pNew->pRight = this->pTextHead;
-    pNew->pLeft = this->pTextHead->pLeft;
-    this->pTextHead->pLeft->pRight = pNew;
-    this->pTextHead->pLeft = pNew;
-    pNew->id = id;
-    pNew->pCurrentCursorPosition = nullptr;
-    pNew->pText = nullptr;
-    pNew->length = 0;
-    pNew->color = {255, 255, 255, 255};
-    pNew->zindex = 1;
-    pNew->visible = LE_TRUE;
-    pNew->pFont = nullptr;
-    pNew->pTexture = nullptr;
-    pNew->alpha = 255;
-    pNew->pLetterHead = nullptr;
-    pNew->pDirectionHead = nullptr;
-    pNew->position = glm::vec2(0.0f, 0.0f);
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textCreate(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_EXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_EXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textDelete(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LinkedVec2 * pCurrentDirection = nullptr;
-  LinkedVec2 * pNextDirection = nullptr;
-  LELetter * pCurrentLetter = nullptr;
-  LELetter * pNextLetter = nullptr;
-
-  if(pText != nullptr)
-  {
-    pText->pLeft->pRight = pText->pRight;
-    pText->pRight->pLeft = pText->pLeft;
-
-    // loesche Bewegungsrichtungen
-
-    if(pText->pDirectionHead != nullptr)
-    {
-      pCurrentDirection = pText->pDirectionHead->pRight;
-
-      while(pCurrentDirection != pText->pDirectionHead)
-      {
-        pNextDirection = pCurrentDirection->pRight;
-        delete pCurrentDirection;
-        pCurrentDirection = pNextDirection;
-      }
-
-      delete pText->pDirectionHead;
-      pText->pDirectionHead = nullptr;
-    }
-
-    // loesche Buchstaben
-
-    if(pText->pLetterHead != nullptr)
-    {
-      pCurrentLetter = pText->pLetterHead->pRight;
-
-      while(pCurrentLetter != pText->pLetterHead)
-      {
-        pNextLetter = pCurrentLetter->pRight;
-        delete pCurrentLetter;
-        pCurrentLetter = pNextLetter;
-      }
-
-      delete pText->pLetterHead;
-      pText->pLetterHead = nullptr;
-    }
-
-    // loesche Text
-
-    if(pText->pText != nullptr)
-    {
-      delete [] pText->pText;
-      pText->pText = nullptr;
-    }
-
-    // loesche Textur
-
-    if(pText->pTexture != nullptr)
-    {
-      SDL_DestroyTexture(pText->pTexture);
-      pText->pTexture = nullptr;
-    }
-
-    delete pText;
-
-    if(this->pTextHead->pLeft == this->pTextHead && this->pTextHead->pRight == this->pTextHead)
-    {
-      delete this->pTextHead;
-      this->pTextHead = nullptr;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textDelete(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textAddLetter(uint32_t id, uint8_t letter)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LELetter * pLetter = nullptr;
-
-  if(pText != nullptr)
-  {
-    if(pText->pLetterHead == nullptr)
-    {
-      pText->pLetterHead = new LELetter;
-      pText->pLetterHead->pLeft = pText->pLetterHead;
-      pText->pLetterHead->pRight = pText->pLetterHead;
-    }
-
-    pLetter = new LELetter;
-    pLetter->pRight = pText->pLetterHead;
-    pLetter->pLeft = pText->pLetterHead->pLeft;
-    pText->pLetterHead->pLeft->pRight = pLetter;
-    pText->pLetterHead->pLeft = pLetter;
-    pLetter->letter = letter;
-    pText->length += 1;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textAddLetter(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;	
-  }
-
-  return result;
-}
-
-int LEMoon::textSubmit(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  uint32_t index = 0;
-  LELetter * pLetter = nullptr;
-
-  if(pText != nullptr)
-  {
-    // erstelle einen Textbuffer
-
-    if(pText->pText != nullptr)
-    {
-      delete [] pText->pText;
-      pText->pText = nullptr;
-    }
-
-    pText->pText = new unsigned char[pText->length + 1];
-    pLetter = pText->pLetterHead->pRight;
-
-    // fuelle das Textfeld
-
-    while(pLetter != pText->pLetterHead)
-    {
-      pText->pText[index] = (unsigned char) pLetter->letter;
-      index++;
-      pLetter = pLetter->pRight;
-    }
-
-    // null terminieren!
-
-    pText->pText[index] = '\0';
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSubmit(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;	
-  }
-
-  return result;
-}
-
-int LEMoon::textSetColor(uint32_t id, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-    {pText->color = {r, g, b, a};}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSetColor(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;	
-  }
-
-  return result;
-}
-
-int LEMoon::textSetVisible(uint32_t id, bool visible)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-    {pText->visible = visible;}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSetVisible(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;	
-  }
-
-  return result;
-}
-
-int LEMoon::textSetZindex(uint32_t id, uint32_t zindex)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LEText * pCurrent = nullptr;
-  bool moreThanOneElement = this->pTextHead->pLeft->id != this->pTextHead->pRight->id;
-
-  if(zindex == 0)
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSetZindex(%u, %u)\n\n", id, zindex);
-      this->printErrorDialog(LE_INVALID_ZINDEX, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_INVALID_ZINDEX;
-  }
-
-  if(moreThanOneElement)
-  {
-    if(!result && pText != nullptr)
-    {
-      // auskoppeln
-    
-      pText->pLeft->pRight = pText->pRight;
-      pText->pRight->pLeft = pText->pLeft;
-      pText->zindex = zindex;
-    
-      // neu einordnen
-    
-      pCurrent = this->pTextHead->pRight;
-    
-      while(pCurrent != this->pTextHead)
-      {
-        if(pText->zindex >= pCurrent->zindex)
-        {
-          // dahinter einfuegen
-    
-          pText->pLeft = pCurrent;
-          pText->pRight = pCurrent->pRight;
-          pCurrent->pRight->pLeft = pText;
-          pCurrent->pRight = pText;
-          break;
-        }
-    
-        pCurrent = pCurrent->pRight;
-      }
-    }
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textSetZindex(%u)\n\n", id);
-        this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-        delete [] pErrorString;
-      #endif
-    
-      result = LE_TEXT_NOEXIST;	
-    }
-  }
-
-  return result;
-}
-
-int LEMoon::textRelateFont(uint32_t id, uint32_t idFont)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LEFont * pFont = this->fontGet(idFont);
-
-  if(pFont == nullptr)
-    {pFont = this->fontGetFromBuffer(idFont);}
-
-  if(pText != nullptr)
-  {
-    if(pFont != nullptr)
-      {pText->pFont = pFont;}
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textRelateFont(%u, %u)\n\n", id, idFont);
-        this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_FONT_NOEXIST;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textRelateFont(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textPrepareForDrawing(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  SDL_Surface * pSurface = nullptr;
-  SDL_Color color;
-
-  if(pText != nullptr)
-  {
-    if(pText->pText != nullptr)
-    {
-      if(pText->pFont != nullptr)
-      {
-        color = {pText->color.r, pText->color.g, pText->color.b, pText->color.a};
-        pSurface = TTF_RenderUTF8_Blended(pText->pFont->pFont, (const char*) pText->pText, color);
-
-        if(pSurface != nullptr)
-        {
-          if(pText->pTexture != nullptr)
-            {SDL_DestroyTexture(pText->pTexture);}
-
-          if(SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl"))
-          {
-            pText->posSize.w = pSurface->w;
-            pText->posSize.h = pSurface->h;
-            pText->pTexture = SDL_CreateTextureFromSurface(this->pRenderer, pSurface);
-            SDL_FreeSurface(pSurface);
-
-            if(pText->pTexture != nullptr)
-            {
-              if(SDL_SetTextureBlendMode(pText->pTexture, SDL_BLENDMODE_BLEND))
-              {
-                #ifdef LE_DEBUG
-                  char * pErrorString = new char[256 + 1];
-                  sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-                  this->printErrorDialog(LE_SDL_BLENDMODE, pErrorString);
-                  delete [] pErrorString;
-                #endif
-
-                result = LE_SDL_BLENDMODE;
-              }
-            }
-            else
-            {
-              #ifdef LE_DEBUG
-                char * pErrorString = new char[256 + 1];
-                sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-                this->printErrorDialog(LE_SDL_TEXTURE_LOAD, pErrorString);
-                delete [] pErrorString;
-              #endif
-
-              result = LE_SDL_TEXTURE_LOAD;
-            }
-          }
-          else
-          {
-            #ifdef LE_DEBUG
-              char * pErrorString = new char[256 + 1];
-              sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-              this->printErrorDialog(LE_SDL_HINT, pErrorString);
-              delete [] pErrorString;
-            #endif
-
-            result = LE_SDL_HINT;
-          }
-        }
-        else
-        {
-          #ifdef LE_DEBUG
-            char * pErrorString = new char[256 + 1];
-            sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-            this->printErrorDialog(LE_RENDER_TEXT_BLENDED, pErrorString);
-            delete [] pErrorString;
-          #endif
-
-          result = LE_RENDER_TEXT_BLENDED;
-        }
-      }
-      else
-      {
-        #ifdef LE_DEBUG
-          char * pErrorString = new char[256 + 1];
-          sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-          this->printErrorDialog(LE_TEXT_RELATE_FONT, pErrorString);
-          delete [] pErrorString;
-        #endif
-
-        result = LE_TEXT_RELATE_FONT;
-      }
-    }
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-        this->printErrorDialog(LE_TEXT_NOSUBMIT, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_TEXT_NOSUBMIT;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textSetPosition(uint32_t id, int x, int y)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-  {
-    pText->posSize.x = x;
-    pText->posSize.y = y;
-    pText->position.x = (float) x;
-    pText->position.y = (float) y;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSetPosition(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textAddString(uint32_t id, const char * pString)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  uint32_t index = 0;
-  LELetter * pLetter = nullptr;
-
-  if(pText != nullptr)
-  {
-    while(pString[index] != '\0')
-    {
-      if(pText->pLetterHead == nullptr)
-      {
-        pText->pLetterHead = new LELetter;
-        pText->pLetterHead->pLeft = pText->pLetterHead;
-        pText->pLetterHead->pRight = pText->pLetterHead;
-      }
-
-      pLetter = new LELetter;
-      pLetter->pRight = pText->pLetterHead;
-      pLetter->pLeft = pText->pLetterHead->pLeft;
-      pText->pLetterHead->pLeft->pRight = pLetter;
-      pText->pLetterHead->pLeft = pLetter;
-      pLetter->letter = pString[index];
-      pText->length += 1;
-      index++;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textAddString(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textSetAlpha(uint32_t id, uint8_t alpha)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-  {
-    pText->alpha = (double) alpha;
-
-    if(SDL_SetTextureAlphaMod(pText->pTexture, (uint8_t) pText->alpha))
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textSetAlpha(%u, %u)\n\n", id, alpha);
-        this->printErrorDialog(LE_ALPHA_MOD, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_ALPHA_MOD;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textSetAlpha(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textFade(uint32_t id, double alphaPerSecond)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-  {
-    pText->alpha += (alphaPerSecond * this->timestep);
-
-    if(pText->alpha <= 0.0f)
-      {pText->alpha = 0.0f;}
-
-    if(pText->alpha >= 255.0f)
-      {pText->alpha = 255.0f;}
-
-    if(SDL_SetTextureAlphaMod(pText->pTexture, (uint8_t) pText->alpha))
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textFade(%u, %1.2f)\n\n", id, alphaPerSecond);
-        this->printErrorDialog(LE_ALPHA_MOD, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_ALPHA_MOD;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textFade(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textClear(uint32_t id)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LELetter * pLetter = nullptr;
-  LELetter * pNextLetter = nullptr;
-
-  if(pText != nullptr)
-  {
-    // loesche Text
-
-    if(pText->pText != nullptr)
-    {
-      delete [] pText->pText;
-      pText->pText = nullptr;
-    }
-
-    // loesche Buchstaben
-
-    pLetter = pText->pLetterHead->pRight;
-
-    while(pLetter != pText->pLetterHead)
-    {
-      pNextLetter = pLetter->pRight;
-      delete pLetter;
-      pLetter = pNextLetter;
-    }
-
-    pText->pLetterHead->pLeft = pText->pLetterHead;
-    pText->pLetterHead->pRight = pText->pLetterHead;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textClear(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-double LEMoon::textGetAlpha(uint32_t id)
-{
-  LEText * pText = this->textGet(id);
-  double alpha = 0.0f;
-
-  if(pText != nullptr)
-    {alpha = pText->alpha;}
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textGetAlpha(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return alpha;
-}
-
-int LEMoon::textAddDirection(uint32_t id, uint32_t idDirection, glm::vec2 direction)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LinkedVec2 * pNew = nullptr;
-
-  if(pText != nullptr)
-  {
-    pNew = this->textGetDirection(pText, idDirection);
-
-    if(pNew == nullptr)
-    {
-      if(pText->pDirectionHead == nullptr)
-      {
-        pText->pDirectionHead = new LinkedVec2;
-        pText->pDirectionHead->pLeft = pText->pDirectionHead;
-        pText->pDirectionHead->pRight = pText->pDirectionHead;
-      }
-
-      pNew = new LinkedVec2;
-      pNew->pRight = pText->pDirectionHead;
-      pNew->pLeft = pText->pDirectionHead->pLeft;
-      pText->pDirectionHead->pLeft->pRight = pNew;
-      pText->pDirectionHead->pLeft = pNew;
-      pNew->id = idDirection;
-      pNew->currentDegree = 0.0f;
-      pNew->data = direction;
-    }
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textAddDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, direction.x, direction.y);
-        this->printErrorDialog(LE_DIRECTION_EXIST, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_DIRECTION_EXIST;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textAddDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-int LEMoon::textMoveDirection(uint32_t id, uint32_t idDirection)
-{
-  int result = LE_NO_ERROR;
-  LEText * pText = this->textGet(id);
-  LinkedVec2 * pDirection = nullptr;
-
-  if(pText != nullptr)
-  {
-    pDirection = this->textGetDirection(pText, idDirection);
-
-    if(pDirection != nullptr)
-    {
-      pText->position.x += (float)(pDirection->data.x * this->timestep);
-      pText->position.y += (float)(pDirection->data.y * this->timestep);
-      pText->posSize.x = (int) pText->position.x;
-      pText->posSize.y = (int) pText->position.y;
-    }
-    else
-    {
-      #ifdef LE_DEBUG
-        char * pErrorString = new char[256 + 1];
-        sprintf(pErrorString, "LEMoon::textMoveDirection(%u, %u)\n\n", id, idDirection);
-        this->printErrorDialog(LE_DIRECTION_NOEXIST, pErrorString);
-        delete [] pErrorString;
-      #endif
-
-      result = LE_DIRECTION_NOEXIST;
-    }
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textMoveDirection(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-
-    result = LE_TEXT_NOEXIST;
-  }
-
-  return result;
-}
-
-SDL_Point LEMoon::textGetPosition(uint32_t id)
-{
-  SDL_Point pos;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-  {
-    pos.x = pText->posSize.x;
-    pos.y = pText->posSize.y;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textGetPosition(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return pos;
-}
-
-SDL_Point LEMoon::textGetSize(uint32_t id)
-{
-  SDL_Point size;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-  {
-    size.x = pText->posSize.w;
-    size.y = pText->posSize.h;
-  }
-  else
-  {
-    #ifdef LE_DEBUG
-      char * pErrorString = new char[256 + 1];
-      sprintf(pErrorString, "LEMoon::textGetSize(%u)\n\n", id);
-      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
-      delete [] pErrorString;
-    #endif
-  }
-
-  return size;
-}
-
-bool LEMoon::textGetVisible(uint32_t id)
-{
-  bool visible = LE_FALSE;
-  LEText * pText = this->textGet(id);
-
-  if(pText != nullptr)
-    {visible = pText->visible;}
-
-  return visible;
-}
\ No newline at end of file
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Visual Studio 2015 Community, g++ Compiler
+  date:               12.04.2018
+  updated:            19.10.2026
+
+  NOTES:              bufferHead muss beim mergen auch komplett zerlegt und auf nullptr gesetzt werden, pLast muss auch auf nullptr gesetzt werden
+*/
+
+#include "../include/le_moon.h"
+#include <string.h>
+
+#define LE_TEXT_POOL_MIN_SIZE           32                        // kleinste Groessenklasse der Texturen, die Klassen wachsen in Zweierpotenzen
+#define LE_TEXT_POOL_PER_SIZE           4                         // freie Texturen je Groessenklasse, weitere werden zerstoert
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private text
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static int textBlockWidth(LEText * pText)
+{
+  // zentrierte und rechtsbuendige Zeilen werden innerhalb der maximalen Breite ausgerichtet
+
+  return (pText->layout.maxWidth > 0 && pText->layout.align != LE_ALIGN_LEFT) ? pText->layout.maxWidth : pText->layout.width;
+}
+
+static int textLineOffset(LEText * pText, LETextLine & line)
+{
+  int offset = 0;
+
+  if(pText->layout.align == LE_ALIGN_CENTER)
+    {offset = (textBlockWidth(pText) - line.width) / 2;}
+  else if(pText->layout.align == LE_ALIGN_RIGHT)
+    {offset = textBlockWidth(pText) - line.width;}
+
+  return (offset > 0) ? offset : 0;
+}
+
+static int textLinePitch(LEText * pText)
+{
+  return pText->pFont->lineSkip + pText->layout.lineSpacing;
+}
+
+static int textBlockHeight(LEText * pText)
+{
+  return pText->pFont->height + ((int) pText->layout.lines.size() - 1) * textLinePitch(pText);
+}
+
+static void textMarkEdit(LEText * pText, uint32_t position, uint32_t removed, uint32_t inserted)
+{
+  // mehrere Bearbeitungen bis zum naechsten Umbruch werden zu einem Bereich zusammengefasst, steht ohnehin ein kompletter Umbruch an, bleibt es dabei
+
+  if(!pText->layout.dirty)
+  {
+    pText->layout.edited = LE_TRUE;
+    pText->layout.editStart = position;
+    pText->layout.editEnd = position + inserted;
+    pText->layout.editDelta = (int) inserted - (int) removed;
+  }
+  else if(pText->layout.edited)
+  {
+    pText->layout.editEnd = (pText->layout.editEnd >= position + removed) ? pText->layout.editEnd - removed + inserted : position + inserted;
+    pText->layout.editDelta += (int) inserted - (int) removed;
+
+    if(position < pText->layout.editStart)
+      {pText->layout.editStart = position;}
+  }
+
+  pText->dirty = LE_TRUE;
+  pText->layout.dirty = LE_TRUE;
+}
+
+static uint32_t textPreviousLetter(LEText * pText, uint32_t index)
+{
+  // Folgebytes einer UTF-8 Sequenz ueberspringen
+
+  if(index > 0)
+    {index--;}
+
+  while(index > 0 && (pText->pText[index] & 0xC0) == 0x80)
+    {index--;}
+
+  return index;
+}
+
+static uint32_t textSnapLetter(LEText * pText, uint32_t index)
+{
+  if(index >= pText->length)
+    {index = pText->length;}
+  else
+  {
+    while(index > 0 && (pText->pText[index] & 0xC0) == 0x80)
+      {index--;}
+  }
+
+  return index;
+}
+
+static int textClearTextureEdge(SDL_Texture * pTexture, int width, int height)
+{
+  int result = 0;
+  int textureWidth = 0;
+  int textureHeight = 0;
+  vector<uint32_t> pixels;
+  SDL_Rect rect;
+
+  // gefilterte Texturen lesen ein Pixel ueber den Text hinaus, dort darf kein Rest eines frueheren Textes aus dem Pool stehen
+
+  SDL_QueryTexture(pTexture, nullptr, nullptr, &textureWidth, &textureHeight);
+  pixels.assign((size_t) ((textureWidth > textureHeight) ? textureWidth : textureHeight), 0);
+
+  if(width < textureWidth)
+  {
+    rect = {width, 0, 1, (height < textureHeight) ? height + 1 : textureHeight};
+    result = SDL_UpdateTexture(pTexture, &rect, pixels.data(), (int) sizeof(uint32_t));
+  }
+
+  if(!result && height < textureHeight)
+  {
+    rect = {0, height, (width < textureWidth) ? width + 1 : textureWidth, 1};
+    result = SDL_UpdateTexture(pTexture, &rect, pixels.data(), rect.w * (int) sizeof(uint32_t));
+  }
+
+  return result;
+}
+
+static int textTextureSize(int size, int maxSize)
+{
+  int textureSize = LE_TEXT_POOL_MIN_SIZE;
+
+  while(textureSize < size)
+    {textureSize *= 2;}
+
+  // nicht jeder Renderer kann jede Zweierpotenz, die Groessenklasse endet an seiner Grenze
+
+  if(maxSize > 0 && textureSize > maxSize)
+    {textureSize = maxSize;}
+
+  return textureSize;
+}
+
+static bool textUsesAtlas(LEText * pText)
+{
+  // Umriss und Schatten werden eingebacken, Bitmapschriften kennen keine Effekte
+
+  return pText->pFont->bitmap.enabled || (pText->pFont->atlas.enabled && pText->effect.outline == 0 && pText->effect.shadowOffset.x == 0 && pText->effect.shadowOffset.y == 0);
+}
+
+static SDL_Surface * textRenderLayer(LETextJob * pJob, LEFontHandle * pHandle, SDL_Color color, int border)
+{
+  SDL_Surface * pSurface = nullptr;
+  SDL_Surface * pLineSurface = nullptr;
+  SDL_Rect dstRect;
+  char saved = 0;
+  uint32_t end = 0;
+
+  // verschiedene Fonts werden parallel gerastert, derselbe Font nur nacheinander
+
+  pHandle->mtxRender.lock();
+
+  if(pJob->singleLine)
+    {pSurface = TTF_RenderUTF8_Blended(pHandle->pFont, pJob->text.c_str(), color);}
+  else
+  {
+    // ein Umriss ragt an jeder Seite um seine Breite ueber die Zeilen hinaus
+
+    pSurface = SDL_CreateRGBSurfaceWithFormat(0, pJob->width + 2 * border, pJob->height + 2 * border, 32, SDL_PIXELFORMAT_ARGB8888);
+
+    for(size_t i = 0 ; i < pJob->lines.size() && pSurface != nullptr ; i++)
+    {
+      if(pJob->lines[i].length > 0)
+      {
+        // die Zeile wird kurz in der Kopie selbst terminiert, damit nichts weiter kopiert werden muss
+
+        end = pJob->lines[i].start + pJob->lines[i].length;
+        saved = pJob->text[end];
+        pJob->text[end] = '\0';
+        pLineSurface = TTF_RenderUTF8_Blended(pHandle->pFont, pJob->text.c_str() + pJob->lines[i].start, color);
+        pJob->text[end] = saved;
+
+        if(pLineSurface != nullptr)
+        {
+          dstRect = {pJob->linePositions[i].x, pJob->linePositions[i].y, pLineSurface->w, pLineSurface->h};
+          SDL_SetSurfaceBlendMode(pLineSurface, SDL_BLENDMODE_NONE);
+          SDL_BlitSurface(pLineSurface, nullptr, pSurface, &dstRect);
+          SDL_FreeSurface(pLineSurface);
+        }
+        else
+        {
+          SDL_FreeSurface(pSurface);
+          pSurface = nullptr;
+        }
+      }
+    }
+  }
+
+  pHandle->mtxRender.unlock();
+  return pSurface;
+}
+
+static void textComposeLayer(SDL_Surface * pTarget, SDL_Surface * pLayer, int x, int y, const SDL_Color * pTint)
+{
+  uint32_t * pSrc = nullptr;
+  uint32_t * pDst = nullptr;
+  uint32_t srcA = 0;
+  uint32_t dstA = 0;
+  uint32_t outA = 0;
+  uint32_t rest = 0;
+  uint32_t src = 0;
+  uint32_t dst = 0;
+  uint32_t out = 0;
+
+  // "ueber" fuer nicht vormultipliziertes ARGB8888, mit pTint wird die Ebene zur einfarbigen Silhouette, z.B. fuer den Schatten
+
+  for(int row = 0 ; row < pLayer->h ; row++)
+  {
+    if(y + row < 0 || y + row >= pTarget->h)
+      {continue;}
+
+    pSrc = (uint32_t*) ((uint8_t*) pLayer->pixels + row * pLayer->pitch);
+    pDst = (uint32_t*) ((uint8_t*) pTarget->pixels + (y + row) * pTarget->pitch);
+
+    for(int column = 0 ; column < pLayer->w ; column++)
+    {
+      if(x + column < 0 || x + column >= pTarget->w)
+        {continue;}
+
+      src = pSrc[column];
+      srcA = src >> 24;
+
+      if(pTint != nullptr)
+      {
+        srcA = srcA * pTint->a / 255;
+        src = ((uint32_t) pTint->r << 16) | ((uint32_t) pTint->g << 8) | pTint->b;
+      }
+
+      if(srcA == 0)
+        {continue;}
+
+      dst = pDst[x + column];
+      dstA = dst >> 24;
+      rest = dstA * (255 - srcA) / 255;
+      outA = srcA + rest;
+      out = outA << 24;
+
+      for(int shift = 0 ; shift < 24 ; shift += 8)
+        {out |= ((((src >> shift) & 0xFF) * srcA + ((dst >> shift) & 0xFF) * rest) / outA) << shift;}
+
+      pDst[x + column] = out;
+    }
+  }
+}
+
+static void textRenderJob(LETextJob * pJob)
+{
+  SDL_Surface * pFill = nullptr;
+  SDL_Surface * pBody = nullptr;
+  SDL_Surface * pOutline = nullptr;
+  int outline = (pJob->pOutlineHandle != nullptr) ? pJob->effect.outline : 0;
+  SDL_Point shadow = pJob->effect.shadowOffset;
+  int bodyX = (shadow.x < 0) ? -shadow.x : 0;
+  int bodyY = (shadow.y < 0) ? -shadow.y : 0;
+
+  pJob->pSurface = nullptr;
+
+  if(pJob->pHandle != nullptr)
+    {pFill = textRenderLayer(pJob, pJob->pHandle, pJob->color, 0);}
+
+  // ohne Effekte ist die Fuellung schon das Ergebnis
+
+  if(pFill != nullptr && outline == 0 && shadow.x == 0 && shadow.y == 0)
+  {
+    pJob->pSurface = pFill;
+    pJob->fillRect = {0, 0, pFill->w, pFill->h};
+  }
+  else if(pFill != nullptr)
+  {
+    // Umriss und Fuellung ergeben den Koerper, der Schatten ist dessen Silhouette, alles landet in einer Surface
+
+    pBody = pFill;
+
+    if(outline > 0)
+    {
+      pOutline = textRenderLayer(pJob, pJob->pOutlineHandle, pJob->effect.outlineColor, outline);
+      pBody = SDL_CreateRGBSurfaceWithFormat(0, pFill->w + 2 * outline, pFill->h + 2 * outline, 32, SDL_PIXELFORMAT_ARGB8888);
+
+      if(pBody != nullptr && pOutline != nullptr)
+      {
+        textComposeLayer(pBody, pOutline, 0, 0, nullptr);
+        textComposeLayer(pBody, pFill, outline, outline, nullptr);
+      }
+      else if(pBody != nullptr)
+      {
+        SDL_FreeSurface(pBody);
+        pBody = nullptr;
+      }
+
+      if(pOutline != nullptr)
+        {SDL_FreeSurface(pOutline);}
+    }
+
+    if(pBody != nullptr && (shadow.x != 0 || shadow.y != 0))
+    {
+      pJob->pSurface = SDL_CreateRGBSurfaceWithFormat(0, pBody->w + abs(shadow.x), pBody->h + abs(shadow.y), 32, SDL_PIXELFORMAT_ARGB8888);
+
+      if(pJob->pSurface != nullptr)
+      {
+        textComposeLayer(pJob->pSurface, pBody, bodyX + shadow.x, bodyY + shadow.y, &(pJob->effect.shadowColor));
+        textComposeLayer(pJob->pSurface, pBody, bodyX, bodyY, nullptr);
+      }
+    }
+    else
+    {
+      pJob->pSurface = pBody;
+      pBody = nullptr;
+      bodyX = 0;
+      bodyY = 0;
+    }
+
+    pJob->fillRect = {bodyX + outline, bodyY + outline, pFill->w, pFill->h};
+
+    if(pBody != nullptr && pBody != pFill)
+      {SDL_FreeSurface(pBody);}
+
+    if(pJob->pSurface != pFill)
+      {SDL_FreeSurface(pFill);}
+  }
+}
+
+SDL_Texture * LEMoon::textAcquireTexture(int width, int height)
+{
+  SDL_Texture * pTexture = nullptr;
+  int textureWidth = textTextureSize(width, this->textTextureMax.x);
+  int textureHeight = textTextureSize(height, this->textTextureMax.y);
+  unordered_map<uint32_t, vector<SDL_Texture*>>::iterator pool = this->textTexturePool.find(((uint32_t) textureWidth << 16) | (uint32_t) textureHeight);
+
+  // ein Text ueber der Grenze des Renderers bekommt keine Textur, die Groessenklasse waere zu klein
+
+  if(textureWidth >= width && textureHeight >= height)
+  {
+    if(pool != this->textTexturePool.end() && !pool->second.empty())
+    {
+      pTexture = pool->second.back();
+      pool->second.pop_back();
+    }
+    else
+      {pTexture = SDL_CreateTexture(this->pRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, textureWidth, textureHeight);}
+  }
+
+  return pTexture;
+}
+
+int LEMoon::textBuildGlyphRun(LEText * pText)
+{
+  int result = LE_NO_ERROR;
+  uint32_t index = 0;
+  uint32_t end = 0;
+  uint32_t codepoint = 0;
+  uint16_t character = 0;
+  uint16_t previous = 0;
+  int penX = 0;
+  int right = 0;
+  LEGlyph * pGlyph = nullptr;
+  LEGlyphQuad quad;
+  LETextLine * pLine = nullptr;
+  LEFont * pFont = pText->pFont;
+
+  // ein geleerter Atlas, z.B. durch fontSetStyle(), macht die Glyphen aller Zeilen ungueltig
+
+  if(pFont->atlas.invalid)
+    {this->fontDestroyAtlas(pFont);}
+
+  if(pText->atlasGeneration != pFont->atlas.generation)
+  {
+    for(size_t i = 0 ; i < pText->layout.lines.size() ; i++)
+      {pText->layout.lines[i].built = LE_FALSE;}
+  }
+
+  // nur neu umgebrochene Zeilen werden aufgebaut, alle anderen behalten ihre Glyphen
+
+  for(size_t i = 0 ; i < pText->layout.lines.size() && !result ; i++)
+  {
+    pLine = &(pText->layout.lines[i]);
+
+    if(!pLine->built)
+    {
+      index = pLine->start;
+      end = index + pLine->length;
+      penX = 0;
+      previous = 0;
+      pLine->quads.clear();
+      pLine->right = 0;
+
+      while(index < end)
+      {
+        // TTF_RenderGlyph_Blended() kennt nur UCS-2
+
+        codepoint = this->textDecodeUTF8(pText->pText, &index);
+        character = (codepoint > 0xFFFF) ? '?' : (uint16_t) codepoint;
+
+        if(previous != 0)
+          {penX += this->fontGetKerning(pFont, previous, character);}
+
+        pGlyph = this->fontGetGlyph(pFont, character);
+
+        if(pGlyph == nullptr)
+        {
+          result = LE_FONT_ATLAS;
+          break;
+        }
+
+        if(pGlyph->srcRect.w > 0)
+        {
+          quad.srcRect = pGlyph->srcRect;
+          quad.dstRect = {penX + pGlyph->offsetX, pGlyph->offsetY, pGlyph->srcRect.w, pGlyph->srcRect.h};
+          quad.page = pGlyph->page;
+          pLine->quads.push_back(quad);
+
+          if(quad.dstRect.x + quad.dstRect.w > pLine->right)
+            {pLine->right = quad.dstRect.x + quad.dstRect.w;}
+        }
+
+        penX += pGlyph->advance;
+        previous = character;
+      }
+
+      pLine->built = !result;
+    }
+
+    if(textLineOffset(pText, *pLine) + pLine->right > right)
+      {right = textLineOffset(pText, *pLine) + pLine->right;}
+  }
+
+  pText->posSize.w = (textBlockWidth(pText) > right) ? textBlockWidth(pText) : right;
+  pText->posSize.h = textBlockHeight(pText);
+  pText->atlasGeneration = pFont->atlas.generation;
+
+  return result;
+}
+
+void LEMoon::textClearJobs()
+{
+  this->mtxText.finishedJobs.lock();
+
+  for(size_t i = 0 ; i < this->finishedTextJobs.size() ; i++)
+  {
+    if(this->finishedTextJobs[i]->pSurface != nullptr)
+      {SDL_FreeSurface(this->finishedTextJobs[i]->pSurface);}
+
+    if(this->finishedTextJobs[i]->pOutlineHandle != nullptr)
+      {this->fontReleaseHandle(this->finishedTextJobs[i]->pOutlineHandle);}
+
+    this->fontReleaseHandle(this->finishedTextJobs[i]->pHandle);
+    delete this->finishedTextJobs[i];
+  }
+
+  this->finishedTextJobs.clear();
+  this->mtxText.finishedJobs.unlock();
+}
+
+void LEMoon::textClearTexturePool()
+{
+  unordered_map<uint32_t, vector<SDL_Texture*>>::iterator pool;
+
+  for(pool = this->textTexturePool.begin() ; pool != this->textTexturePool.end() ; pool++)
+  {
+    for(size_t i = 0 ; i < pool->second.size() ; i++)
+      {SDL_DestroyTexture(pool->second[i]);}
+  }
+
+  this->textTexturePool.clear();
+}
+
+void LEMoon::textCreateJob(LEText * pText, LETextJob * pJob)
+{
+  SDL_Point position;
+
+  pJob->idText = pText->id;
+  pJob->request = pText->renderRequest;
+  pJob->pHandle = pText->pFont->pHandle;
+  pJob->text.assign((const char*) pText->pText, pText->length);
+  pJob->lines = pText->layout.lines;
+  pJob->linePositions.clear();
+
+  for(size_t i = 0 ; i < pText->layout.lines.size() ; i++)
+  {
+    position.x = textLineOffset(pText, pText->layout.lines[i]);
+    position.y = (int) i * textLinePitch(pText);
+    pJob->linePositions.push_back(position);
+  }
+
+  // einzeilige Texte ohne Ausrichtung werden am Stueck gerastert
+
+  pJob->width = textBlockWidth(pText);
+  pJob->height = textBlockHeight(pText);
+  pJob->singleLine = pText->layout.lines.size() == 1 && pJob->width == pText->layout.lines[0].width;
+  pJob->color = {pText->color.r, pText->color.g, pText->color.b, pText->color.a};
+  this->textUpdateOutline(pText);
+  pJob->pOutlineHandle = pText->pOutlineHandle;
+  pJob->effect = pText->effect;
+  pJob->pSurface = nullptr;
+  pJob->fillRect = {0, 0, 0, 0};
+}
+
+uint32_t LEMoon::textDecodeUTF8(const unsigned char * pText, uint32_t * pIndex)
+{
+  uint32_t codepoint = pText[*pIndex];
+  uint8_t follow = 0;
+
+  if(codepoint >= 0xF0)
+  {
+    codepoint &= 0x07;
+    follow = 3;
+  }
+  else if(codepoint >= 0xE0)
+  {
+    codepoint &= 0x0F;
+    follow = 2;
+  }
+  else if(codepoint >= 0xC0)
+  {
+    codepoint &= 0x1F;
+    follow = 1;
+  }
+
+  (*pIndex)++;
+
+  // abgeschnittene Folgen enden am naechsten Byte, das kein Folgebyte ist
+
+  for(uint8_t i = 0 ; i < follow && (pText[*pIndex] & 0xC0) == 0x80 ; i++)
+  {
+    codepoint = (codepoint << 6) | (pText[*pIndex] & 0x3F);
+    (*pIndex)++;
+  }
+
+  return codepoint;
+}
+
+int LEMoon::textDraw(LEText * pText)
+{
+  int result = LE_NO_ERROR;
+  SDL_Texture * pAtlas = nullptr;
+  SDL_Rect dstRect;
+  LETextLine * pLine = nullptr;
+  int lineX = 0;
+  int lineY = 0;
+
+  // veraenderte Texte werden erst hier und nur einmal neu gerastert
+
+  if(pText->visible && pText->pFont != nullptr && (pText->dirty || pText->fontRevision != pText->pFont->revision))
+    {result = this->textRasterize(pText);}
+
+  if(!result && pText->useAtlas)
+  {
+    if(pText->visible && pText->alpha > 0.0f && pText->pFont != nullptr)
+    {
+      // der Atlas wurde seit dem letzten Aufbau geleert, z.B. durch fontSetStyle()
+
+      if(pText->pFont->atlas.invalid || pText->atlasGeneration != pText->pFont->atlas.generation)
+        {result = this->textBuildGlyphRun(pText);}
+
+      // Bitmapschriften verteilen ihre Glyphen auf mehrere Seiten
+
+      for(size_t i = 0 ; i < pText->pFont->bitmap.pages.size() ; i++)
+      {
+        SDL_SetTextureColorMod(pText->pFont->bitmap.pages[i], pText->color.r, pText->color.g, pText->color.b);
+        SDL_SetTextureAlphaMod(pText->pFont->bitmap.pages[i], (uint8_t) pText->alpha);
+      }
+
+      pAtlas = pText->pFont->atlas.pTexture;
+
+      if(pAtlas != nullptr)
+      {
+        SDL_SetTextureColorMod(pAtlas, pText->color.r, pText->color.g, pText->color.b);
+        SDL_SetTextureAlphaMod(pAtlas, (uint8_t) pText->alpha);
+      }
+
+      if(pAtlas != nullptr || pText->pFont->bitmap.enabled)
+      {
+        // die Glyphen liegen relativ zu ihrer Zeile, Ausrichtung und Zeilenabstand kommen erst hier dazu
+
+        for(size_t i = 0 ; i < pText->layout.lines.size() && !result ; i++)
+        {
+          pLine = &(pText->layout.lines[i]);
+          lineX = pText->posSize.x + textLineOffset(pText, *pLine);
+          lineY = pText->posSize.y + (int) i * textLinePitch(pText);
+
+          for(size_t j = 0 ; j < pLine->quads.size() && !result ; j++)
+          {
+            if(pText->pFont->bitmap.enabled)
+              {pAtlas = pText->pFont->bitmap.pages[pLine->quads[j].page];}
+
+            dstRect = pLine->quads[j].dstRect;
+            dstRect.x += lineX;
+            dstRect.y += lineY;
+
+            if(SDL_RenderCopyEx(this->pRenderer, pAtlas, &(pLine->quads[j].srcRect), &dstRect, 0.0f, nullptr, SDL_FLIP_NONE))
+            {
+              #ifdef LE_DEBUG
+                char * pErrorString = new char[256 + 1];
+                sprintf(pErrorString, "LEMoon::textDraw(%d)\n\n", pText->id);
+                this->printErrorDialog(LE_SDL_RENDER_COPY_EX, pErrorString);
+                delete [] pErrorString;
+              #endif
+
+              result = LE_SDL_RENDER_COPY_EX;
+            }
+          }
+        }
+      }
+    }
+  }
+  else if(!result && pText->visible && pText->alpha > 0.0f && pText->pTexture != nullptr)
+  {
+    // Umriss und Schatten sind eingebacken und ragen ueber die Textposition hinaus
+
+    dstRect = {pText->posSize.x + pText->textureOffset.x, pText->posSize.y + pText->textureOffset.y, pText->textureRect.w, pText->textureRect.h};
+
+    if(SDL_RenderCopyEx(this->pRenderer, pText->pTexture, &(pText->textureRect), &dstRect, 0.0f, nullptr, SDL_FLIP_NONE))
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textDraw(%d)\n\n", pText->id);
+        this->printErrorDialog(LE_SDL_RENDER_COPY_EX, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_SDL_RENDER_COPY_EX;
+    }
+  }
+
+  return result;
+}
+
+LEText * LEMoon::textGet(uint32_t id)
+{
+  LEText * pRet = nullptr;
+  LEText * pCurrent = nullptr;
+
+  if(this->pTextHead != nullptr)
+  {
+    if(this->memory.pLastText != nullptr && this->memory.pLastText->id == id)
+      {pRet = this->memory.pLastText;}
+    else
+    {
+      pCurrent = this->pTextHead->pRight;
+
+      while(pCurrent != this->pTextHead)
+      {
+        if(pCurrent->id == id)
+        {
+          pRet = pCurrent;
+          this->memory.pLastText = pCurrent;
+          break;
+        }
+
+        pCurrent = pCurrent->pRight;
+      }
+    }
+  }
+
+  return pRet;
+}
+
+uint32_t LEMoon::textGetAmount()
+{
+  uint32_t amount = 0;
+  LEText * pCurrent = nullptr;
+
+  if(this->pTextHead != nullptr)
+  {
+    pCurrent = this->pTextHead->pRight;
+
+    while(pCurrent != this->pTextHead)
+    {
+      amount++;
+      pCurrent = pCurrent->pRight;
+    }
+  }
+
+  return amount;
+}
+
+LinkedVec2 * LEMoon::textGetDirection(LEText * pText, uint32_t idDirection)
+{
+  LinkedVec2 * pRet = nullptr;
+  LinkedVec2 * pCurrent = nullptr;
+
+  if(pText->pDirectionHead != nullptr)
+  {
+    pCurrent = pText->pDirectionHead->pRight;
+
+    while(pCurrent != pText->pDirectionHead)
+    {
+      if(pCurrent->id == idDirection)
+      {
+        pRet = pCurrent;
+        break;
+      }
+
+      pCurrent = pCurrent->pRight;
+    }
+  }
+
+  return pRet;
+}
+
+void LEMoon::textHandleInput()
+{
+  bool select = LE_FALSE;
+
+  if(this->textInputEnabled && this->textGet(this->textInputId) != nullptr)
+  {
+    switch(this->event.type)
+    {
+      case SDL_TEXTINPUT:
+      {
+        this->textAddString(this->textInputId, this->event.text.text);
+      } break;
+      case SDL_KEYDOWN:
+      {
+        select = (this->event.key.keysym.mod & KMOD_SHIFT) != 0;
+
+        switch(this->event.key.keysym.sym)
+        {
+          case SDLK_BACKSPACE:
+          {
+            this->textErase(this->textInputId, -1);
+          } break;
+          case SDLK_DELETE:
+          {
+            this->textErase(this->textInputId, 1);
+          } break;
+          case SDLK_LEFT:
+          {
+            this->textMoveCursor(this->textInputId, -1, select);
+          } break;
+          case SDLK_RIGHT:
+          {
+            this->textMoveCursor(this->textInputId, 1, select);
+          } break;
+          case SDLK_HOME:
+          {
+            this->textSetCursor(this->textInputId, 0, select);
+          } break;
+          case SDLK_END:
+          {
+            this->textSetCursor(this->textInputId, UINT32_MAX, select);
+          } break;
+        };
+      } break;
+    };
+  }
+}
+
+void LEMoon::textInsert(LEText * pText, const unsigned char * pBytes, uint32_t amount)
+{
+  // eine Auswahl wird durch die neuen Bytes ersetzt
+
+  if(pText->anchor != pText->cursor)
+    {this->textRemove(pText, (pText->anchor < pText->cursor) ? pText->anchor : pText->cursor, (pText->anchor < pText->cursor) ? pText->cursor : pText->anchor);}
+
+  this->textReserve(pText, pText->length + amount);
+
+  // alles hinter dem Cursor nach hinten schieben, inklusive Nullterminierung
+
+  memmove(pText->pText + pText->cursor + amount, pText->pText + pText->cursor, pText->length - pText->cursor + 1);
+  memcpy(pText->pText + pText->cursor, pBytes, amount);
+  textMarkEdit(pText, pText->cursor, 0, amount);
+  pText->length += amount;
+  pText->cursor += amount;
+  pText->anchor = pText->cursor;
+}
+
+void LEMoon::textLayout(LEText * pText)
+{
+  LEFont * pFont = pText->pFont;
+  LETextLine line;
+  vector<LETextLine> lines;
+  size_t first = 0;
+  size_t resync = 0;
+  bool incremental = pText->layout.edited && pText->layout.fontRevision == pFont->revision && !pText->layout.lines.empty();
+  bool synced = LE_FALSE;
+  uint32_t index = 0;
+  uint32_t next = 0;
+  uint32_t codepoint = 0;
+  uint32_t breakIndex = 0;
+  uint32_t breakNext = 0;
+  uint16_t character = 0;
+  uint16_t previous = 0;
+  bool hasBreak = LE_FALSE;
+  int breakWidth = 0;
+  int penX = 0;
+  int advance = 0;
+
+  // nach einer Bearbeitung wird ab der Zeile vor der Aenderung neu umgebrochen, ein geloeschtes Wort kann in die vorherige Zeile zurueckrutschen
+
+  if(incremental)
+  {
+    while(first + 1 < pText->layout.lines.size() && pText->layout.lines[first + 1].start <= pText->layout.editStart)
+      {first++;}
+
+    if(first > 0)
+      {first--;}
+  }
+
+  line.start = (incremental) ? pText->layout.lines[first].start : 0;
+  line.length = 0;
+  line.width = 0;
+  line.right = 0;
+  line.built = LE_FALSE;
+  index = line.start;
+  resync = first;
+  pText->layout.width = 0;
+
+  // nur Vorschub und Unterschneidung aus dem Fontcache, es wird nichts gerastert
+
+  while(index < pText->length)
+  {
+    // hinter der Bearbeitung gelten die alten Zeilen wieder, sobald eine neue Zeile dort beginnt, wo eine alte (verschoben) begann
+
+    if(incremental && index == line.start && index >= pText->layout.editEnd)
+    {
+      while(resync < pText->layout.lines.size() && (int64_t) pText->layout.lines[resync].start + pText->layout.editDelta < (int64_t) index)
+        {resync++;}
+
+      if(resync < pText->layout.lines.size() && (int64_t) pText->layout.lines[resync].start + pText->layout.editDelta == (int64_t) index)
+      {
+        synced = LE_TRUE;
+        break;
+      }
+    }
+
+    next = index;
+    codepoint = this->textDecodeUTF8(pText->pText, &next);
+    character = (codepoint > 0xFFFF) ? '?' : (uint16_t) codepoint;
+
+    if(codepoint == '\n')
+    {
+      line.length = index - line.start;
+      line.width = penX;
+      lines.push_back(line);
+      line.start = next;
+      penX = 0;
+      previous = 0;
+      hasBreak = LE_FALSE;
+    }
+    else
+    {
+      advance = this->fontGetAdvance(pFont, character);
+
+      if(previous != 0)
+        {advance += this->fontGetKerning(pFont, previous, character);}
+
+      if(pText->layout.maxWidth > 0 && penX + advance > pText->layout.maxWidth && index > line.start)
+      {
+        if(character == ' ')
+        {
+          // das Leerzeichen am Umbruch gehoert zu keiner Zeile
+
+          line.length = index - line.start;
+          line.width = penX;
+          lines.push_back(line);
+          line.start = next;
+          penX = 0;
+          previous = 0;
+          hasBreak = LE_FALSE;
+          index = next;
+          continue;
+        }
+        else if(hasBreak)
+        {
+          // am letzten Leerzeichen umbrechen, das angefangene Wort wird in der neuen Zeile noch einmal vermessen,
+          // so haengt jede Zeile nur von ihrem Anfang ab, ohne Unterschneidung mit dem Leerzeichen
+
+          line.length = breakIndex - line.start;
+          line.width = breakWidth;
+          lines.push_back(line);
+          line.start = breakNext;
+          penX = 0;
+          previous = 0;
+          hasBreak = LE_FALSE;
+          index = breakNext;
+          continue;
+        }
+        else
+        {
+          // ein Wort ohne Leerzeichen, das breiter als die Zeile ist, wird zwischen zwei Zeichen getrennt
+
+          line.length = index - line.start;
+          line.width = penX;
+          lines.push_back(line);
+          line.start = index;
+          penX = 0;
+          advance = this->fontGetAdvance(pFont, character);
+        }
+
+        hasBreak = LE_FALSE;
+      }
+
+      if(character == ' ')
+      {
+        hasBreak = LE_TRUE;
+        breakIndex = index;
+        breakNext = next;
+        breakWidth = penX;
+      }
+
+      penX += advance;
+      previous = character;
+    }
+
+    index = next;
+  }
+
+  if(synced)
+  {
+    for(size_t i = resync ; i < pText->layout.lines.size() ; i++)
+      {pText->layout.lines[i].start += pText->layout.editDelta;}
+
+    pText->layout.lines.erase(pText->layout.lines.begin() + first, pText->layout.lines.begin() + resync);
+  }
+  else
+  {
+    line.length = pText->length - line.start;
+    line.width = penX;
+    lines.push_back(line);
+    pText->layout.lines.erase(pText->layout.lines.begin() + first, pText->layout.lines.end());
+  }
+
+  pText->layout.lines.insert(pText->layout.lines.begin() + first, lines.begin(), lines.end());
+
+  for(size_t i = 0 ; i < pText->layout.lines.size() ; i++)
+  {
+    if(pText->layout.lines[i].width > pText->layout.width)
+      {pText->layout.width = pText->layout.lines[i].width;}
+  }
+
+  pText->layout.dirty = LE_FALSE;
+  pText->layout.edited = LE_FALSE;
+  pText->layout.fontRevision = pFont->revision;
+}
+
+int LEMoon::textRasterize(LEText * pText)
+{
+  int result = LE_NO_ERROR;
+  LETextJob job;
+
+  // ein noch laufender Auftrag im Hintergrund ist damit veraltet
+
+  this->textReserve(pText, pText->length);
+  pText->dirty = LE_FALSE;
+  pText->fontRevision = pText->pFont->revision;
+  pText->renderRequest = ++this->textRenderRequests;
+  this->stats.textRasterizations++;
+
+  if(pText->layout.dirty || pText->layout.fontRevision != pText->pFont->revision)
+    {this->textLayout(pText);}
+
+  // ein leerer Text wird nicht gerastert, TTF_RenderUTF8_Blended() meldet dafuer einen Fehler
+
+  if(pText->length == 0)
+  {
+    if(pText->pTexture != nullptr)
+    {
+      this->textReleaseTexture(pText->pTexture);
+      pText->pTexture = nullptr;
+    }
+
+    pText->useAtlas = textUsesAtlas(pText);
+    pText->posSize.w = 0;
+    pText->posSize.h = 0;
+  }
+  else
+  {
+    // mit Glyphenatlas wird nichts gerastert und keine Textur erstellt
+
+    if(textUsesAtlas(pText))
+    {
+      if(pText->pTexture != nullptr)
+      {
+        this->textReleaseTexture(pText->pTexture);
+        pText->pTexture = nullptr;
+      }
+
+      pText->useAtlas = LE_TRUE;
+      result = this->textBuildGlyphRun(pText);
+
+      // passt eine Glyphe nicht in den Atlas, z.B. breiter als LE_FONT_ATLAS_WIDTH, wird der ganze Text wie ohne Atlas gerastert
+
+      if(result == LE_FONT_ATLAS && !pText->pFont->bitmap.enabled && pText->pFont->pHandle != nullptr)
+      {
+        pText->useAtlas = LE_FALSE;
+        result = LE_NO_ERROR;
+      }
+      else if(result)
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::textRasterize(%u)\n\n", pText->id);
+          this->printErrorDialog(result, pErrorString);
+          delete [] pErrorString;
+        #endif
+      }
+    }
+    else
+      {pText->useAtlas = LE_FALSE;}
+
+    if(!pText->useAtlas)
+    {
+      this->textCreateJob(pText, &job);
+      textRenderJob(&job);
+
+      if(job.pSurface != nullptr)
+        {result = this->textUploadSurface(pText, &job);}
+      else
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::textRasterize(%u)\n\n", pText->id);
+          this->printErrorDialog(LE_RENDER_TEXT_BLENDED, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_RENDER_TEXT_BLENDED;
+      }
+    }
+  }
+
+  return result;
+}
+
+void LEMoon::textReleaseTexture(SDL_Texture * pTexture)
+{
+  int width = 0;
+  int height = 0;
+  vector<SDL_Texture*> * pPool = nullptr;
+
+  SDL_QueryTexture(pTexture, nullptr, nullptr, &width, &height);
+  pPool = &this->textTexturePool[((uint32_t) width << 16) | (uint32_t) height];
+
+  if(pPool->size() < LE_TEXT_POOL_PER_SIZE)
+    {pPool->push_back(pTexture);}
+  else
+    {SDL_DestroyTexture(pTexture);}
+}
+
+void LEMoon::textRemove(LEText * pText, uint32_t start, uint32_t end)
+{
+  // alles hinter dem Bereich nach vorne schieben, inklusive Nullterminierung
+
+  memmove(pText->pText + start, pText->pText + end, pText->length - end + 1);
+  textMarkEdit(pText, start, end - start, 0);
+  pText->length -= end - start;
+  pText->cursor = start;
+  pText->anchor = start;
+}
+
+void LEMoon::textReserve(LEText * pText, uint32_t length)
+{
+  uint32_t capacity = (pText->capacity > 0) ? pText->capacity : 32;
+  unsigned char * pNewText = nullptr;
+
+  // der Buffer wird verdoppelt, damit haeufiges Anhaengen nur selten neu anfordert
+
+  if(pText->pText == nullptr || length + 1 > pText->capacity)
+  {
+    while(length + 1 > capacity)
+      {capacity *= 2;}
+
+    pNewText = new unsigned char[capacity];
+
+    if(pText->pText != nullptr)
+    {
+      memcpy(pNewText, pText->pText, pText->length + 1);
+      delete [] pText->pText;
+    }
+    else
+      {pNewText[0] = '\0';}
+
+    pText->pText = pNewText;
+    pText->capacity = capacity;
+  }
+}
+
+void LEMoon::textUploadJobs()
+{
+  vector<LETextJob*> jobs;
+  LEText * pText = nullptr;
+
+  this->mtxText.finishedJobs.lock();
+  jobs.swap(this->finishedTextJobs);
+  this->mtxText.finishedJobs.unlock();
+
+  for(size_t i = 0 ; i < jobs.size() ; i++)
+  {
+    pText = this->textGet(jobs[i]->idText);
+
+    // geloeschte oder inzwischen erneut gerasterte Texte verwerfen das Ergebnis
+
+    if(pText != nullptr && pText->renderRequest == jobs[i]->request)
+    {
+      if(jobs[i]->pSurface != nullptr)
+      {
+        pText->useAtlas = LE_FALSE;
+        this->textUploadSurface(pText, jobs[i]);
+      }
+      else
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::textUploadJobs(%u)\n\n", pText->id);
+          this->printErrorDialog(LE_RENDER_TEXT_BLENDED, pErrorString);
+          delete [] pErrorString;
+        #endif
+      }
+    }
+
+    if(jobs[i]->pSurface != nullptr)
+      {SDL_FreeSurface(jobs[i]->pSurface);}
+
+    if(jobs[i]->pOutlineHandle != nullptr)
+      {this->fontReleaseHandle(jobs[i]->pOutlineHandle);}
+
+    this->fontReleaseHandle(jobs[i]->pHandle);
+    delete jobs[i];
+  }
+}
+
+int LEMoon::textUploadSurface(LEText * pText, LETextJob * pJob)
+{
+  int result = LE_NO_ERROR;
+  SDL_Surface * pSurface = pJob->pSurface;
+  SDL_Texture * pTexture = pText->pTexture;
+  SDL_Rect textureRect = {0, 0, pSurface->w, pSurface->h};
+  int width = 0;
+  int height = 0;
+
+  if(SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl"))
+  {
+    // solange der Text in der Groessenklasse seiner Textur bleibt, werden nur ihre Pixel ueberschrieben
+
+    if(pTexture != nullptr)
+    {
+      SDL_QueryTexture(pTexture, nullptr, nullptr, &width, &height);
+
+      if(width != textTextureSize(pSurface->w, this->textTextureMax.x) || height != textTextureSize(pSurface->h, this->textTextureMax.y))
+        {pTexture = nullptr;}
+    }
+
+    if(pTexture == nullptr)
+      {pTexture = this->textAcquireTexture(pSurface->w, pSurface->h);}
+
+    // TTF_RenderUTF8_Blended() und die mehrzeiligen Surfaces liefern bereits ARGB8888
+
+    if(pTexture != nullptr && (SDL_UpdateTexture(pTexture, &textureRect, pSurface->pixels, pSurface->pitch) || textClearTextureEdge(pTexture, pSurface->w, pSurface->h)))
+    {
+      if(pTexture != pText->pTexture)
+        {this->textReleaseTexture(pTexture);}
+
+      pTexture = nullptr;
+    }
+
+    if(pTexture != nullptr)
+    {
+      // die alte Textur wird erst ersetzt, wenn die neue bereit ist
+
+      if(pText->pTexture != nullptr && pText->pTexture != pTexture)
+        {this->textReleaseTexture(pText->pTexture);}
+
+      pText->pTexture = pTexture;
+      pText->textureRect = textureRect;
+      pText->textureOffset = {-pJob->fillRect.x, -pJob->fillRect.y};
+      pText->posSize.w = pJob->fillRect.w;
+      pText->posSize.h = pJob->fillRect.h;
+      SDL_SetTextureAlphaMod(pText->pTexture, (uint8_t) pText->alpha);
+
+      if(SDL_SetTextureBlendMode(pText->pTexture, SDL_BLENDMODE_BLEND))
+      {
+        #ifdef LE_DEBUG
+          char * pErrorString = new char[256 + 1];
+          sprintf(pErrorString, "LEMoon::textUploadSurface(%u)\n\n", pText->id);
+          this->printErrorDialog(LE_SDL_BLENDMODE, pErrorString);
+          delete [] pErrorString;
+        #endif
+
+        result = LE_SDL_BLENDMODE;
+      }
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textUploadSurface(%u)\n\n", pText->id);
+        this->printErrorDialog(LE_SDL_TEXTURE_LOAD, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_SDL_TEXTURE_LOAD;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textUploadSurface(%u)\n\n", pText->id);
+      this->printErrorDialog(LE_SDL_HINT, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_SDL_HINT;
+  }
+
+  SDL_FreeSurface(pSurface);
+  pJob->pSurface = nullptr;
+  return result;
+}
+
+void LEMoon::textUpdateOutline(LEText * pText)
+{
+  LEFontHandle * pHandle = pText->pFont->pHandle;
+  LEFontHandle * pOutline = pText->pOutlineHandle;
+
+  // das Handle mit Umriss folgt Datei, Groesse und Stil des Fonts, damit Fuellung und Umriss deckungsgleich sind
+
+  if(pOutline != nullptr && (pText->effect.outline == 0 || pHandle == nullptr || pOutline->pFace != pHandle->pFace || pOutline->size != pHandle->size || pOutline->style != pHandle->style || pOutline->outline != pText->effect.outline))
+  {
+    this->fontReleaseHandle(pOutline);
+    pText->pOutlineHandle = nullptr;
+  }
+
+  if(pText->pOutlineHandle == nullptr && pText->effect.outline > 0 && pHandle != nullptr)
+    {pText->pOutlineHandle = this->fontAcquireHandle(pHandle->pFace->path.c_str(), pHandle->size, pHandle->style, pText->effect.outline);}
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public text
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+int LEMoon::textCreate(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pNew = this->textGet(id);
+
+  if(pNew == nullptr)
+  {
+    if(this->pTextHead == nullptr)
+    {
+      this->pTextHead = new LEText;
+      this->pTextHead->pLeft = this->pTextHead;
+      this->pTextHead->pRight = this->pTextHead;
+      this->pTextHead->zindex = 0;
+      this->pTextHead->id = 1989;
+    }
+
+    pNew = new LEText;
+    pNew->pRight = this->pTextHead;
+    pNew->pLeft = this->pTextHead->pLeft;
+    this->pTextHead->pLeft->pRight = pNew;
+    this->pTextHead->pLeft = pNew;
+    pNew->id = id;
+    pNew->pText = nullptr;
+    pNew->length = 0;
+    pNew->capacity = 0;
+    pNew->cursor = 0;
+    pNew->anchor = 0;
+    pNew->dirty = LE_TRUE;
+    pNew->fontRevision = 0;
+    pNew->layout.maxWidth = 0;
+    pNew->layout.align = LE_ALIGN_LEFT;
+    pNew->layout.lineSpacing = 0;
+    pNew->layout.dirty = LE_TRUE;
+    pNew->layout.edited = LE_FALSE;
+    pNew->layout.fontRevision = 0;
+    pNew->layout.width = 0;
+    pNew->renderRequest = 0;
+    pNew->color = {255, 255, 255, 255};
+    pNew->zindex = 1;
+    pNew->visible = LE_TRUE;
+    pNew->pFont = nullptr;
+    pNew->pOutlineHandle = nullptr;
+    pNew->pTexture = nullptr;
+    pNew->textureRect = {0, 0, 0, 0};
+    pNew->textureOffset = {0, 0};
+    pNew->alpha = 255;
+    pNew->effect.outline = 0;
+    pNew->effect.outlineColor = {0, 0, 0, 255};
+    pNew->effect.shadowOffset = {0, 0};
+    pNew->effect.shadowColor = {0, 0, 0, 255};
+    pNew->pDirectionHead = nullptr;
+    pNew->position = glm::vec2(0.0f, 0.0f);
+    pNew->useAtlas = LE_FALSE;
+    pNew->atlasGeneration = 0;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textCreate(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_EXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_EXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textDelete(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LinkedVec2 * pCurrentDirection = nullptr;
+  LinkedVec2 * pNextDirection = nullptr;
+
+  if(pText != nullptr)
+  {
+    // textUploadJobs() erkennt geloeschte Texte an textGet(), der Zwischenspeicher darf ihn daher nicht mehr liefern
+
+    if(this->memory.pLastText == pText)
+      {this->memory.pLastText = nullptr;}
+
+    // ein geloeschter Eingabetext darf keine Ereignisse mehr erhalten
+
+    if(this->textInputEnabled && this->textInputId == id)
+    {
+      this->textInputEnabled = LE_FALSE;
+      SDL_StopTextInput();
+    }
+
+    pText->pLeft->pRight = pText->pRight;
+    pText->pRight->pLeft = pText->pLeft;
+
+    // loesche Bewegungsrichtungen
+
+    if(pText->pDirectionHead != nullptr)
+    {
+      pCurrentDirection = pText->pDirectionHead->pRight;
+
+      while(pCurrentDirection != pText->pDirectionHead)
+      {
+        pNextDirection = pCurrentDirection->pRight;
+        delete pCurrentDirection;
+        pCurrentDirection = pNextDirection;
+      }
+
+      delete pText->pDirectionHead;
+      pText->pDirectionHead = nullptr;
+    }
+
+    // loesche Text
+
+    if(pText->pText != nullptr)
+    {
+      delete [] pText->pText;
+      pText->pText = nullptr;
+    }
+
+    // loesche Textur
+
+    if(pText->pTexture != nullptr)
+    {
+      this->textReleaseTexture(pText->pTexture);
+      pText->pTexture = nullptr;
+    }
+
+    if(pText->pOutlineHandle != nullptr)
+      {this->fontReleaseHandle(pText->pOutlineHandle);}
+
+    delete pText;
+
+    if(this->pTextHead->pLeft == this->pTextHead && this->pTextHead->pRight == this->pTextHead)
+    {
+      delete this->pTextHead;
+      this->pTextHead = nullptr;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textDelete(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textAddLetter(uint32_t id, uint8_t letter)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+    {this->textInsert(pText, &letter, 1);}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textAddLetter(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;	
+  }
+
+  return result;
+}
+
+int LEMoon::textSubmit(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // der Buffer ist bereits nullterminiert und Aenderungen werden beim Zeichnen uebernommen
+
+    this->textReserve(pText, pText->length);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSubmit(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;	
+  }
+
+  return result;
+}
+
+int LEMoon::textSetColor(uint32_t id, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // aus dem Atlas gezeichnete Texte werden nur eingefaerbt und muessen nicht neu gerastert werden
+
+    if(!pText->useAtlas && (pText->color.r != r || pText->color.g != g || pText->color.b != b || pText->color.a != a))
+      {pText->dirty = LE_TRUE;}
+
+    pText->color = {r, g, b, a};
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetColor(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;	
+  }
+
+  return result;
+}
+
+int LEMoon::textSetVisible(uint32_t id, bool visible)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+    {pText->visible = visible;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetVisible(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;	
+  }
+
+  return result;
+}
+
+int LEMoon::textSetZindex(uint32_t id, uint32_t zindex)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LEText * pCurrent = nullptr;
+  bool moreThanOneElement = this->pTextHead->pLeft->id != this->pTextHead->pRight->id;
+
+  if(zindex == 0)
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetZindex(%u, %u)\n\n", id, zindex);
+      this->printErrorDialog(LE_INVALID_ZINDEX, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_INVALID_ZINDEX;
+  }
+
+  if(moreThanOneElement)
+  {
+    if(!result && pText != nullptr)
+    {
+      // auskoppeln
+    
+      pText->pLeft->pRight = pText->pRight;
+      pText->pRight->pLeft = pText->pLeft;
+      pText->zindex = zindex;
+    
+      // neu einordnen
+    
+      pCurrent = this->pTextHead->pRight;
+    
+      while(pCurrent != this->pTextHead)
+      {
+        if(pText->zindex >= pCurrent->zindex)
+        {
+          // dahinter einfuegen
+    
+          pText->pLeft = pCurrent;
+          pText->pRight = pCurrent->pRight;
+          pCurrent->pRight->pLeft = pText;
+          pCurrent->pRight = pText;
+          break;
+        }
+    
+        pCurrent = pCurrent->pRight;
+      }
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textSetZindex(%u)\n\n", id);
+        this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+    
+      result = LE_TEXT_NOEXIST;	
+    }
+  }
+
+  return result;
+}
+
+int LEMoon::textRelateFont(uint32_t id, uint32_t idFont)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LEFont * pFont = this->fontGet(idFont);
+
+  if(pFont == nullptr)
+    {pFont = this->fontGetFromBuffer(idFont);}
+
+  if(pText != nullptr)
+  {
+    if(pFont != nullptr)
+    {
+      if(pText->pFont != pFont)
+      {
+        pText->dirty = LE_TRUE;
+        pText->layout.dirty = LE_TRUE;
+        pText->layout.edited = LE_FALSE;
+      }
+
+      pText->pFont = pFont;
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textRelateFont(%u, %u)\n\n", id, idFont);
+        this->printErrorDialog(LE_FONT_NOEXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_FONT_NOEXIST;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textRelateFont(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textPrepareForDrawing(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    if(pText->pFont != nullptr)
+    {
+      // unveraenderte Texte werden nicht erneut gerastert
+
+      if(pText->dirty || pText->fontRevision != pText->pFont->revision)
+        {result = this->textRasterize(pText);}
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
+        this->printErrorDialog(LE_TEXT_RELATE_FONT, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_TEXT_RELATE_FONT;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textPrepareForDrawing(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textPrepareForDrawingAsync(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LETextJob * pJob = nullptr;
+
+  if(pText != nullptr)
+  {
+    if(pText->pFont != nullptr)
+    {
+      if(pText->dirty || pText->fontRevision != pText->pFont->revision)
+      {
+        // Texte aus dem Glyphenatlas und leere Texte sind ohne Rastern fertig und werden sofort aufgebaut
+
+        if(textUsesAtlas(pText) || pText->length == 0 || pText->pFont->pHandle == nullptr)
+          {result = this->textRasterize(pText);}
+        else
+        {
+          this->textReserve(pText, pText->length);
+          pText->dirty = LE_FALSE;
+          pText->fontRevision = pText->pFont->revision;
+          pText->renderRequest = ++this->textRenderRequests;
+          this->stats.textRasterizations++;
+
+          if(pText->layout.dirty || pText->layout.fontRevision != pText->pFont->revision)
+            {this->textLayout(pText);}
+
+          // der Auftrag arbeitet mit einer Kopie, die alte Textur bleibt bis zum Hochladen sichtbar
+
+          pJob = new LETextJob;
+          this->textCreateJob(pText, pJob);
+          this->fontRetainHandle(pJob->pHandle);
+
+          if(pJob->pOutlineHandle != nullptr)
+            {this->fontRetainHandle(pJob->pOutlineHandle);}
+
+          this->worker.workerPost([this, pJob]
+          {
+            textRenderJob(pJob);
+            this->mtxText.finishedJobs.lock();
+            this->finishedTextJobs.push_back(pJob);
+            this->mtxText.finishedJobs.unlock();
+          });
+        }
+      }
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textPrepareForDrawingAsync(%u)\n\n", id);
+        this->printErrorDialog(LE_TEXT_RELATE_FONT, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_TEXT_RELATE_FONT;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textPrepareForDrawingAsync(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetPosition(uint32_t id, int x, int y)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pText->posSize.x = x;
+    pText->posSize.y = y;
+    pText->position.x = (float) x;
+    pText->position.y = (float) y;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetPosition(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textAddString(uint32_t id, const char * pString)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+    {this->textInsert(pText, (const unsigned char*) pString, strlen(pString));}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textAddString(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetString(uint32_t id, const char * pString)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  uint32_t length = 0;
+
+  if(pText != nullptr)
+  {
+    // ersetzt den Inhalt mit einer Kopie, der Buffer wird nur vergroessert, wenn er zu klein ist
+
+    length = strlen(pString);
+    this->textReserve(pText, length);
+    memcpy(pText->pText, pString, length + 1);
+    pText->length = length;
+    pText->cursor = length;
+    pText->anchor = length;
+    pText->dirty = LE_TRUE;
+    pText->layout.dirty = LE_TRUE;
+    pText->layout.edited = LE_FALSE;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetString(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetMaxWidth(uint32_t id, int maxWidth)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // nur eine neue Breite erfordert neue Zeilenumbrueche
+
+    if(pText->layout.maxWidth != maxWidth)
+    {
+      pText->layout.maxWidth = maxWidth;
+      pText->layout.dirty = LE_TRUE;
+      pText->layout.edited = LE_FALSE;
+      pText->dirty = LE_TRUE;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetMaxWidth(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetAlign(uint32_t id, uint8_t align)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    if(pText->layout.align != align)
+    {
+      pText->layout.align = align;
+      pText->dirty = LE_TRUE;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetAlign(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetLineSpacing(uint32_t id, int lineSpacing)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    if(pText->layout.lineSpacing != lineSpacing)
+    {
+      pText->layout.lineSpacing = lineSpacing;
+      pText->dirty = LE_TRUE;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetLineSpacing(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetAlpha(uint32_t id, uint8_t alpha)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pText->alpha = (double) alpha;
+
+    // aus dem Atlas gezeichnete Texte setzen den Alphawert erst beim Zeichnen
+
+    if(!pText->useAtlas && pText->pTexture != nullptr && SDL_SetTextureAlphaMod(pText->pTexture, (uint8_t) pText->alpha))
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textSetAlpha(%u, %u)\n\n", id, alpha);
+        this->printErrorDialog(LE_ALPHA_MOD, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_ALPHA_MOD;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetAlpha(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textFade(uint32_t id, double alphaPerSecond)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pText->alpha += (alphaPerSecond * this->timestep);
+
+    if(pText->alpha <= 0.0f)
+      {pText->alpha = 0.0f;}
+
+    if(pText->alpha >= 255.0f)
+      {pText->alpha = 255.0f;}
+
+    if(!pText->useAtlas && pText->pTexture != nullptr && SDL_SetTextureAlphaMod(pText->pTexture, (uint8_t) pText->alpha))
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textFade(%u, %1.2f)\n\n", id, alphaPerSecond);
+        this->printErrorDialog(LE_ALPHA_MOD, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_ALPHA_MOD;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textFade(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textClear(uint32_t id)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // der Buffer bleibt fuer den naechsten Text erhalten
+
+    if(pText->pText != nullptr)
+      {pText->pText[0] = '\0';}
+
+    pText->length = 0;
+    pText->cursor = 0;
+    pText->anchor = 0;
+    pText->dirty = LE_TRUE;
+    pText->layout.dirty = LE_TRUE;
+    pText->layout.edited = LE_FALSE;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textClear(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+double LEMoon::textGetAlpha(uint32_t id)
+{
+  LEText * pText = this->textGet(id);
+  double alpha = 0.0f;
+
+  if(pText != nullptr)
+    {alpha = pText->alpha;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textGetAlpha(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return alpha;
+}
+
+int LEMoon::textAddDirection(uint32_t id, uint32_t idDirection, glm::vec2 direction)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LinkedVec2 * pNew = nullptr;
+
+  if(pText != nullptr)
+  {
+    pNew = this->textGetDirection(pText, idDirection);
+
+    if(pNew == nullptr)
+    {
+      if(pText->pDirectionHead == nullptr)
+      {
+        pText->pDirectionHead = new LinkedVec2;
+        pText->pDirectionHead->pLeft = pText->pDirectionHead;
+        pText->pDirectionHead->pRight = pText->pDirectionHead;
+      }
+
+      pNew = new LinkedVec2;
+      pNew->pRight = pText->pDirectionHead;
+      pNew->pLeft = pText->pDirectionHead->pLeft;
+      pText->pDirectionHead->pLeft->pRight = pNew;
+      pText->pDirectionHead->pLeft = pNew;
+      pNew->id = idDirection;
+      pNew->currentDegree = 0.0f;
+      pNew->data = direction;
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textAddDirection(%u, %u, glm::vec2(%1.2f, %1.2f))\n\n", id, idDirection, direction.x, direction.y);
+        this->printErrorDialog(LE_DIRECTION_EXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_DIRECTION_EXIST;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textAddDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textMoveDirection(uint32_t id, uint32_t idDirection)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  LinkedVec2 * pDirection = nullptr;
+
+  if(pText != nullptr)
+  {
+    pDirection = this->textGetDirection(pText, idDirection);
+
+    if(pDirection != nullptr)
+    {
+      pText->position.x += (float)(pDirection->data.x * this->timestep);
+      pText->position.y += (float)(pDirection->data.y * this->timestep);
+      pText->posSize.x = (int) pText->position.x;
+      pText->posSize.y = (int) pText->position.y;
+    }
+    else
+    {
+      #ifdef LE_DEBUG
+        char * pErrorString = new char[256 + 1];
+        sprintf(pErrorString, "LEMoon::textMoveDirection(%u, %u)\n\n", id, idDirection);
+        this->printErrorDialog(LE_DIRECTION_NOEXIST, pErrorString);
+        delete [] pErrorString;
+      #endif
+
+      result = LE_DIRECTION_NOEXIST;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textMoveDirection(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+SDL_Point LEMoon::textGetPosition(uint32_t id)
+{
+  SDL_Point pos;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pos.x = pText->posSize.x;
+    pos.y = pText->posSize.y;
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textGetPosition(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return pos;
+}
+
+SDL_Point LEMoon::textGetSize(uint32_t id)
+{
+  SDL_Point size;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // noch nicht gerasterte Texte werden nur vermessen
+
+    if(pText->pFont != nullptr && (pText->dirty || pText->fontRevision != pText->pFont->revision))
+    {
+      if(pText->layout.dirty || pText->layout.fontRevision != pText->pFont->revision)
+      {
+        this->textReserve(pText, pText->length);
+        this->textLayout(pText);
+      }
+
+      size.x = (pText->length > 0) ? textBlockWidth(pText) : 0;
+      size.y = (pText->length > 0) ? textBlockHeight(pText) : 0;
+    }
+    else
+    {
+      size.x = pText->posSize.w;
+      size.y = pText->posSize.h;
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textGetSize(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return size;
+}
+
+bool LEMoon::textGetVisible(uint32_t id)
+{
+  bool visible = LE_FALSE;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+    {visible = pText->visible;}
+
+  return visible;
+}
+
+int LEMoon::textErase(uint32_t id, int letters)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  uint32_t start = 0;
+  uint32_t end = 0;
+
+  if(pText != nullptr)
+  {
+    start = pText->cursor;
+    end = pText->cursor;
+
+    // eine Auswahl wird komplett geloescht, sonst ganze UTF-8 Zeichen vor oder hinter dem Cursor
+
+    if(pText->anchor != pText->cursor)
+    {
+      start = (pText->anchor < pText->cursor) ? pText->anchor : pText->cursor;
+      end = (pText->anchor < pText->cursor) ? pText->cursor : pText->anchor;
+    }
+    else if(letters < 0)
+    {
+      for(int i = 0 ; i > letters && start > 0 ; i--)
+        {start = textPreviousLetter(pText, start);}
+    }
+    else
+    {
+      for(int i = 0 ; i < letters && end < pText->length ; i++)
+        {this->textDecodeUTF8(pText->pText, &end);}
+    }
+
+    if(start != end)
+      {this->textRemove(pText, start, end);}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textErase(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+uint32_t LEMoon::textGetCursor(uint32_t id)
+{
+  LEText * pText = this->textGet(id);
+  uint32_t cursor = 0;
+
+  if(pText != nullptr)
+    {cursor = pText->cursor;}
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textGetCursor(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return cursor;
+}
+
+SDL_Point LEMoon::textGetSelection(uint32_t id)
+{
+  LEText * pText = this->textGet(id);
+  SDL_Point selection = {0, 0};
+
+  if(pText != nullptr)
+  {
+    selection.x = (int) ((pText->anchor < pText->cursor) ? pText->anchor : pText->cursor);
+    selection.y = (int) ((pText->anchor < pText->cursor) ? pText->cursor : pText->anchor);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textGetSelection(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+  }
+
+  return selection;
+}
+
+int LEMoon::textMoveCursor(uint32_t id, int letters, bool select)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+  uint32_t cursor = 0;
+
+  if(pText != nullptr)
+  {
+    cursor = pText->cursor;
+
+    for(int i = 0 ; i > letters && cursor > 0 ; i--)
+      {cursor = textPreviousLetter(pText, cursor);}
+
+    for(int i = 0 ; i < letters && cursor < pText->length ; i++)
+      {this->textDecodeUTF8(pText->pText, &cursor);}
+
+    // der Cursor wird nicht gezeichnet, daher muss nichts neu gerastert werden
+
+    pText->cursor = cursor;
+
+    if(!select)
+      {pText->anchor = cursor;}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textMoveCursor(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetCursor(uint32_t id, uint32_t position, bool select)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pText->cursor = textSnapLetter(pText, position);
+
+    if(!select)
+      {pText->anchor = pText->cursor;}
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetCursor(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetInput(uint32_t id, bool enabled)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // es gibt nur einen Eingabetext, SDL liefert SDL_TEXTINPUT nur zwischen SDL_StartTextInput() und SDL_StopTextInput()
+
+    if(enabled)
+    {
+      this->textInputId = id;
+      this->textInputEnabled = LE_TRUE;
+      SDL_StartTextInput();
+    }
+    else if(this->textInputEnabled && this->textInputId == id)
+    {
+      this->textInputEnabled = LE_FALSE;
+      SDL_StopTextInput();
+    }
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetInput(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetSelection(uint32_t id, uint32_t start, uint32_t end)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    pText->anchor = textSnapLetter(pText, start);
+    pText->cursor = textSnapLetter(pText, end);
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetSelection(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetOutline(uint32_t id, int outline, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // die Zeilenumbrueche bleiben, der Umriss ragt nur ueber die Textposition hinaus, gerastert wird nur bei einer Aenderung
+
+    outline = (outline > 0) ? outline : 0;
+
+    if(pText->effect.outline != outline || pText->effect.outlineColor.r != r || pText->effect.outlineColor.g != g || pText->effect.outlineColor.b != b || pText->effect.outlineColor.a != a)
+      {pText->dirty = LE_TRUE;}
+
+    pText->effect.outline = outline;
+    pText->effect.outlineColor = {r, g, b, a};
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetOutline(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
+
+int LEMoon::textSetShadow(uint32_t id, int offsetX, int offsetY, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+  int result = LE_NO_ERROR;
+  LEText * pText = this->textGet(id);
+
+  if(pText != nullptr)
+  {
+    // der Schatten wird eingebacken, gerastert wird nur bei einer Aenderung
+
+    if(pText->effect.shadowOffset.x != offsetX || pText->effect.shadowOffset.y != offsetY || pText->effect.shadowColor.r != r || pText->effect.shadowColor.g != g || pText->effect.shadowColor.b != b || pText->effect.shadowColor.a != a)
+      {pText->dirty = LE_TRUE;}
+
+    pText->effect.shadowOffset = {offsetX, offsetY};
+    pText->effect.shadowColor = {r, g, b, a};
+  }
+  else
+  {
+    #ifdef LE_DEBUG
+      char * pErrorString = new char[256 + 1];
+      sprintf(pErrorString, "LEMoon::textSetShadow(%u)\n\n", id);
+      this->printErrorDialog(LE_TEXT_NOEXIST, pErrorString);
+      delete [] pErrorString;
+    #endif
+
+    result = LE_TEXT_NOEXIST;
+  }
+
+  return result;
+}
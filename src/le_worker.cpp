@@ -0,0 +1,158 @@
+/*
+  Author:             Patrick-Christopher Mattulat
+  e-mail:             pmattulat@outlook.de
+  Dev-Tool:           Ubuntu 16.04 LTS, g++ Compiler
+  date:               19.10.2026
+  updated:            19.10.2026
+*/
+
+#include "../include/le_worker.h"
+#include <memory>
+
+typedef struct sLEParallelFor
+{
+  atomic<uint32_t> next;                                                            // naechster freier Index
+  atomic<uint32_t> done;                                                            // Anzahl bereits erledigter Indizes
+  uint32_t amount;
+  function<void(uint32_t)> job;
+  mutex mtxDone;
+  condition_variable cvDone;
+} LEParallelFor;
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// private
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+static void workerRunIndices(LEParallelFor * pFor)
+{
+  uint32_t index = 0;
+  uint32_t finished = 0;
+
+  // jeder beteiligte Thread holt sich so lange Indizes, bis keine mehr uebrig sind
+
+  while((index = pFor->next.fetch_add(1)) < pFor->amount)
+  {
+    pFor->job(index);
+    finished++;
+  }
+
+  if(finished > 0 && pFor->done.fetch_add(finished) + finished == pFor->amount)
+  {
+    pFor->mtxDone.lock();
+    pFor->cvDone.notify_all();
+    pFor->mtxDone.unlock();
+  }
+}
+
+void LEWorker::workerLoop()
+{
+  function<void()> task;
+
+  while(true)
+  {
+    {
+      unique_lock<mutex> lock(this->mtxTasks);
+      this->cvTasks.wait(lock, [this] {return this->stop || !this->tasks.empty();});
+
+      if(this->tasks.empty())
+        {break;}
+
+      task = this->tasks.front();
+      this->tasks.pop_front();
+    }
+
+    task();
+  }
+}
+
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+// public
+//////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////
+
+LEWorker::LEWorker():
+stop(false)
+{
+}
+
+LEWorker::~LEWorker()
+{
+  this->workerStop();
+}
+
+uint32_t LEWorker::workerGetAmountOfThreads()
+{
+  return (uint32_t) this->threads.size();
+}
+
+void LEWorker::workerParallelFor(uint32_t amount, const function<void(uint32_t)> &job)
+{
+  shared_ptr<LEParallelFor> pFor;
+  uint32_t helpers = 0;
+
+  if(amount > 0)
+  {
+    // ohne Arbeitsthreads oder bei nur einem Index lohnt sich das Verteilen nicht
+
+    if(this->threads.empty() || amount == 1)
+    {
+      for(uint32_t i = 0 ; i < amount ; i++)
+        {job(i);}
+    }
+    else
+    {
+      pFor = make_shared<LEParallelFor>();
+      pFor->next = 0;
+      pFor->done = 0;
+      pFor->amount = amount;
+      pFor->job = job;
+      helpers = (amount - 1 < this->threads.size()) ? amount - 1 : (uint32_t) this->threads.size();
+
+      for(uint32_t i = 0 ; i < helpers ; i++)
+        {this->workerPost([pFor] {workerRunIndices(pFor.get());});}
+
+      workerRunIndices(pFor.get());
+
+      unique_lock<mutex> lock(pFor->mtxDone);
+      pFor->cvDone.wait(lock, [pFor] {return pFor->done.load() == pFor->amount;});
+    }
+  }
+}
+
+void LEWorker::workerPost(const function<void()> &task)
+{
+  if(this->threads.empty())
+    {task();}
+  else
+  {
+    this->mtxTasks.lock();
+    this->tasks.push_back(task);
+    this->mtxTasks.unlock();
+    this->cvTasks.notify_one();
+  }
+}
+
+void LEWorker::workerStart(uint32_t amount)
+{
+  this->workerStop();
+  this->stop = false;
+
+  for(uint32_t i = 0 ; i < amount ; i++)
+    {this->threads.push_back(thread(&LEWorker::workerLoop, this));}
+}
+
+void LEWorker::workerStop()
+{
+  this->mtxTasks.lock();
+  this->stop = true;
+  this->mtxTasks.unlock();
+  this->cvTasks.notify_all();
+
+  for(size_t i = 0 ; i < this->threads.size() ; i++)
+    {this->threads[i].join();}
+
+  this->threads.clear();
+}